@@ -76,7 +76,9 @@ DataCallbackResult AndroidAudioRecorder::onAudioReady(
     writeToBuffers(inputChannel, numFrames);
   }
 
-  while (circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
+  // without a listener nothing is buffered and no bus is allocated
+  while (hasOnAudioReadyCallback() &&
+         circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
     auto bus = std::make_shared<AudioBus>(bufferLength_, 1, sampleRate_);
     auto *outputChannel = bus->getChannel(0)->getData();
 
@@ -1,4 +1,5 @@
 #include <audioapi/core/utils/AudioDecoder.h>
+#include <audioapi/dsp/Resampler.h>
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/libs/base64/base64.h>
 #include <audioapi/utils/AudioArray.h>
@@ -16,16 +17,53 @@
 
 namespace audioapi {
 
-// Decoding audio in fixed-size chunks because total frame count can't be
-// determined in advance. Note: ma_decoder_get_length_in_pcm_frames() always
-// returns 0 for Vorbis decoders.
-std::vector<int16_t> AudioDecoder::readAllPcmFrames(
+// Decoding audio in fixed-size chunks, straight into the output bus. The bus
+// is pre-sized when the length is known and grows otherwise. Note:
+// ma_decoder_get_length_in_pcm_frames() always returns 0 for Vorbis decoders.
+// The decoder keeps the rate of the file. When it is not sampleRate, every
+// chunk goes through dsp::Resampler on its way to the bus, so the audio is
+// never held in full at both rates.
+std::shared_ptr<AudioBus> AudioDecoder::readAllPcmFrames(
     ma_decoder &decoder,
     int numChannels,
-    ma_uint64 &outFramesRead) {
-  std::vector<int16_t> buffer;
-  std::vector<int16_t> temp(CHUNK_SIZE * numChannels);
-  outFramesRead = 0;
+    float sampleRate) {
+  ma_uint64 expectedFrames = 0;
+  ma_decoder_get_length_in_pcm_frames(&decoder, &expectedFrames);
+  auto fileSampleRate = static_cast<float>(decoder.outputSampleRate);
+
+  std::unique_ptr<dsp::Resampler> resampler;
+  std::unique_ptr<AudioBus> chunk;
+  if (fileSampleRate != sampleRate) {
+    resampler = std::make_unique<dsp::Resampler>(
+        numChannels,
+        fileSampleRate,
+        sampleRate,
+        dsp::Resampler::Quality::HIGH);
+    chunk = std::make_unique<AudioBus>(CHUNK_SIZE, numChannels, fileSampleRate);
+    expectedFrames = resampler->getMaxOutputFrames(expectedFrames);
+  }
+
+  auto audioBus = std::make_shared<AudioBus>(
+      std::max(static_cast<size_t>(expectedFrames), size_t{CHUNK_SIZE}),
+      numChannels,
+      sampleRate);
+  std::vector<float> temp(CHUNK_SIZE * numChannels);
+  std::vector<float *> channels(numChannels);
+  size_t framesRead = 0;
+
+  auto reserveFrames = [&](size_t frames) {
+    auto size = audioBus->getSize();
+    if (framesRead + frames > size) {
+      audioBus = resizeAudioBus(
+          audioBus, std::max(framesRead + frames, size + size / 2), framesRead);
+    }
+  };
+  auto deinterleaveTo = [&](AudioBus &bus, size_t start, size_t frames) {
+    for (int ch = 0; ch < numChannels; ++ch) {
+      channels[ch] = bus.getChannel(ch)->getData() + start;
+    }
+    dsp::deinterleave(temp.data(), channels.data(), numChannels, frames);
+  };
 
   while (true) {
     ma_uint64 tempFramesDecoded = 0;
@@ -35,41 +73,42 @@ std::vector<int16_t> AudioDecoder::readAllPcmFrames(
       break;
     }
 
-    buffer.insert(
-        buffer.end(),
-        temp.data(),
-        temp.data() + tempFramesDecoded * numChannels);
-    outFramesRead += tempFramesDecoded;
+    auto framesDecoded = static_cast<size_t>(tempFramesDecoded);
+    if (resampler != nullptr) {
+      deinterleaveTo(*chunk, 0, framesDecoded);
+      reserveFrames(resampler->getMaxOutputFrames(framesDecoded));
+      framesRead +=
+          resampler->process(*chunk, 0, framesDecoded, *audioBus, framesRead);
+    } else {
+      reserveFrames(framesDecoded);
+      deinterleaveTo(*audioBus, framesRead, framesDecoded);
+      framesRead += framesDecoded;
+    }
   }
 
-  return buffer;
-}
+  if (resampler != nullptr) {
+    reserveFrames(resampler->getMaxOutputFrames(0));
+    framesRead += resampler->flush(*audioBus, framesRead);
+  }
 
-std::shared_ptr<AudioBus> AudioDecoder::makeAudioBusFromInt16Buffer(
-    const std::vector<int16_t> &buffer,
-    int numChannels,
-    float sampleRate) {
-  auto outputFrames = buffer.size() / numChannels;
-  auto audioBus =
-      std::make_shared<AudioBus>(outputFrames, numChannels, sampleRate);
+  if (framesRead == 0) {
+    return nullptr;
+  }
 
-  for (int ch = 0; ch < numChannels; ++ch) {
-    auto channelData = audioBus->getChannel(ch)->getData();
-    for (int i = 0; i < outputFrames; ++i) {
-      channelData[i] = int16ToFloat(buffer[i * numChannels + ch]);
-    }
+  if (framesRead != audioBus->getSize()) {
+    audioBus = resizeAudioBus(audioBus, framesRead, framesRead);
   }
+
   return audioBus;
 }
 
 std::shared_ptr<AudioBus> AudioDecoder::decodeWithFilePath(
     const std::string &path) const {
 #ifndef AUDIO_API_TEST_SUITE
-  std::vector<int16_t> buffer;
   if (AudioDecoder::pathHasExtension(path, {".mp4", ".m4a", ".aac"})) {
-    buffer = ffmpegdecoding::decodeWithFilePath(
+    auto audioBus = ffmpegdecoding::decodeWithFilePath(
         path, numChannels_, static_cast<int>(sampleRate_));
-    if (buffer.empty()) {
+    if (audioBus == nullptr) {
       __android_log_print(
           ANDROID_LOG_ERROR,
           "AudioDecoder",
@@ -77,11 +116,11 @@ std::shared_ptr<AudioBus> AudioDecoder::decodeWithFilePath(
           path.c_str());
       return nullptr;
     }
-    return makeAudioBusFromInt16Buffer(buffer, numChannels_, sampleRate_);
+    return audioBus;
   }
   ma_decoder decoder;
-  ma_decoder_config config = ma_decoder_config_init(
-      ma_format_s16, numChannels_, static_cast<int>(sampleRate_));
+  ma_decoder_config config =
+      ma_decoder_config_init(ma_format_f32, numChannels_, 0);
   ma_decoding_backend_vtable *customBackends[] = {
       ma_decoding_backend_libvorbis, ma_decoding_backend_libopus};
 
@@ -99,16 +138,52 @@ std::shared_ptr<AudioBus> AudioDecoder::decodeWithFilePath(
     return nullptr;
   }
 
-  ma_uint64 framesRead = 0;
-  buffer = readAllPcmFrames(decoder, numChannels_, framesRead);
-  if (framesRead == 0) {
+  auto audioBus = readAllPcmFrames(decoder, numChannels_, sampleRate_);
+  ma_decoder_uninit(&decoder);
+
+  if (audioBus == nullptr) {
     __android_log_print(ANDROID_LOG_ERROR, "AudioDecoder", "Failed to decode");
-    ma_decoder_uninit(&decoder);
+  }
+
+  return audioBus;
+#else
+  return nullptr;
+#endif
+}
+
+std::unique_ptr<AudioStreamDecoder> AudioDecoder::openFileStream(
+    const std::string &path) const {
+#ifndef AUDIO_API_TEST_SUITE
+  if (AudioDecoder::pathHasExtension(path, {".mp4", ".m4a", ".aac"})) {
+    __android_log_print(
+        ANDROID_LOG_ERROR,
+        "AudioDecoder",
+        "Streaming is not supported for the format of file: %s",
+        path.c_str());
     return nullptr;
   }
+  auto decoder = std::make_unique<ma_decoder>();
+  ma_decoder_config config = ma_decoder_config_init(
+      ma_format_f32, numChannels_, static_cast<int>(sampleRate_));
+  ma_decoding_backend_vtable *customBackends[] = {
+      ma_decoding_backend_libvorbis, ma_decoding_backend_libopus};
 
-  ma_decoder_uninit(&decoder);
-  return makeAudioBusFromInt16Buffer(buffer, numChannels_, sampleRate_);
+  config.ppCustomBackendVTables = customBackends;
+  config.customBackendCount =
+      sizeof(customBackends) / sizeof(customBackends[0]);
+
+  if (ma_decoder_init_file(path.c_str(), &config, decoder.get()) !=
+      MA_SUCCESS) {
+    __android_log_print(
+        ANDROID_LOG_ERROR,
+        "AudioDecoder",
+        "Failed to initialize decoder for file: %s",
+        path.c_str());
+    ma_decoder_uninit(decoder.get());
+    return nullptr;
+  }
+
+  return std::make_unique<MiniaudioStreamDecoder>(std::move(decoder));
 #else
   return nullptr;
 #endif
@@ -118,22 +193,21 @@ std::shared_ptr<AudioBus> AudioDecoder::decodeWithMemoryBlock(
     const void *data,
     size_t size) const {
 #ifndef AUDIO_API_TEST_SUITE
-  std::vector<int16_t> buffer;
   const AudioFormat format = AudioDecoder::detectAudioFormat(data, size);
   if (format == AudioFormat::MP4 || format == AudioFormat::M4A ||
       format == AudioFormat::AAC) {
-    buffer = ffmpegdecoding::decodeWithMemoryBlock(
-        data, size, numChannels_, sampleRate_);
-    if (buffer.empty()) {
+    auto audioBus = ffmpegdecoding::decodeWithMemoryBlock(
+        data, size, numChannels_, static_cast<int>(sampleRate_));
+    if (audioBus == nullptr) {
       __android_log_print(
           ANDROID_LOG_ERROR, "AudioDecoder", "Failed to decode with FFmpeg");
       return nullptr;
     }
-    return makeAudioBusFromInt16Buffer(buffer, numChannels_, sampleRate_);
+    return audioBus;
   }
   ma_decoder decoder;
-  ma_decoder_config config = ma_decoder_config_init(
-      ma_format_s16, numChannels_, static_cast<int>(sampleRate_));
+  ma_decoder_config config =
+      ma_decoder_config_init(ma_format_f32, numChannels_, 0);
 
   ma_decoding_backend_vtable *customBackends[] = {
       ma_decoding_backend_libvorbis, ma_decoding_backend_libopus};
@@ -151,16 +225,14 @@ std::shared_ptr<AudioBus> AudioDecoder::decodeWithMemoryBlock(
     return nullptr;
   }
 
-  ma_uint64 framesRead = 0;
-  buffer = readAllPcmFrames(decoder, numChannels_, framesRead);
-  if (framesRead == 0) {
+  auto audioBus = readAllPcmFrames(decoder, numChannels_, sampleRate_);
+  ma_decoder_uninit(&decoder);
+
+  if (audioBus == nullptr) {
     __android_log_print(ANDROID_LOG_ERROR, "AudioDecoder", "Failed to decode");
-    ma_decoder_uninit(&decoder);
-    return nullptr;
   }
 
-  ma_decoder_uninit(&decoder);
-  return makeAudioBusFromInt16Buffer(buffer, numChannels_, sampleRate_);
+  return audioBus;
 #else
   return nullptr;
 #endif
@@ -71,6 +71,14 @@ class AudioAPIModuleInstaller {
           std::shared_ptr<AudioContext> audioContext;
           auto sampleRate = static_cast<float>(args[0].getNumber());
           auto initSuspended = args[1].getBool();
+          // 0 lets the context pick the number of decoding threads
+          auto decodeWorkerCount = count > 3 && args[3].isNumber()
+              ? static_cast<size_t>(args[3].getNumber())
+              : 0;
+          // negative lets the context pick the number of render threads, 0 turns them off
+          auto renderWorkerCount = count > 4 && args[4].isNumber()
+              ? static_cast<int>(args[4].getNumber())
+              : -1;
 
           #if RN_AUDIO_API_ENABLE_WORKLETS
               auto runtimeRegistry = RuntimeRegistry{
@@ -82,9 +90,9 @@ class AudioAPIModuleInstaller {
           #endif
 
           try {
-            audioContext = std::make_shared<AudioContext>(sampleRate, initSuspended, audioEventHandlerRegistry, runtimeRegistry);
+            audioContext = std::make_shared<AudioContext>(sampleRate, initSuspended, audioEventHandlerRegistry, runtimeRegistry, renderWorkerCount);
             auto audioContextHostObject = std::make_shared<AudioContextHostObject>(
-                audioContext, &runtime, jsCallInvoker);
+                audioContext, &runtime, jsCallInvoker, decodeWorkerCount);
 
             return jsi::Object::createFromHostObject(
                 runtime, audioContextHostObject);
@@ -128,6 +136,10 @@ class AudioAPIModuleInstaller {
             auto numberOfChannels = static_cast<int>(args[0].getNumber());
             auto length = static_cast<size_t>(args[1].getNumber());
             auto sampleRate = static_cast<float>(args[2].getNumber());
+            // 0 lets the context pick the number of decoding threads
+            auto decodeWorkerCount = count > 4 && args[4].isNumber()
+                ? static_cast<size_t>(args[4].getNumber())
+                : 0;
 
             #if RN_AUDIO_API_ENABLE_WORKLETS
                 auto runtimeRegistry = RuntimeRegistry{
@@ -141,7 +153,7 @@ class AudioAPIModuleInstaller {
             try {
               auto offlineAudioContext = std::make_shared<OfflineAudioContext>(numberOfChannels, length, sampleRate, audioEventHandlerRegistry, runtimeRegistry);
               auto audioContextHostObject = std::make_shared<OfflineAudioContextHostObject>(
-                  offlineAudioContext, &runtime, jsCallInvoker);
+                  offlineAudioContext, &runtime, jsCallInvoker, decodeWorkerCount);
 
               return jsi::Object::createFromHostObject(
                   runtime, audioContextHostObject);
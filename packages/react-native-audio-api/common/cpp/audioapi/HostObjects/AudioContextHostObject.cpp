@@ -7,8 +7,13 @@ namespace audioapi {
 AudioContextHostObject::AudioContextHostObject(
     const std::shared_ptr<AudioContext> &audioContext,
     jsi::Runtime *runtime,
-    const std::shared_ptr<react::CallInvoker> &callInvoker)
-    : BaseAudioContextHostObject(audioContext, runtime, callInvoker) {
+    const std::shared_ptr<react::CallInvoker> &callInvoker,
+    size_t decodeWorkerCount)
+    : BaseAudioContextHostObject(
+          audioContext,
+          runtime,
+          callInvoker,
+          decodeWorkerCount) {
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioContextHostObject, close),
       JSI_EXPORT_FUNCTION(AudioContextHostObject, resume),
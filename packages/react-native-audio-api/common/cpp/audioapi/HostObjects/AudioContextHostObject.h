@@ -17,7 +17,8 @@ class AudioContextHostObject : public BaseAudioContextHostObject {
   explicit AudioContextHostObject(
       const std::shared_ptr<AudioContext> &audioContext,
       jsi::Runtime *runtime,
-      const std::shared_ptr<react::CallInvoker> &callInvoker);
+      const std::shared_ptr<react::CallInvoker> &callInvoker,
+      size_t decodeWorkerCount);
 
   JSI_HOST_FUNCTION_DECL(close);
   JSI_HOST_FUNCTION_DECL(resume);
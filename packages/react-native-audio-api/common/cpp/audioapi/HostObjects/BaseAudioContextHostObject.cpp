@@ -3,9 +3,13 @@
 #include <audioapi/HostObjects/WorkletNodeHostObject.h>
 #include <audioapi/HostObjects/WorkletProcessingNodeHostObject.h>
 #include <audioapi/HostObjects/analysis/AnalyserNodeHostObject.h>
+#include <audioapi/HostObjects/analysis/AudioMeterNodeHostObject.h>
 #include <audioapi/HostObjects/destinations/AudioDestinationNodeHostObject.h>
 #include <audioapi/HostObjects/effects/BiquadFilterNodeHostObject.h>
+#include <audioapi/HostObjects/effects/ConvolverNodeHostObject.h>
+#include <audioapi/HostObjects/effects/DelayNodeHostObject.h>
 #include <audioapi/HostObjects/effects/GainNodeHostObject.h>
+#include <audioapi/HostObjects/effects/ParametricEQNodeHostObject.h>
 #include <audioapi/HostObjects/effects/PeriodicWaveHostObject.h>
 #include <audioapi/HostObjects/effects/StereoPannerNodeHostObject.h>
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
@@ -15,18 +19,39 @@
 #include <audioapi/HostObjects/sources/OscillatorNodeHostObject.h>
 #include <audioapi/HostObjects/sources/RecorderAdapterNodeHostObject.h>
 #include <audioapi/HostObjects/sources/StreamerNodeHostObject.h>
+#include <audioapi/HostObjects/sources/StreamingAudioBufferHostObject.h>
+#include <audioapi/HostObjects/sources/StreamingBufferSourceNodeHostObject.h>
 #include <audioapi/HostObjects/sources/WorkletSourceNodeHostObject.h>
 #include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/sources/StreamingAudioBuffer.h>
+#include <audioapi/core/sources/StreamingBufferSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 namespace audioapi {
 
 BaseAudioContextHostObject::BaseAudioContextHostObject(
     const std::shared_ptr<BaseAudioContext> &context,
     jsi::Runtime *runtime,
-    const std::shared_ptr<react::CallInvoker> &callInvoker)
+    const std::shared_ptr<react::CallInvoker> &callInvoker,
+    size_t decodeWorkerCount)
     : context_(context), callInvoker_(callInvoker) {
   promiseVendor_ = std::make_shared<PromiseVendor>(runtime, callInvoker);
 
+  // by default one core is left for the audio thread
+  if (decodeWorkerCount == 0) {
+    auto hardwareConcurrency =
+        static_cast<size_t>(std::thread::hardware_concurrency());
+    decodeWorkerCount = std::clamp(
+        hardwareConcurrency > 1 ? hardwareConcurrency - 1 : 1,
+        static_cast<size_t>(1),
+        DECODE_EXECUTOR_DEFAULT_MAX_THREAD_COUNT);
+  }
+  decodeExecutor_ = std::make_shared<DecodeExecutor>(decodeWorkerCount);
+
   addGetters(
       JSI_EXPORT_PROPERTY_GETTER(BaseAudioContextHostObject, destination),
       JSI_EXPORT_PROPERTY_GETTER(BaseAudioContextHostObject, state),
@@ -45,15 +70,25 @@ BaseAudioContextHostObject::BaseAudioContextHostObject(
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createGain),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createStereoPanner),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBiquadFilter),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createParametricEQ),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createConvolver),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createDelay),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBufferSource),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBufferQueueSource),
+      JSI_EXPORT_FUNCTION(
+          BaseAudioContextHostObject, createStreamingBufferSource),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createBuffer),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createPeriodicWave),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createAnalyser),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, createAudioMeter),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, decodeAudioData),
       JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, decodeAudioDataSource),
       JSI_EXPORT_FUNCTION(
-          BaseAudioContextHostObject, decodePCMAudioDataInBase64));
+          BaseAudioContextHostObject, decodePCMAudioDataInBase64),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, streamAudioDataSource),
+      JSI_EXPORT_FUNCTION(BaseAudioContextHostObject, cancelDecoding),
+      JSI_EXPORT_FUNCTION(
+          BaseAudioContextHostObject, setDecodedAudioCacheDirectory));
 }
 
 JSI_PROPERTY_GETTER_IMPL(BaseAudioContextHostObject, destination) {
@@ -198,6 +233,28 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBiquadFilter) {
   return jsi::Object::createFromHostObject(runtime, biquadFilterHostObject);
 }
 
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createParametricEQ) {
+  auto numberOfBands = static_cast<int>(args[0].getNumber());
+  auto parametricEQ = context_->createParametricEQ(numberOfBands);
+  auto parametricEQHostObject =
+      std::make_shared<ParametricEQNodeHostObject>(parametricEQ);
+  return jsi::Object::createFromHostObject(runtime, parametricEQHostObject);
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createConvolver) {
+  auto convolver = context_->createConvolver();
+  auto convolverHostObject =
+      std::make_shared<ConvolverNodeHostObject>(convolver);
+  return jsi::Object::createFromHostObject(runtime, convolverHostObject);
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createDelay) {
+  auto maxDelayTime = static_cast<float>(args[0].getNumber());
+  auto delay = context_->createDelay(maxDelayTime);
+  auto delayHostObject = std::make_shared<DelayNodeHostObject>(delay);
+  return jsi::Object::createFromHostObject(runtime, delayHostObject);
+}
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBufferSource) {
   auto pitchCorrection = args[0].asBool();
   auto bufferSource = context_->createBufferSource(pitchCorrection);
@@ -215,6 +272,16 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBufferQueueSource) {
       runtime, bufferStreamSourceHostObject);
 }
 
+JSI_HOST_FUNCTION_IMPL(
+    BaseAudioContextHostObject,
+    createStreamingBufferSource) {
+  auto pitchCorrection = args[0].asBool();
+  auto bufferSource = context_->createStreamingBufferSource(pitchCorrection);
+  auto bufferSourceHostObject =
+      std::make_shared<StreamingBufferSourceNodeHostObject>(bufferSource);
+  return jsi::Object::createFromHostObject(runtime, bufferSourceHostObject);
+}
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createBuffer) {
   auto numberOfChannels = static_cast<int>(args[0].getNumber());
   auto length = static_cast<size_t>(args[1].getNumber());
@@ -267,34 +334,35 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createAnalyser) {
   return jsi::Object::createFromHostObject(runtime, analyserHostObject);
 }
 
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, createAudioMeter) {
+  auto numberOfBands = static_cast<int>(args[0].getNumber());
+  auto audioMeter = context_->createAudioMeter(numberOfBands);
+  auto audioMeterHostObject =
+      std::make_shared<AudioMeterNodeHostObject>(audioMeter);
+  return jsi::Object::createFromHostObject(runtime, audioMeterHostObject);
+}
+
+namespace {
+
+DecodeExecutor::Priority getDecodePriority(
+    jsi::Runtime &runtime,
+    const jsi::Value &priority) {
+  return priority.getString(runtime).utf8(runtime) == "prefetch"
+      ? DecodeExecutor::Priority::LOW
+      : DecodeExecutor::Priority::HIGH;
+}
+
+} // namespace
+
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, decodeAudioDataSource) {
   auto sourcePath = args[0].getString(runtime).utf8(runtime);
+  auto requestId = static_cast<uint64_t>(args[1].getNumber());
+  auto priority = getDecodePriority(runtime, args[2]);
 
-  auto promise = promiseVendor_->createPromise(
-      [this, sourcePath](std::shared_ptr<Promise> promise) {
-        std::thread([this, sourcePath, promise = std::move(promise)]() {
-          auto results = context_->decodeAudioDataSource(sourcePath);
-
-          if (!results) {
-            promise->reject("Failed to decode audio data source.");
-            return;
-          }
-
-          auto audioBufferHostObject =
-              std::make_shared<AudioBufferHostObject>(results);
-
-          promise->resolve([audioBufferHostObject = std::move(
-                                audioBufferHostObject)](jsi::Runtime &runtime) {
-            auto jsiObject = jsi::Object::createFromHostObject(
-                runtime, audioBufferHostObject);
-            jsiObject.setExternalMemoryPressure(
-                runtime, audioBufferHostObject->getSizeInBytes());
-            return jsiObject;
-          });
-        }).detach();
+  return scheduleDecoding<AudioBufferHostObject, AudioBuffer>(
+      requestId, priority, [this, sourcePath]() {
+        return context_->decodeAudioDataSource(sourcePath);
       });
-
-  return promise;
 }
 
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, decodeAudioData) {
@@ -302,64 +370,89 @@ JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, decodeAudioData) {
                          .getObject(runtime)
                          .getPropertyAsObject(runtime, "buffer")
                          .getArrayBuffer(runtime);
-  auto data = arrayBuffer.data(runtime);
-  auto size = static_cast<int>(arrayBuffer.size(runtime));
-
-  auto promise = promiseVendor_->createPromise(
-      [this, data, size](std::shared_ptr<Promise> promise) {
-        std::thread([this, data, size, promise = std::move(promise)]() {
-          auto results = context_->decodeAudioData(data, size);
-
-          if (!results) {
-            promise->reject("Failed to decode audio data source.");
-            return;
-          }
-
-          auto audioBufferHostObject =
-              std::make_shared<AudioBufferHostObject>(results);
-
-          promise->resolve([audioBufferHostObject = std::move(
-                                audioBufferHostObject)](jsi::Runtime &runtime) {
-            auto jsiObject = jsi::Object::createFromHostObject(
-                runtime, audioBufferHostObject);
-            jsiObject.setExternalMemoryPressure(
-                runtime, audioBufferHostObject->getSizeInBytes());
-            return jsiObject;
-          });
-        }).detach();
+  auto requestId = static_cast<uint64_t>(args[1].getNumber());
+  auto priority = getDecodePriority(runtime, args[2]);
+
+  // The decoding may wait in the queue, so the data is copied rather than
+  // referenced, the array buffer can be collected in the meantime.
+  auto *bytes = arrayBuffer.data(runtime);
+  auto data = std::make_shared<std::vector<uint8_t>>(
+      bytes, bytes + arrayBuffer.size(runtime));
+
+  return scheduleDecoding<AudioBufferHostObject, AudioBuffer>(
+      requestId, priority, [this, data]() {
+        return context_->decodeAudioData(data->data(), data->size());
       });
-
-  return promise;
 }
 
 JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, decodePCMAudioDataInBase64) {
   auto b64 = args[0].getString(runtime).utf8(runtime);
   auto playbackSpeed = static_cast<float>(args[1].getNumber());
+  auto requestId = static_cast<uint64_t>(args[2].getNumber());
+  auto priority = getDecodePriority(runtime, args[3]);
+
+  return scheduleDecoding<AudioBufferHostObject, AudioBuffer>(
+      requestId, priority, [this, b64, playbackSpeed]() {
+        return context_->decodeWithPCMInBase64(b64, playbackSpeed);
+      });
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, streamAudioDataSource) {
+  auto sourcePath = args[0].getString(runtime).utf8(runtime);
+  auto requestId = static_cast<uint64_t>(args[1].getNumber());
+  auto priority = getDecodePriority(runtime, args[2]);
 
-  auto promise = promiseVendor_->createPromise(
-      [this, b64, playbackSpeed](std::shared_ptr<Promise> promise) {
-        std::thread([this, b64, playbackSpeed, promise = std::move(promise)]() {
-          auto results = context_->decodeWithPCMInBase64(b64, playbackSpeed);
-
-          if (!results) {
-            promise->reject("Failed to decode audio data source.");
-            return;
-          }
-
-          auto audioBufferHostObject =
-              std::make_shared<AudioBufferHostObject>(results);
-
-          promise->resolve([audioBufferHostObject = std::move(
-                                audioBufferHostObject)](jsi::Runtime &runtime) {
-            auto jsiObject = jsi::Object::createFromHostObject(
-                runtime, audioBufferHostObject);
-            jsiObject.setExternalMemoryPressure(
-                runtime, audioBufferHostObject->getSizeInBytes());
-            return jsiObject;
-          });
-        }).detach();
+  return scheduleDecoding<StreamingAudioBufferHostObject, StreamingAudioBuffer>(
+      requestId, priority, [this, sourcePath]() {
+        return context_->streamAudioDataSource(sourcePath);
       });
+}
+
+JSI_HOST_FUNCTION_IMPL(BaseAudioContextHostObject, cancelDecoding) {
+  auto requestId = static_cast<uint64_t>(args[0].getNumber());
+  return {decodeExecutor_->cancel(requestId)};
+}
+
+JSI_HOST_FUNCTION_IMPL(
+    BaseAudioContextHostObject,
+    setDecodedAudioCacheDirectory) {
+  auto directory = args[0].getString(runtime).utf8(runtime);
+  context_->setDecodedAudioCacheDirectory(directory);
+  return jsi::Value::undefined();
+}
 
-  return promise;
+template <typename HostObject, typename Result>
+jsi::Value BaseAudioContextHostObject::scheduleDecoding(
+    uint64_t requestId,
+    DecodeExecutor::Priority priority,
+    std::function<std::shared_ptr<Result>()> &&decode) {
+  return promiseVendor_->createPromise(
+      [this, requestId, priority, decode = std::move(decode)](
+          const std::shared_ptr<Promise> &promise) {
+        decodeExecutor_->schedule(
+            requestId,
+            priority,
+            [decode, promise]() {
+              auto results = decode();
+
+              if (!results) {
+                promise->reject("Failed to decode audio data source.");
+                return;
+              }
+
+              auto hostObject = std::make_shared<HostObject>(results);
+
+              promise->resolve(
+                  [hostObject = std::move(hostObject)](jsi::Runtime &runtime) {
+                    auto jsiObject =
+                        jsi::Object::createFromHostObject(runtime, hostObject);
+                    jsiObject.setExternalMemoryPressure(
+                        runtime, hostObject->getSizeInBytes());
+                    return jsiObject;
+                  });
+            },
+            [promise]() { promise->reject("Decoding was aborted."); });
+      });
 }
+
 } // namespace audioapi
@@ -2,8 +2,11 @@
 
 #include <audioapi/jsi/JsiHostObject.h>
 #include <audioapi/jsi/JsiPromise.h>
+#include <audioapi/utils/DecodeExecutor.hpp>
 
 #include <jsi/jsi.h>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -19,7 +22,8 @@ class BaseAudioContextHostObject : public JsiHostObject {
   explicit BaseAudioContextHostObject(
       const std::shared_ptr<BaseAudioContext> &context,
       jsi::Runtime *runtime,
-      const std::shared_ptr<react::CallInvoker> &callInvoker);
+      const std::shared_ptr<react::CallInvoker> &callInvoker,
+      size_t decodeWorkerCount);
 
   JSI_PROPERTY_GETTER_DECL(destination);
   JSI_PROPERTY_GETTER_DECL(state);
@@ -36,19 +40,38 @@ class BaseAudioContextHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(createGain);
   JSI_HOST_FUNCTION_DECL(createStereoPanner);
   JSI_HOST_FUNCTION_DECL(createBiquadFilter);
+  JSI_HOST_FUNCTION_DECL(createParametricEQ);
+  JSI_HOST_FUNCTION_DECL(createConvolver);
+  JSI_HOST_FUNCTION_DECL(createDelay);
   JSI_HOST_FUNCTION_DECL(createBufferSource);
   JSI_HOST_FUNCTION_DECL(createBufferQueueSource);
+  JSI_HOST_FUNCTION_DECL(createStreamingBufferSource);
   JSI_HOST_FUNCTION_DECL(createBuffer);
   JSI_HOST_FUNCTION_DECL(createPeriodicWave);
   JSI_HOST_FUNCTION_DECL(createAnalyser);
+  JSI_HOST_FUNCTION_DECL(createAudioMeter);
   JSI_HOST_FUNCTION_DECL(decodeAudioDataSource);
   JSI_HOST_FUNCTION_DECL(decodeAudioData);
   JSI_HOST_FUNCTION_DECL(decodePCMAudioDataInBase64);
+  JSI_HOST_FUNCTION_DECL(streamAudioDataSource);
+  JSI_HOST_FUNCTION_DECL(cancelDecoding);
+  JSI_HOST_FUNCTION_DECL(setDecodedAudioCacheDirectory);
 
   std::shared_ptr<BaseAudioContext> context_;
 
  protected:
   std::shared_ptr<PromiseVendor> promiseVendor_;
   std::shared_ptr<react::CallInvoker> callInvoker_;
+  // Destroyed first, pending decodings are rejected while the rest is alive.
+  std::shared_ptr<DecodeExecutor> decodeExecutor_;
+
+ private:
+  // Resolves with the result wrapped in HostObject, or rejects when the result
+  // is nullptr.
+  template <typename HostObject, typename Result>
+  jsi::Value scheduleDecoding(
+      uint64_t requestId,
+      DecodeExecutor::Priority priority,
+      std::function<std::shared_ptr<Result>()> &&decode);
 };
 } // namespace audioapi
@@ -8,8 +8,13 @@ namespace audioapi {
 OfflineAudioContextHostObject::OfflineAudioContextHostObject(
     const std::shared_ptr<OfflineAudioContext> &offlineAudioContext,
     jsi::Runtime *runtime,
-    const std::shared_ptr<react::CallInvoker> &callInvoker)
-    : BaseAudioContextHostObject(offlineAudioContext, runtime, callInvoker) {
+    const std::shared_ptr<react::CallInvoker> &callInvoker,
+    size_t decodeWorkerCount)
+    : BaseAudioContextHostObject(
+          offlineAudioContext,
+          runtime,
+          callInvoker,
+          decodeWorkerCount) {
   addFunctions(
       JSI_EXPORT_FUNCTION(OfflineAudioContextHostObject, resume),
       JSI_EXPORT_FUNCTION(OfflineAudioContextHostObject, suspend),
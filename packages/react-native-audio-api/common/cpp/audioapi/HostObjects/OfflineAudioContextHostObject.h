@@ -17,7 +17,8 @@ class OfflineAudioContextHostObject : public BaseAudioContextHostObject {
   explicit OfflineAudioContextHostObject(
           const std::shared_ptr<OfflineAudioContext> &offlineAudioContext,
           jsi::Runtime *runtime,
-          const std::shared_ptr<react::CallInvoker> &callInvoker);
+          const std::shared_ptr<react::CallInvoker> &callInvoker,
+          size_t decodeWorkerCount);
 
   JSI_HOST_FUNCTION_DECL(resume);
   JSI_HOST_FUNCTION_DECL(suspend);
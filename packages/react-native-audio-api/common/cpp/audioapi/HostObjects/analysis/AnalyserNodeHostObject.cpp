@@ -13,14 +13,16 @@ AnalyserNodeHostObject::AnalyserNodeHostObject(
       JSI_EXPORT_PROPERTY_GETTER(AnalyserNodeHostObject, minDecibels),
       JSI_EXPORT_PROPERTY_GETTER(AnalyserNodeHostObject, maxDecibels),
       JSI_EXPORT_PROPERTY_GETTER(AnalyserNodeHostObject, smoothingTimeConstant),
-      JSI_EXPORT_PROPERTY_GETTER(AnalyserNodeHostObject, window));
+      JSI_EXPORT_PROPERTY_GETTER(AnalyserNodeHostObject, window),
+      JSI_EXPORT_PROPERTY_GETTER(AnalyserNodeHostObject, analysisInterval));
 
   addSetters(
       JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, fftSize),
       JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, minDecibels),
       JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, maxDecibels),
       JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, smoothingTimeConstant),
-      JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, window));
+      JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, window),
+      JSI_EXPORT_PROPERTY_SETTER(AnalyserNodeHostObject, analysisInterval));
 
   addFunctions(
       JSI_EXPORT_FUNCTION(AnalyserNodeHostObject, getFloatFrequencyData),
@@ -60,6 +62,11 @@ JSI_PROPERTY_GETTER_IMPL(AnalyserNodeHostObject, window) {
   return jsi::String::createFromUtf8(runtime, windowType);
 }
 
+JSI_PROPERTY_GETTER_IMPL(AnalyserNodeHostObject, analysisInterval) {
+  auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
+  return {analyserNode->getAnalysisInterval()};
+}
+
 JSI_PROPERTY_SETTER_IMPL(AnalyserNodeHostObject, fftSize) {
   auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
   auto fftSize = static_cast<int>(value.getNumber());
@@ -89,13 +96,16 @@ JSI_PROPERTY_SETTER_IMPL(AnalyserNodeHostObject, window) {
   analyserNode->setWindowType(value.getString(runtime).utf8(runtime));
 }
 
+JSI_PROPERTY_SETTER_IMPL(AnalyserNodeHostObject, analysisInterval) {
+  auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
+  auto analysisInterval = static_cast<int>(value.getNumber());
+  analyserNode->setAnalysisInterval(analysisInterval);
+}
+
 JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getFloatFrequencyData) {
-  auto arrayBuffer = args[0]
-                         .getObject(runtime)
-                         .getPropertyAsObject(runtime, "buffer")
-                         .getArrayBuffer(runtime);
-  auto data = reinterpret_cast<float *>(arrayBuffer.data(runtime));
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto view = floatFrequencyDataBinding_.bind(runtime, args[0]);
+  auto data = reinterpret_cast<float *>(view.data);
+  auto length = static_cast<int>(view.byteLength / sizeof(float));
 
   auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
   analyserNode->getFloatFrequencyData(data, length);
@@ -104,12 +114,9 @@ JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getFloatFrequencyData) {
 }
 
 JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getByteFrequencyData) {
-  auto arrayBuffer = args[0]
-                         .getObject(runtime)
-                         .getPropertyAsObject(runtime, "buffer")
-                         .getArrayBuffer(runtime);
-  auto data = arrayBuffer.data(runtime);
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto view = byteFrequencyDataBinding_.bind(runtime, args[0]);
+  auto data = view.data;
+  auto length = static_cast<int>(view.byteLength);
 
   auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
   analyserNode->getByteFrequencyData(data, length);
@@ -118,12 +125,9 @@ JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getByteFrequencyData) {
 }
 
 JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getFloatTimeDomainData) {
-  auto arrayBuffer = args[0]
-                         .getObject(runtime)
-                         .getPropertyAsObject(runtime, "buffer")
-                         .getArrayBuffer(runtime);
-  auto data = reinterpret_cast<float *>(arrayBuffer.data(runtime));
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto view = floatTimeDomainDataBinding_.bind(runtime, args[0]);
+  auto data = reinterpret_cast<float *>(view.data);
+  auto length = static_cast<int>(view.byteLength / sizeof(float));
 
   auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
   analyserNode->getFloatTimeDomainData(data, length);
@@ -132,12 +136,9 @@ JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getFloatTimeDomainData) {
 }
 
 JSI_HOST_FUNCTION_IMPL(AnalyserNodeHostObject, getByteTimeDomainData) {
-  auto arrayBuffer = args[0]
-                         .getObject(runtime)
-                         .getPropertyAsObject(runtime, "buffer")
-                         .getArrayBuffer(runtime);
-  auto data = arrayBuffer.data(runtime);
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto view = byteTimeDomainDataBinding_.bind(runtime, args[0]);
+  auto data = view.data;
+  auto length = static_cast<int>(view.byteLength);
 
   auto analyserNode = std::static_pointer_cast<AnalyserNode>(node_);
   analyserNode->getByteTimeDomainData(data, length);
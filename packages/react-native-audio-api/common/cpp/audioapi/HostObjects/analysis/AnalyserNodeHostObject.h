@@ -1,6 +1,7 @@
 #pragma once
 
 #include <audioapi/HostObjects/AudioNodeHostObject.h>
+#include <audioapi/jsi/TypedArrayBinding.h>
 
 #include <memory>
 #include <string>
@@ -21,17 +22,27 @@ class AnalyserNodeHostObject : public AudioNodeHostObject {
   JSI_PROPERTY_GETTER_DECL(maxDecibels);
   JSI_PROPERTY_GETTER_DECL(smoothingTimeConstant);
   JSI_PROPERTY_GETTER_DECL(window);
+  JSI_PROPERTY_GETTER_DECL(analysisInterval);
 
   JSI_PROPERTY_SETTER_DECL(fftSize);
   JSI_PROPERTY_SETTER_DECL(minDecibels);
   JSI_PROPERTY_SETTER_DECL(maxDecibels);
   JSI_PROPERTY_SETTER_DECL(smoothingTimeConstant);
   JSI_PROPERTY_SETTER_DECL(window);
+  JSI_PROPERTY_SETTER_DECL(analysisInterval);
 
   JSI_HOST_FUNCTION_DECL(getFloatFrequencyData);
   JSI_HOST_FUNCTION_DECL(getByteFrequencyData);
   JSI_HOST_FUNCTION_DECL(getFloatTimeDomainData);
   JSI_HOST_FUNCTION_DECL(getByteTimeDomainData);
+
+ private:
+  // the arrays passed by the last calls, visualisations pass the same ones
+  // every frame
+  TypedArrayBinding floatFrequencyDataBinding_;
+  TypedArrayBinding byteFrequencyDataBinding_;
+  TypedArrayBinding floatTimeDomainDataBinding_;
+  TypedArrayBinding byteTimeDomainDataBinding_;
 };
 
 } // namespace audioapi
@@ -0,0 +1,81 @@
+#include <audioapi/HostObjects/analysis/AudioMeterNodeHostObject.h>
+
+#include <audioapi/core/analysis/AudioMeterNode.h>
+
+namespace audioapi {
+
+namespace {
+
+template <size_t N>
+jsi::Array createArray(
+    jsi::Runtime &runtime,
+    const std::array<float, N> &values,
+    int length) {
+  auto array = jsi::Array(runtime, length);
+  for (int i = 0; i < length; i++) {
+    array.setValueAtIndex(runtime, i, jsi::Value(values[i]));
+  }
+  return array;
+}
+
+} // namespace
+
+AudioMeterNodeHostObject::AudioMeterNodeHostObject(
+    const std::shared_ptr<AudioMeterNode> &node)
+    : AudioNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(AudioMeterNodeHostObject, numberOfBands),
+      JSI_EXPORT_PROPERTY_GETTER(AudioMeterNodeHostObject, bandFrequencies));
+
+  addFunctions(
+      JSI_EXPORT_FUNCTION(AudioMeterNodeHostObject, getMeasurements));
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioMeterNodeHostObject, numberOfBands) {
+  auto audioMeterNode = std::static_pointer_cast<AudioMeterNode>(node_);
+  return {audioMeterNode->getNumberOfBands()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioMeterNodeHostObject, bandFrequencies) {
+  auto audioMeterNode = std::static_pointer_cast<AudioMeterNode>(node_);
+  auto numberOfBands = audioMeterNode->getNumberOfBands();
+
+  auto bandFrequencies = jsi::Array(runtime, numberOfBands);
+  for (int i = 0; i < numberOfBands; i++) {
+    bandFrequencies.setValueAtIndex(
+        runtime, i, jsi::Value(audioMeterNode->getBandFrequency(i)));
+  }
+  return bandFrequencies;
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioMeterNodeHostObject, getMeasurements) {
+  auto audioMeterNode = std::static_pointer_cast<AudioMeterNode>(node_);
+  const auto &measurements = audioMeterNode->getMeasurements();
+  auto numberOfChannels = measurements.numberOfChannels;
+
+  auto result = jsi::Object(runtime);
+  result.setProperty(
+      runtime, "rms", createArray(runtime, measurements.rms, numberOfChannels));
+  result.setProperty(
+      runtime,
+      "peak",
+      createArray(runtime, measurements.peak, numberOfChannels));
+  result.setProperty(
+      runtime,
+      "truePeak",
+      createArray(runtime, measurements.truePeak, numberOfChannels));
+  result.setProperty(
+      runtime, "momentaryLoudness", measurements.momentaryLoudness);
+  result.setProperty(
+      runtime, "shortTermLoudness", measurements.shortTermLoudness);
+  result.setProperty(
+      runtime,
+      "bandEnergies",
+      createArray(
+          runtime,
+          measurements.bandEnergies,
+          audioMeterNode->getNumberOfBands()));
+  return result;
+}
+
+} // namespace audioapi
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <audioapi/HostObjects/AudioNodeHostObject.h>
+
+#include <memory>
+
+namespace audioapi {
+using namespace facebook;
+
+class AudioMeterNode;
+
+class AudioMeterNodeHostObject : public AudioNodeHostObject {
+ public:
+  explicit AudioMeterNodeHostObject(const std::shared_ptr<AudioMeterNode> &node);
+
+  JSI_PROPERTY_GETTER_DECL(numberOfBands);
+  JSI_PROPERTY_GETTER_DECL(bandFrequencies);
+
+  JSI_HOST_FUNCTION_DECL(getMeasurements);
+};
+
+} // namespace audioapi
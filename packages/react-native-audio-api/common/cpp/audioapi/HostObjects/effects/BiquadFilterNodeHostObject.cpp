@@ -13,9 +13,14 @@ BiquadFilterNodeHostObject::BiquadFilterNodeHostObject(
       JSI_EXPORT_PROPERTY_GETTER(BiquadFilterNodeHostObject, detune),
       JSI_EXPORT_PROPERTY_GETTER(BiquadFilterNodeHostObject, Q),
       JSI_EXPORT_PROPERTY_GETTER(BiquadFilterNodeHostObject, gain),
-      JSI_EXPORT_PROPERTY_GETTER(BiquadFilterNodeHostObject, type));
+      JSI_EXPORT_PROPERTY_GETTER(BiquadFilterNodeHostObject, type),
+      JSI_EXPORT_PROPERTY_GETTER(
+          BiquadFilterNodeHostObject, automationSubBlockSize));
 
-  addSetters(JSI_EXPORT_PROPERTY_SETTER(BiquadFilterNodeHostObject, type));
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(BiquadFilterNodeHostObject, type),
+      JSI_EXPORT_PROPERTY_SETTER(
+          BiquadFilterNodeHostObject, automationSubBlockSize));
 
   addFunctions(
       JSI_EXPORT_FUNCTION(BiquadFilterNodeHostObject, getFrequencyResponse));
@@ -55,11 +60,22 @@ JSI_PROPERTY_GETTER_IMPL(BiquadFilterNodeHostObject, type) {
   return jsi::String::createFromUtf8(runtime, type);
 }
 
+JSI_PROPERTY_GETTER_IMPL(BiquadFilterNodeHostObject, automationSubBlockSize) {
+  auto biquadFilterNode = std::static_pointer_cast<BiquadFilterNode>(node_);
+  return {biquadFilterNode->getAutomationSubBlockSize()};
+}
+
 JSI_PROPERTY_SETTER_IMPL(BiquadFilterNodeHostObject, type) {
   auto biquadFilterNode = std::static_pointer_cast<BiquadFilterNode>(node_);
   biquadFilterNode->setType(value.getString(runtime).utf8(runtime));
 }
 
+JSI_PROPERTY_SETTER_IMPL(BiquadFilterNodeHostObject, automationSubBlockSize) {
+  auto biquadFilterNode = std::static_pointer_cast<BiquadFilterNode>(node_);
+  biquadFilterNode->setAutomationSubBlockSize(
+      static_cast<int>(value.getNumber()));
+}
+
 JSI_HOST_FUNCTION_IMPL(BiquadFilterNodeHostObject, getFrequencyResponse) {
   auto arrayBufferFrequency = args[0]
                                   .getObject(runtime)
@@ -21,8 +21,10 @@ class BiquadFilterNodeHostObject : public AudioNodeHostObject {
   JSI_PROPERTY_GETTER_DECL(Q);
   JSI_PROPERTY_GETTER_DECL(gain);
   JSI_PROPERTY_GETTER_DECL(type);
+  JSI_PROPERTY_GETTER_DECL(automationSubBlockSize);
 
   JSI_PROPERTY_SETTER_DECL(type);
+  JSI_PROPERTY_SETTER_DECL(automationSubBlockSize);
 
   JSI_HOST_FUNCTION_DECL(getFrequencyResponse);
 };
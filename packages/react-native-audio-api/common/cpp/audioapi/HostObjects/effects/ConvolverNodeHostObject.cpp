@@ -0,0 +1,60 @@
+#include <audioapi/HostObjects/effects/ConvolverNodeHostObject.h>
+
+#include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
+#include <audioapi/core/effects/ConvolverNode.h>
+
+namespace audioapi {
+
+ConvolverNodeHostObject::ConvolverNodeHostObject(
+    const std::shared_ptr<ConvolverNode> &node)
+    : AudioNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(ConvolverNodeHostObject, buffer),
+      JSI_EXPORT_PROPERTY_GETTER(ConvolverNodeHostObject, normalize));
+
+  addSetters(JSI_EXPORT_PROPERTY_SETTER(ConvolverNodeHostObject, normalize));
+
+  addFunctions(JSI_EXPORT_FUNCTION(ConvolverNodeHostObject, setBuffer));
+}
+
+JSI_PROPERTY_GETTER_IMPL(ConvolverNodeHostObject, buffer) {
+  auto convolverNode = std::static_pointer_cast<ConvolverNode>(node_);
+  auto buffer = convolverNode->getBuffer();
+
+  if (!buffer) {
+    return jsi::Value::null();
+  }
+
+  auto bufferHostObject = std::make_shared<AudioBufferHostObject>(buffer);
+  return jsi::Object::createFromHostObject(runtime, bufferHostObject);
+}
+
+JSI_PROPERTY_GETTER_IMPL(ConvolverNodeHostObject, normalize) {
+  auto convolverNode = std::static_pointer_cast<ConvolverNode>(node_);
+  return {convolverNode->getNormalize()};
+}
+
+JSI_PROPERTY_SETTER_IMPL(ConvolverNodeHostObject, normalize) {
+  auto convolverNode = std::static_pointer_cast<ConvolverNode>(node_);
+  convolverNode->setNormalize(value.getBool());
+}
+
+JSI_HOST_FUNCTION_IMPL(ConvolverNodeHostObject, setBuffer) {
+  auto convolverNode = std::static_pointer_cast<ConvolverNode>(node_);
+
+  if (args[0].isNull()) {
+    convolverNode->setBuffer(std::shared_ptr<AudioBuffer>(nullptr));
+    return jsi::Value::undefined();
+  }
+
+  auto bufferHostObject =
+      args[0].getObject(runtime).asHostObject<AudioBufferHostObject>(runtime);
+  // the convolver keeps the spectra of the impulse response, about twice its
+  // size, on top of the buffer itself
+  thisValue.asObject(runtime).setExternalMemoryPressure(
+      runtime, 3 * bufferHostObject->getSizeInBytes() + 16);
+  convolverNode->setBuffer(bufferHostObject->audioBuffer_);
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
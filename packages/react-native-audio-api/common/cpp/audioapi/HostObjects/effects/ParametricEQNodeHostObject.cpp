@@ -0,0 +1,148 @@
+#include <audioapi/HostObjects/effects/ParametricEQNodeHostObject.h>
+
+#include <audioapi/core/effects/ParametricEQNode.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace audioapi {
+
+namespace {
+
+// Index of an existing band, anything else throws a RangeError into JS.
+int getBandIndex(
+    jsi::Runtime &runtime,
+    const jsi::Value &value,
+    int numberOfBands) {
+  auto band = value.isNumber() ? value.getNumber() : -1.0;
+
+  if (!(band >= 0 && band < numberOfBands && band == std::floor(band))) {
+    auto message = "The band index (" + value.toString(runtime).utf8(runtime) +
+        ") is outside the range [0, " + std::to_string(numberOfBands - 1) +
+        "]";
+    auto rangeError =
+        runtime.global().getPropertyAsFunction(runtime, "RangeError");
+    throw jsi::JSError(
+        runtime,
+        rangeError.callAsConstructor(
+            runtime, jsi::String::createFromUtf8(runtime, message)));
+  }
+
+  return static_cast<int>(band);
+}
+
+} // namespace
+
+ParametricEQNodeHostObject::ParametricEQNodeHostObject(
+    const std::shared_ptr<ParametricEQNode> &node)
+    : AudioNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(ParametricEQNodeHostObject, numberOfBands));
+
+  addFunctions(
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, getBandType),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, setBandType),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, getBandFrequency),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, setBandFrequency),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, getBandQ),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, setBandQ),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, getBandGain),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, setBandGain),
+      JSI_EXPORT_FUNCTION(ParametricEQNodeHostObject, getFrequencyResponse));
+}
+
+JSI_PROPERTY_GETTER_IMPL(ParametricEQNodeHostObject, numberOfBands) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  return {parametricEQNode->getNumberOfBands()};
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, getBandType) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  return jsi::String::createFromUtf8(
+      runtime, parametricEQNode->getBandType(band));
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, setBandType) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  parametricEQNode->setBandType(
+      band, args[1].getString(runtime).utf8(runtime));
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, getBandFrequency) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  return {parametricEQNode->getBandFrequency(band)};
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, setBandFrequency) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  parametricEQNode->setBandFrequency(
+      band, static_cast<float>(args[1].getNumber()));
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, getBandQ) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  return {parametricEQNode->getBandQ(band)};
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, setBandQ) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  parametricEQNode->setBandQ(band, static_cast<float>(args[1].getNumber()));
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, getBandGain) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  return {parametricEQNode->getBandGain(band)};
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, setBandGain) {
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  auto band =
+      getBandIndex(runtime, args[0], parametricEQNode->getNumberOfBands());
+  parametricEQNode->setBandGain(
+      band, static_cast<float>(args[1].getNumber()));
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(ParametricEQNodeHostObject, getFrequencyResponse) {
+  auto frequencyView = frequencyArrayBinding_.bind(runtime, args[0]);
+  auto magResponseView = magResponseBinding_.bind(runtime, args[1]);
+  auto phaseResponseView = phaseResponseBinding_.bind(runtime, args[2]);
+
+  // the outputs may be shorter than the frequencies, nothing is written past
+  // the end of any of the three arrays
+  auto length = static_cast<int>(
+      std::min(
+          {frequencyView.byteLength,
+           magResponseView.byteLength,
+           phaseResponseView.byteLength}) /
+      sizeof(float));
+
+  auto parametricEQNode = std::static_pointer_cast<ParametricEQNode>(node_);
+  parametricEQNode->getFrequencyResponse(
+      reinterpret_cast<const float *>(frequencyView.data),
+      reinterpret_cast<float *>(magResponseView.data),
+      reinterpret_cast<float *>(phaseResponseView.data),
+      length);
+
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <audioapi/HostObjects/AudioNodeHostObject.h>
+#include <audioapi/jsi/TypedArrayBinding.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace audioapi {
+using namespace facebook;
+
+class ParametricEQNode;
+
+class ParametricEQNodeHostObject : public AudioNodeHostObject {
+ public:
+  explicit ParametricEQNodeHostObject(
+      const std::shared_ptr<ParametricEQNode> &node);
+
+  JSI_PROPERTY_GETTER_DECL(numberOfBands);
+
+  JSI_HOST_FUNCTION_DECL(getBandType);
+  JSI_HOST_FUNCTION_DECL(setBandType);
+  JSI_HOST_FUNCTION_DECL(getBandFrequency);
+  JSI_HOST_FUNCTION_DECL(setBandFrequency);
+  JSI_HOST_FUNCTION_DECL(getBandQ);
+  JSI_HOST_FUNCTION_DECL(setBandQ);
+  JSI_HOST_FUNCTION_DECL(getBandGain);
+  JSI_HOST_FUNCTION_DECL(setBandGain);
+  JSI_HOST_FUNCTION_DECL(getFrequencyResponse);
+
+ private:
+  TypedArrayBinding frequencyArrayBinding_;
+  TypedArrayBinding magResponseBinding_;
+  TypedArrayBinding phaseResponseBinding_;
+};
+} // namespace audioapi
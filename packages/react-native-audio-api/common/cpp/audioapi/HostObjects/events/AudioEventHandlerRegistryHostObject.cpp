@@ -12,7 +12,9 @@ AudioEventHandlerRegistryHostObject::AudioEventHandlerRegistryHostObject(
       JSI_EXPORT_FUNCTION(
           AudioEventHandlerRegistryHostObject, addAudioEventListener),
       JSI_EXPORT_FUNCTION(
-          AudioEventHandlerRegistryHostObject, removeAudioEventListener));
+          AudioEventHandlerRegistryHostObject, removeAudioEventListener),
+      JSI_EXPORT_FUNCTION(
+          AudioEventHandlerRegistryHostObject, setEventBatchDispatcher));
 }
 
 JSI_HOST_FUNCTION_IMPL(
@@ -38,4 +40,15 @@ JSI_HOST_FUNCTION_IMPL(
   return jsi::Value::undefined();
 }
 
+JSI_HOST_FUNCTION_IMPL(
+    AudioEventHandlerRegistryHostObject,
+    setEventBatchDispatcher) {
+  auto dispatcher = std::make_shared<jsi::Function>(
+      args[0].getObject(runtime).getFunction(runtime));
+
+  eventHandlerRegistry_->setEventBatchDispatcher(dispatcher);
+
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
@@ -20,6 +20,7 @@ class AudioEventHandlerRegistryHostObject : public JsiHostObject {
 
     JSI_HOST_FUNCTION_DECL(addAudioEventListener);
     JSI_HOST_FUNCTION_DECL(removeAudioEventListener);
+    JSI_HOST_FUNCTION_DECL(setEventBatchDispatcher);
 
  private:
     std::shared_ptr<AudioEventHandlerRegistry> eventHandlerRegistry_;
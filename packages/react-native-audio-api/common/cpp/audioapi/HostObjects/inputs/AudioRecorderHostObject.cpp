@@ -1,10 +1,12 @@
 #include <audioapi/HostObjects/inputs/AudioRecorderHostObject.h>
 
+#include <audioapi/HostObjects/inputs/AudioRecorderTapHostObject.h>
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/HostObjects/sources/RecorderAdapterNodeHostObject.h>
 #include <audioapi/core/inputs/AudioRecorder.h>
 #include <audioapi/core/sources/AudioBuffer.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
+#include <audioapi/utils/SharedAudioRing.h>
 #ifdef ANDROID
 #include <audioapi/android/core/AndroidAudioRecorder.h>
 #else
@@ -50,7 +52,9 @@ AudioRecorderHostObject::AudioRecorderHostObject(
         JSI_EXPORT_FUNCTION(AudioRecorderHostObject, start),
         JSI_EXPORT_FUNCTION(AudioRecorderHostObject, stop),
         JSI_EXPORT_FUNCTION(AudioRecorderHostObject, connect),
-        JSI_EXPORT_FUNCTION(AudioRecorderHostObject, disconnect));
+        JSI_EXPORT_FUNCTION(AudioRecorderHostObject, disconnect),
+        JSI_EXPORT_FUNCTION(AudioRecorderHostObject, createTap),
+        JSI_EXPORT_FUNCTION(AudioRecorderHostObject, removeTap));
   } catch (const std::exception& e) {
     throw std::runtime_error(std::string("Failed to initialize AudioRecorder: ") + e.what());
   }
@@ -157,4 +161,30 @@ JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, stop) {
   }
 }
 
-} // namespace audioapi
\ No newline at end of file
+JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, createTap) {
+  if (!audioRecorder_) {
+    throw jsi::JSError(runtime, "AudioRecorder is not initialized");
+  }
+
+  if (count < 1 || !args[0].isNumber() || args[0].getNumber() < 1) {
+    throw jsi::JSError(runtime, "createTap() requires a positive capacity");
+  }
+
+  auto capacity = static_cast<size_t>(args[0].getNumber());
+  auto ring = std::make_shared<SharedAudioRing>(capacity);
+  audioRecorder_->setTap(ring);
+
+  auto tapHostObject = std::make_shared<AudioRecorderTapHostObject>(ring);
+  return jsi::Object::createFromHostObject(runtime, tapHostObject);
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioRecorderHostObject, removeTap) {
+  if (!audioRecorder_) {
+    throw jsi::JSError(runtime, "AudioRecorder is not initialized");
+  }
+
+  audioRecorder_->setTap(nullptr);
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
@@ -26,6 +26,8 @@ class AudioRecorderHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(disconnect);
   JSI_HOST_FUNCTION_DECL(start);
   JSI_HOST_FUNCTION_DECL(stop);
+  JSI_HOST_FUNCTION_DECL(createTap);
+  JSI_HOST_FUNCTION_DECL(removeTap);
 
  private:
   std::shared_ptr<AudioRecorder> audioRecorder_;
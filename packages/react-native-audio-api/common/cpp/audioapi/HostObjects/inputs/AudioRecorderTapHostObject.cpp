@@ -0,0 +1,42 @@
+#include <audioapi/HostObjects/inputs/AudioRecorderTapHostObject.h>
+
+#include <audioapi/jsi/AudioArrayBuffer.h>
+#include <audioapi/utils/SharedAudioRing.h>
+
+namespace audioapi {
+
+AudioRecorderTapHostObject::AudioRecorderTapHostObject(
+    const std::shared_ptr<SharedAudioRing> &ring)
+    : ring_(ring) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(AudioRecorderTapHostObject, buffer),
+      JSI_EXPORT_PROPERTY_GETTER(AudioRecorderTapHostObject, capacity));
+
+  addFunctions(
+      JSI_EXPORT_FUNCTION(AudioRecorderTapHostObject, getAvailableFrames),
+      JSI_EXPORT_FUNCTION(AudioRecorderTapHostObject, release));
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioRecorderTapHostObject, buffer) {
+  // the ArrayBuffer holds a reference to the ring, so its memory stays valid
+  // after the tap is removed from the recorder
+  auto audioArrayBuffer = std::make_shared<AudioArrayBuffer>(
+      ring_, ring_->getMemory(), ring_->getMemorySize());
+  return jsi::ArrayBuffer(runtime, audioArrayBuffer);
+}
+
+JSI_PROPERTY_GETTER_IMPL(AudioRecorderTapHostObject, capacity) {
+  return {static_cast<double>(ring_->getCapacity())};
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioRecorderTapHostObject, getAvailableFrames) {
+  return {static_cast<double>(ring_->getNumberOfAvailableFrames())};
+}
+
+JSI_HOST_FUNCTION_IMPL(AudioRecorderTapHostObject, release) {
+  auto frames = static_cast<size_t>(args[0].getNumber());
+  ring_->release(frames);
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
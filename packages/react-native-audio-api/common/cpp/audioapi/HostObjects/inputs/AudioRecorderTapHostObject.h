@@ -0,0 +1,26 @@
+#pragma once
+
+#include <audioapi/jsi/JsiHostObject.h>
+
+#include <memory>
+
+namespace audioapi {
+using namespace facebook;
+
+class SharedAudioRing;
+
+class AudioRecorderTapHostObject : public JsiHostObject {
+ public:
+  explicit AudioRecorderTapHostObject(
+      const std::shared_ptr<SharedAudioRing> &ring);
+
+  JSI_PROPERTY_GETTER_DECL(buffer);
+  JSI_PROPERTY_GETTER_DECL(capacity);
+
+  JSI_HOST_FUNCTION_DECL(getAvailableFrames);
+  JSI_HOST_FUNCTION_DECL(release);
+
+ private:
+  std::shared_ptr<SharedAudioRing> ring_;
+};
+} // namespace audioapi
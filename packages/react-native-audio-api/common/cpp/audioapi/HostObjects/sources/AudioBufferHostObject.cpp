@@ -42,31 +42,39 @@ JSI_PROPERTY_GETTER_IMPL(AudioBufferHostObject, numberOfChannels) {
 
 JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, getChannelData) {
   auto channel = static_cast<int>(args[0].getNumber());
-  auto channelData =
-      reinterpret_cast<uint8_t *>(audioBuffer_->getChannelData(channel));
-  auto length = static_cast<int>(audioBuffer_->getLength());
-  auto size = static_cast<int>(length * sizeof(float));
-
-  // reading or writing from this ArrayBuffer could cause a crash
-  // if underlying channelData is deallocated
-  auto audioArrayBuffer = std::make_shared<AudioArrayBuffer>(channelData, size);
+  auto channelData = audioBuffer_->getChannelData(channel);
+
+  auto &views = channelDataViews_.get(runtime);
+  if (views.size() <= static_cast<size_t>(channel)) {
+    views.resize(channel + 1);
+  }
+
+  auto &view = views[channel];
+  if (view.data == channelData && view.float32Array.has_value()) {
+    return jsi::Value(runtime, *view.float32Array);
+  }
+
+  auto size = audioBuffer_->getLength() * sizeof(float);
+
+  // the ArrayBuffer holds a reference to the audio buffer, so the channel data
+  // outlives every view of it
+  auto audioArrayBuffer = std::make_shared<AudioArrayBuffer>(
+      audioBuffer_, reinterpret_cast<uint8_t *>(channelData), size);
   auto arrayBuffer = jsi::ArrayBuffer(runtime, audioArrayBuffer);
 
   auto float32ArrayCtor =
       runtime.global().getPropertyAsFunction(runtime, "Float32Array");
-  auto float32Array = float32ArrayCtor.callAsConstructor(runtime, arrayBuffer)
-                          .getObject(runtime);
+  view.data = channelData;
+  view.float32Array =
+      float32ArrayCtor.callAsConstructor(runtime, arrayBuffer).getObject(runtime);
 
-  return float32Array;
+  return jsi::Value(runtime, *view.float32Array);
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, copyFromChannel) {
-  auto arrayBuffer = args[0]
-                         .getObject(runtime)
-                         .getPropertyAsObject(runtime, "buffer")
-                         .getArrayBuffer(runtime);
-  auto destination = reinterpret_cast<float *>(arrayBuffer.data(runtime));
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto view = copyFromChannelBinding_.bind(runtime, args[0]);
+  auto destination = reinterpret_cast<float *>(view.data);
+  auto length = view.byteLength / sizeof(float);
   auto channelNumber = static_cast<int>(args[1].getNumber());
   auto startInChannel = static_cast<size_t>(args[2].getNumber());
 
@@ -77,12 +85,9 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, copyFromChannel) {
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioBufferHostObject, copyToChannel) {
-  auto arrayBuffer = args[0]
-                         .getObject(runtime)
-                         .getPropertyAsObject(runtime, "buffer")
-                         .getArrayBuffer(runtime);
-  auto source = reinterpret_cast<float *>(arrayBuffer.data(runtime));
-  auto length = static_cast<int>(arrayBuffer.size(runtime));
+  auto view = copyToChannelBinding_.bind(runtime, args[0]);
+  auto source = reinterpret_cast<float *>(view.data);
+  auto length = view.byteLength / sizeof(float);
   auto channelNumber = static_cast<int>(args[1].getNumber());
   auto startInChannel = static_cast<size_t>(args[2].getNumber());
 
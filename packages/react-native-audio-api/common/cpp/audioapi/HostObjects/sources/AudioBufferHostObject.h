@@ -1,11 +1,14 @@
 #pragma once
 
 #include <audioapi/jsi/JsiHostObject.h>
+#include <audioapi/jsi/RuntimeAwareCache.h>
+#include <audioapi/jsi/TypedArrayBinding.h>
 #include <audioapi/core/sources/AudioBuffer.h>
 
 #include <jsi/jsi.h>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -42,5 +45,17 @@ class AudioBufferHostObject : public JsiHostObject {
   JSI_HOST_FUNCTION_DECL(getChannelData);
   JSI_HOST_FUNCTION_DECL(copyFromChannel);
   JSI_HOST_FUNCTION_DECL(copyToChannel);
+
+ private:
+  struct ChannelDataView {
+    float *data = nullptr;
+    std::optional<jsi::Object> float32Array;
+  };
+
+  // Float32Array views of the channels, created by the first getChannelData
+  // and recreated only if the channel storage changes.
+  RuntimeAwareCache<std::vector<ChannelDataView>> channelDataViews_;
+  TypedArrayBinding copyFromChannelBinding_;
+  TypedArrayBinding copyToChannelBinding_;
 };
 } // namespace audioapi
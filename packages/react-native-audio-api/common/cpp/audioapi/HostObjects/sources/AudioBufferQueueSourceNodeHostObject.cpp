@@ -2,12 +2,24 @@
 
 #include <audioapi/HostObjects/sources/AudioBufferHostObject.h>
 #include <audioapi/core/sources/AudioBufferQueueSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+
+#include <string>
 
 namespace audioapi {
 
 AudioBufferQueueSourceNodeHostObject::AudioBufferQueueSourceNodeHostObject(
     const std::shared_ptr<AudioBufferQueueSourceNode> &node)
     : AudioBufferBaseSourceNodeHostObject(node) {
+  addGetters(JSI_EXPORT_PROPERTY_GETTER(
+      AudioBufferQueueSourceNodeHostObject, crossfadeDuration));
+
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(
+          AudioBufferQueueSourceNodeHostObject, crossfadeDuration),
+      JSI_EXPORT_PROPERTY_SETTER(
+          AudioBufferQueueSourceNodeHostObject, onBufferConsumed));
+
   addFunctions(
       JSI_EXPORT_FUNCTION(AudioBufferQueueSourceNodeHostObject, enqueueBuffer),
       JSI_EXPORT_FUNCTION(AudioBufferQueueSourceNodeHostObject, dequeueBuffer),
@@ -15,6 +27,39 @@ AudioBufferQueueSourceNodeHostObject::AudioBufferQueueSourceNodeHostObject(
       JSI_EXPORT_FUNCTION(AudioBufferQueueSourceNodeHostObject, pause));
 }
 
+AudioBufferQueueSourceNodeHostObject::~AudioBufferQueueSourceNodeHostObject() {
+  auto audioBufferQueueSourceNode =
+      std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+
+  // The node might outlive the JSI object together with its callback.
+  audioBufferQueueSourceNode->clearOnBufferConsumedCallback();
+}
+
+JSI_PROPERTY_GETTER_IMPL(
+    AudioBufferQueueSourceNodeHostObject,
+    crossfadeDuration) {
+  auto audioBufferQueueSourceNode =
+      std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+  return {audioBufferQueueSourceNode->getCrossfadeDuration()};
+}
+
+JSI_PROPERTY_SETTER_IMPL(
+    AudioBufferQueueSourceNodeHostObject,
+    crossfadeDuration) {
+  auto audioBufferQueueSourceNode =
+      std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+  audioBufferQueueSourceNode->setCrossfadeDuration(value.getNumber());
+}
+
+JSI_PROPERTY_SETTER_IMPL(
+    AudioBufferQueueSourceNodeHostObject,
+    onBufferConsumed) {
+  auto audioBufferQueueSourceNode =
+      std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
+  audioBufferQueueSourceNode->setOnBufferConsumedCallbackId(
+      std::stoull(value.getString(runtime).utf8(runtime)));
+}
+
 JSI_HOST_FUNCTION_IMPL(AudioBufferQueueSourceNodeHostObject, pause) {
   auto audioBufferQueueSourceNode =
       std::static_pointer_cast<AudioBufferQueueSourceNode>(node_);
@@ -34,7 +79,14 @@ JSI_HOST_FUNCTION_IMPL(AudioBufferQueueSourceNodeHostObject, enqueueBuffer) {
   auto bufferId = audioBufferQueueSourceNode->enqueueBuffer(
       audioBufferHostObject->audioBuffer_);
 
-  return jsi::String::createFromUtf8(runtime, bufferId);
+  if (!bufferId) {
+    throw jsi::JSError(
+        runtime,
+        "The queue is full, " + std::to_string(AUDIO_BUFFER_QUEUE_CAPACITY) +
+            " buffers can wait in it at once");
+  }
+
+  return jsi::String::createFromUtf8(runtime, *bufferId);
 }
 
 JSI_HOST_FUNCTION_IMPL(AudioBufferQueueSourceNodeHostObject, dequeueBuffer) {
@@ -16,6 +16,13 @@ class AudioBufferQueueSourceNodeHostObject
     explicit AudioBufferQueueSourceNodeHostObject(
             const std::shared_ptr<AudioBufferQueueSourceNode> &node);
 
+    ~AudioBufferQueueSourceNodeHostObject() override;
+
+    JSI_PROPERTY_GETTER_DECL(crossfadeDuration);
+
+    JSI_PROPERTY_SETTER_DECL(crossfadeDuration);
+    JSI_PROPERTY_SETTER_DECL(onBufferConsumed);
+
     JSI_HOST_FUNCTION_DECL(pause);
     JSI_HOST_FUNCTION_DECL(enqueueBuffer);
     JSI_HOST_FUNCTION_DECL(dequeueBuffer);
@@ -9,7 +9,73 @@ namespace audioapi {
 StreamerNodeHostObject::StreamerNodeHostObject(
     const std::shared_ptr<StreamerNode> &node)
     : AudioScheduledSourceNodeHostObject(node) {
-  addFunctions(JSI_EXPORT_FUNCTION(StreamerNodeHostObject, initialize));
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(StreamerNodeHostObject, lowWatermark),
+      JSI_EXPORT_PROPERTY_GETTER(StreamerNodeHostObject, highWatermark),
+      JSI_EXPORT_PROPERTY_GETTER(
+          StreamerNodeHostObject, onBufferLevelChangedInterval));
+
+  addSetters(
+      JSI_EXPORT_PROPERTY_SETTER(StreamerNodeHostObject, lowWatermark),
+      JSI_EXPORT_PROPERTY_SETTER(StreamerNodeHostObject, highWatermark),
+      JSI_EXPORT_PROPERTY_SETTER(StreamerNodeHostObject, onBufferUnderrun),
+      JSI_EXPORT_PROPERTY_SETTER(StreamerNodeHostObject, onBufferLevelChanged),
+      JSI_EXPORT_PROPERTY_SETTER(
+          StreamerNodeHostObject, onBufferLevelChangedInterval));
+
+  addFunctions(
+      JSI_EXPORT_FUNCTION(StreamerNodeHostObject, initialize),
+      JSI_EXPORT_FUNCTION(StreamerNodeHostObject, seek));
+}
+
+StreamerNodeHostObject::~StreamerNodeHostObject() {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+
+  // The node might outlive the JSI object together with its callbacks.
+  streamerNode->clearOnBufferEventCallbacks();
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamerNodeHostObject, lowWatermark) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  return {streamerNode->getLowWatermark()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamerNodeHostObject, highWatermark) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  return {streamerNode->getHighWatermark()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamerNodeHostObject, onBufferLevelChangedInterval) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  return {streamerNode->getOnBufferLevelChangedInterval()};
+}
+
+JSI_PROPERTY_SETTER_IMPL(StreamerNodeHostObject, lowWatermark) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->setLowWatermark(static_cast<float>(value.getNumber()));
+}
+
+JSI_PROPERTY_SETTER_IMPL(StreamerNodeHostObject, highWatermark) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->setHighWatermark(static_cast<float>(value.getNumber()));
+}
+
+JSI_PROPERTY_SETTER_IMPL(StreamerNodeHostObject, onBufferUnderrun) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->setOnBufferUnderrunCallbackId(
+      std::stoull(value.getString(runtime).utf8(runtime)));
+}
+
+JSI_PROPERTY_SETTER_IMPL(StreamerNodeHostObject, onBufferLevelChanged) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->setOnBufferLevelChangedCallbackId(
+      std::stoull(value.getString(runtime).utf8(runtime)));
+}
+
+JSI_PROPERTY_SETTER_IMPL(StreamerNodeHostObject, onBufferLevelChangedInterval) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->setOnBufferLevelChangedInterval(
+      static_cast<int>(value.getNumber()));
 }
 
 JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, initialize) {
@@ -19,4 +85,10 @@ JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, initialize) {
   return {result};
 }
 
+JSI_HOST_FUNCTION_IMPL(StreamerNodeHostObject, seek) {
+  auto streamerNode = std::static_pointer_cast<StreamerNode>(node_);
+  streamerNode->seek(args[0].getNumber());
+  return jsi::Value::undefined();
+}
+
 } // namespace audioapi
@@ -16,11 +16,24 @@ class StreamerNodeHostObject : public AudioScheduledSourceNodeHostObject {
   explicit StreamerNodeHostObject(
           const std::shared_ptr<StreamerNode> &node);
 
+  ~StreamerNodeHostObject() override;
+
     [[nodiscard]] static inline size_t getSizeInBytes() {
         return SIZE;
     }
 
+  JSI_PROPERTY_GETTER_DECL(lowWatermark);
+  JSI_PROPERTY_GETTER_DECL(highWatermark);
+  JSI_PROPERTY_GETTER_DECL(onBufferLevelChangedInterval);
+
+  JSI_PROPERTY_SETTER_DECL(lowWatermark);
+  JSI_PROPERTY_SETTER_DECL(highWatermark);
+  JSI_PROPERTY_SETTER_DECL(onBufferUnderrun);
+  JSI_PROPERTY_SETTER_DECL(onBufferLevelChanged);
+  JSI_PROPERTY_SETTER_DECL(onBufferLevelChangedInterval);
+
   JSI_HOST_FUNCTION_DECL(initialize);
+  JSI_HOST_FUNCTION_DECL(seek);
 
  private:
     static constexpr size_t SIZE = 4'000'000; // 4MB
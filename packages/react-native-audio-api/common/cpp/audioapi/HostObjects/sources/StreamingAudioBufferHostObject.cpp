@@ -0,0 +1,32 @@
+#include <audioapi/HostObjects/sources/StreamingAudioBufferHostObject.h>
+
+namespace audioapi {
+
+StreamingAudioBufferHostObject::StreamingAudioBufferHostObject(
+    const std::shared_ptr<StreamingAudioBuffer> &streamingAudioBuffer)
+    : streamingAudioBuffer_(streamingAudioBuffer) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(StreamingAudioBufferHostObject, sampleRate),
+      JSI_EXPORT_PROPERTY_GETTER(StreamingAudioBufferHostObject, length),
+      JSI_EXPORT_PROPERTY_GETTER(StreamingAudioBufferHostObject, duration),
+      JSI_EXPORT_PROPERTY_GETTER(
+          StreamingAudioBufferHostObject, numberOfChannels));
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamingAudioBufferHostObject, sampleRate) {
+  return {streamingAudioBuffer_->getSampleRate()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamingAudioBufferHostObject, length) {
+  return {static_cast<double>(streamingAudioBuffer_->getLength())};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamingAudioBufferHostObject, duration) {
+  return {streamingAudioBuffer_->getDuration()};
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamingAudioBufferHostObject, numberOfChannels) {
+  return {streamingAudioBuffer_->getNumberOfChannels()};
+}
+
+} // namespace audioapi
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <audioapi/jsi/JsiHostObject.h>
+#include <audioapi/core/sources/StreamingAudioBuffer.h>
+
+#include <jsi/jsi.h>
+#include <cstddef>
+#include <memory>
+
+namespace audioapi {
+using namespace facebook;
+
+class StreamingAudioBufferHostObject : public JsiHostObject {
+ public:
+  std::shared_ptr<StreamingAudioBuffer> streamingAudioBuffer_;
+
+  explicit StreamingAudioBufferHostObject(
+      const std::shared_ptr<StreamingAudioBuffer> &streamingAudioBuffer);
+
+  [[nodiscard]] inline size_t getSizeInBytes() const {
+    return streamingAudioBuffer_->getSizeInBytes();
+  }
+
+  JSI_PROPERTY_GETTER_DECL(sampleRate);
+  JSI_PROPERTY_GETTER_DECL(length);
+  JSI_PROPERTY_GETTER_DECL(duration);
+  JSI_PROPERTY_GETTER_DECL(numberOfChannels);
+};
+} // namespace audioapi
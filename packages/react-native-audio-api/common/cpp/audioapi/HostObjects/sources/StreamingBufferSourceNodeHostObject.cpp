@@ -0,0 +1,75 @@
+#include <audioapi/HostObjects/sources/StreamingBufferSourceNodeHostObject.h>
+
+#include <audioapi/HostObjects/sources/StreamingAudioBufferHostObject.h>
+#include <audioapi/core/sources/StreamingBufferSourceNode.h>
+
+namespace audioapi {
+
+StreamingBufferSourceNodeHostObject::StreamingBufferSourceNodeHostObject(
+    const std::shared_ptr<StreamingBufferSourceNode> &node)
+    : AudioBufferBaseSourceNodeHostObject(node) {
+  addGetters(
+      JSI_EXPORT_PROPERTY_GETTER(StreamingBufferSourceNodeHostObject, buffer));
+
+  // start method is overridden in this class
+  functions_->erase("start");
+
+  addFunctions(
+      JSI_EXPORT_FUNCTION(StreamingBufferSourceNodeHostObject, start),
+      JSI_EXPORT_FUNCTION(StreamingBufferSourceNodeHostObject, setBuffer));
+}
+
+JSI_PROPERTY_GETTER_IMPL(StreamingBufferSourceNodeHostObject, buffer) {
+  auto streamingBufferSourceNode =
+      std::static_pointer_cast<StreamingBufferSourceNode>(node_);
+  auto buffer = streamingBufferSourceNode->getBuffer();
+
+  if (!buffer) {
+    return jsi::Value::null();
+  }
+
+  auto bufferHostObject =
+      std::make_shared<StreamingAudioBufferHostObject>(buffer);
+  return jsi::Object::createFromHostObject(runtime, bufferHostObject);
+}
+
+JSI_HOST_FUNCTION_IMPL(StreamingBufferSourceNodeHostObject, start) {
+  auto when = args[0].getNumber();
+  auto offset = args[1].getNumber();
+
+  auto streamingBufferSourceNode =
+      std::static_pointer_cast<StreamingBufferSourceNode>(node_);
+
+  if (args[2].isUndefined()) {
+    streamingBufferSourceNode->start(when, offset);
+
+    return jsi::Value::undefined();
+  }
+
+  auto duration = args[2].getNumber();
+  streamingBufferSourceNode->start(when, offset, duration);
+
+  return jsi::Value::undefined();
+}
+
+JSI_HOST_FUNCTION_IMPL(StreamingBufferSourceNodeHostObject, setBuffer) {
+  auto streamingBufferSourceNode =
+      std::static_pointer_cast<StreamingBufferSourceNode>(node_);
+
+  if (args[0].isNull()) {
+    streamingBufferSourceNode->setBuffer(nullptr);
+    return jsi::Value::undefined();
+  }
+
+  auto bufferHostObject = args[0]
+                              .getObject(runtime)
+                              .asHostObject<StreamingAudioBufferHostObject>(
+                                  runtime);
+  thisValue.asObject(runtime).setExternalMemoryPressure(
+      runtime, bufferHostObject->getSizeInBytes() + 16);
+  streamingBufferSourceNode->setBuffer(
+      bufferHostObject->streamingAudioBuffer_);
+  return jsi::Value::undefined();
+}
+
+} // namespace audioapi
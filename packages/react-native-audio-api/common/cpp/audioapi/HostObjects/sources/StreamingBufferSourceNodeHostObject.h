@@ -0,0 +1,24 @@
+#pragma once
+
+#include <audioapi/HostObjects/sources/AudioBufferBaseSourceNodeHostObject.h>
+
+#include <memory>
+
+namespace audioapi {
+using namespace facebook;
+
+class StreamingBufferSourceNode;
+
+class StreamingBufferSourceNodeHostObject
+    : public AudioBufferBaseSourceNodeHostObject {
+ public:
+  explicit StreamingBufferSourceNodeHostObject(
+      const std::shared_ptr<StreamingBufferSourceNode> &node);
+
+  JSI_PROPERTY_GETTER_DECL(buffer);
+
+  JSI_HOST_FUNCTION_DECL(start);
+  JSI_HOST_FUNCTION_DECL(setBuffer);
+};
+
+} // namespace audioapi
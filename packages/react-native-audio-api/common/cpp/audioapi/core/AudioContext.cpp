@@ -8,6 +8,12 @@
 #include <audioapi/core/destinations/AudioDestinationNode.h>
 #include <audioapi/core/utils/AudioDecoder.h>
 #include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/utils/AudioBusArena.h>
+#include <audioapi/utils/RenderWorkerPool.hpp>
+
+#include <algorithm>
+#include <thread>
 
 namespace audioapi {
 AudioContext::AudioContext(
@@ -15,7 +21,8 @@ AudioContext::AudioContext(
     bool initSuspended,
     const std::shared_ptr<IAudioEventHandlerRegistry>
         &audioEventHandlerRegistry,
-    const RuntimeRegistry &runtimeRegistry)
+    const RuntimeRegistry &runtimeRegistry,
+    int renderWorkerCount)
     : BaseAudioContext(audioEventHandlerRegistry, runtimeRegistry) {
 #ifdef ANDROID
   audioPlayer_ = std::make_shared<AudioPlayer>(
@@ -27,6 +34,27 @@ AudioContext::AudioContext(
 
   sampleRate_ = sampleRate;
   audioDecoder_ = std::make_shared<AudioDecoder>(sampleRate);
+  busArena_ = std::make_shared<AudioBusArena>(sampleRate);
+  isRealtime_ = true;
+
+  // the audio thread itself renders too, so one core is left for it
+  size_t numberOfRenderWorkers = 0;
+  if (renderWorkerCount < 0) {
+    auto hardwareConcurrency =
+        static_cast<size_t>(std::thread::hardware_concurrency());
+    numberOfRenderWorkers = hardwareConcurrency > 1
+        ? std::min(hardwareConcurrency - 1, RENDER_WORKER_POOL_MAX_THREAD_COUNT)
+        : 0;
+  } else {
+    numberOfRenderWorkers = std::min(
+        static_cast<size_t>(renderWorkerCount),
+        RENDER_WORKER_POOL_MAX_THREAD_COUNT);
+  }
+
+  if (numberOfRenderWorkers > 0) {
+    renderWorkerPool_ =
+        std::make_shared<RenderWorkerPool>(numberOfRenderWorkers);
+  }
 
   if (initSuspended) {
     playerHasBeenStarted_ = false;
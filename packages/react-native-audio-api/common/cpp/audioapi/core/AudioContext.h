@@ -15,7 +15,9 @@ class IOSAudioPlayer;
 
 class AudioContext : public BaseAudioContext {
  public:
-  explicit AudioContext(float sampleRate, bool initSuspended, const std::shared_ptr<IAudioEventHandlerRegistry> &audioEventHandlerRegistry, const RuntimeRegistry &runtimeRegistry);
+  /// @param renderWorkerCount Threads rendering independent parts of the graph next to the audio thread,
+  /// 0 renders on the audio thread only and a negative count picks one from the number of cores.
+  explicit AudioContext(float sampleRate, bool initSuspended, const std::shared_ptr<IAudioEventHandlerRegistry> &audioEventHandlerRegistry, const RuntimeRegistry &runtimeRegistry, int renderWorkerCount);
   ~AudioContext() override;
 
   void close();
@@ -2,20 +2,33 @@
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/utils/AllocationGuard.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/AudioBusArena.h>
+
+#include <algorithm>
 
 namespace audioapi {
 
 AudioNode::AudioNode(BaseAudioContext *context) : context_(context) {
   audioBus_ = std::make_shared<AudioBus>(
       RENDER_QUANTUM_SIZE, channelCount_, context->getSampleRate());
+
+  // The node may take a bus from the arena while rendering, it is reserved
+  // here so the audio thread does not have to allocate one. The destination
+  // is created before the arena.
+  if (auto busArena = context->getBusArena()) {
+    busArena->reserve(context->getNodeManager()->getNumberOfNodes() + 1);
+  }
 }
 
 AudioNode::~AudioNode() {
   if (isInitialized_) {
     cleanup();
   }
+
+  releaseProcessingBus();
 }
 
 int AudioNode::getNumberOfInputs() const {
@@ -66,16 +79,20 @@ void AudioNode::disconnect(const std::shared_ptr<AudioParam> &param) {
 }
 
 bool AudioNode::isEnabled() const {
-  return isEnabled_;
+  return isEnabled_.load(std::memory_order_acquire);
+}
+
+bool AudioNode::isActive() const {
+  return isEnabled() ||
+      disabledFrame_.load(std::memory_order_relaxed) ==
+      context_->getCurrentSampleFrame();
 }
 
 void AudioNode::enable() {
-  if (isEnabled()) {
+  if (isEnabled_.exchange(true, std::memory_order_acq_rel)) {
     return;
   }
 
-  isEnabled_ = true;
-
   for (auto it = outputNodes_.begin(), end = outputNodes_.end(); it != end;
        ++it) {
     it->get()->onInputEnabled();
@@ -83,15 +100,21 @@ void AudioNode::enable() {
 }
 
 void AudioNode::disable() {
-  if (!isEnabled()) {
+  // A node disabling itself while it renders still outputs this quantum.
+  disableAtFrame(lastRenderedFrame_.load(std::memory_order_relaxed));
+}
+
+void AudioNode::disableAtFrame(std::size_t frame) {
+  if (!isEnabled_.exchange(false, std::memory_order_acq_rel)) {
     return;
   }
 
-  isEnabled_ = false;
+  disabledFrame_.store(frame, std::memory_order_relaxed);
 
+  // Outputs rendered later in the same quantum still take the output.
   for (auto it = outputNodes_.begin(), end = outputNodes_.end(); it != end;
        ++it) {
-    it->get()->onInputDisabled();
+    it->get()->onInputDisabled(frame);
   }
 }
 
@@ -119,7 +142,7 @@ std::string AudioNode::toString(ChannelInterpretation interpretation) {
   }
 }
 
-std::shared_ptr<AudioBus> AudioNode::processAudio(
+const std::shared_ptr<AudioBus> &AudioNode::processAudio(
     const std::shared_ptr<AudioBus> &outputBus,
     int framesToProcess,
     bool checkIsAlreadyProcessed) {
@@ -128,15 +151,17 @@ std::shared_ptr<AudioBus> AudioNode::processAudio(
   }
 
   if (checkIsAlreadyProcessed && isAlreadyProcessed()) {
-    return audioBus_;
+    // Either the node was already rendered in this quantum or we are inside
+    // a cycle, in which case the previous quantum output is used.
+    return lastRenderedBus_ != nullptr ? lastRenderedBus_ : audioBus_;
   }
 
   // Process inputs and return the bus with the most channels.
-  auto processingBus =
+  const auto &inputsBus =
       processInputs(outputBus, framesToProcess, checkIsAlreadyProcessed);
 
   // Apply channel count mode.
-  processingBus = applyChannelCountMode(processingBus);
+  const auto &processingBus = applyChannelCountMode(inputsBus);
 
   // Mix all input buses into the processing bus.
   mixInputsBuses(processingBus);
@@ -144,8 +169,11 @@ std::shared_ptr<AudioBus> AudioNode::processAudio(
   assert(processingBus != nullptr);
 
   // Finally, process the node itself.
-  return processNode(processingBus, framesToProcess);
-  ;
+  lastRenderedBus_ = processNode(processingBus, framesToProcess);
+
+  advanceTail(framesToProcess);
+
+  return lastRenderedBus_;
 }
 
 bool AudioNode::isAlreadyProcessed() {
@@ -154,47 +182,87 @@ bool AudioNode::isAlreadyProcessed() {
   std::size_t currentSampleFrame = context_->getCurrentSampleFrame();
 
   // check if the node has already been processed for this rendering quantum
-  if (currentSampleFrame == lastRenderedFrame_) {
+  if (currentSampleFrame ==
+      lastRenderedFrame_.load(std::memory_order_relaxed)) {
     return true;
   }
 
   // Update the last rendered frame before processing node and its inputs.
-  lastRenderedFrame_ = currentSampleFrame;
+  lastRenderedFrame_.store(currentSampleFrame, std::memory_order_relaxed);
 
   return false;
 }
 
-std::shared_ptr<AudioBus> AudioNode::processInputs(
+const std::shared_ptr<AudioBus> &AudioNode::processInputs(
     const std::shared_ptr<AudioBus> &outputBus,
     int framesToProcess,
     bool checkIsAlreadyProcessed) {
-  auto processingBus = audioBus_;
-  processingBus->zero();
-
   int maxNumberOfChannels = 0;
-  for (auto it = inputNodes_.begin(), end = inputNodes_.end(); it != end;
-       ++it) {
-    auto inputNode = *it;
+  for (auto *inputNode : inputNodes_) {
     assert(inputNode != nullptr);
 
-    if (!inputNode->isEnabled()) {
+    if (!inputNode->isActive()) {
       continue;
     }
 
-    auto inputBus = inputNode->processAudio(
+    const auto &inputBus = inputNode->processAudio(
         outputBus, framesToProcess, checkIsAlreadyProcessed);
-    inputBuses_.push_back(inputBus);
+    inputBuses_.push_back(inputBus.get());
+
+    maxNumberOfChannels =
+        std::max(maxNumberOfChannels, inputBus->getNumberOfChannels());
+  }
+
+  return getProcessingBus(maxNumberOfChannels);
+}
+
+const std::shared_ptr<AudioBus> &AudioNode::getProcessingBus(
+    int numberOfChannels) {
+  // Inputs are always mixed into a bus owned by this node, so processing
+  // never modifies the output of an input node, which may have other outputs.
+  if (numberOfChannels == 0 ||
+      numberOfChannels == audioBus_->getNumberOfChannels()) {
+    return audioBus_;
+  }
 
-    if (maxNumberOfChannels < inputBus->getNumberOfChannels()) {
-      maxNumberOfChannels = inputBus->getNumberOfChannels();
-      processingBus = inputBus;
+  if (processingBus_ == nullptr ||
+      processingBus_->getNumberOfChannels() != numberOfChannels) {
+    // Hand the previous bus back first, so the arena can hand it out again.
+    releaseProcessingBus();
+
+    if (busArena_ == nullptr) {
+      busArena_ = context_->getBusArena();
+    }
+
+    processingBusIndex_ = busArena_->acquire(numberOfChannels);
+
+    if (processingBusIndex_ != AudioBusArena::NO_BUS) {
+      // Non-owning, the bus belongs to the arena.
+      processingBus_ = std::shared_ptr<AudioBus>(
+          std::shared_ptr<AudioBus>(), busArena_->getBus(processingBusIndex_));
+    } else {
+      // Not recycled, the node keeps it until its layout changes again.
+      assert(
+          !RN_AUDIO_API_DEBUG_ALLOCATIONS &&
+          "No bus of the requested layout left in the arena");
+      processingBus_ = std::make_shared<AudioBus>(
+          RENDER_QUANTUM_SIZE, numberOfChannels, context_->getSampleRate());
     }
   }
 
-  return processingBus;
+  return processingBus_;
 }
 
-std::shared_ptr<AudioBus> AudioNode::applyChannelCountMode(
+void AudioNode::releaseProcessingBus() {
+  if (processingBusIndex_ != AudioBusArena::NO_BUS) {
+    busArena_->release(processingBusIndex_);
+    processingBusIndex_ = AudioBusArena::NO_BUS;
+  }
+
+  processingBus_ = nullptr;
+}
+
+const std::shared_ptr<AudioBus> &AudioNode::applyChannelCountMode(
     const std::shared_ptr<AudioBus> &processingBus) {
   // If the channelCountMode is EXPLICIT, the node should output the number of
   // channels specified by the channelCount.
@@ -215,72 +283,120 @@ std::shared_ptr<AudioBus> AudioNode::applyChannelCountMode(
 void AudioNode::mixInputsBuses(const std::shared_ptr<AudioBus> &processingBus) {
   assert(processingBus != nullptr);
 
-  for (auto it = inputBuses_.begin(), end = inputBuses_.end(); it != end;
-       ++it) {
-    processingBus->sum(it->get(), channelInterpretation_);
+  processingBus->zero();
+
+  for (auto *inputBus : inputBuses_) {
+    processingBus->sum(inputBus, channelInterpretation_);
   }
 
   inputBuses_.clear();
 }
 
 void AudioNode::connectNode(const std::shared_ptr<AudioNode> &node) {
-  auto position = outputNodes_.find(node);
+  auto position = std::find(outputNodes_.begin(), outputNodes_.end(), node);
 
-  if (position == outputNodes_.end()) {
-    outputNodes_.insert(node);
-    node->onInputConnected(this);
+  if (position != outputNodes_.end()) {
+    // Already connected, the connection reserved for it is not used.
+    numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
+    node->numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
+    return;
   }
+
+  // within the capacity reserved for the connection
+  outputNodes_.push_back(node);
+  node->onInputConnected(this);
 }
 
 void AudioNode::connectParam(const std::shared_ptr<AudioParam> &param) {
-  auto position = outputParams_.find(param);
+  auto position = std::find(outputParams_.begin(), outputParams_.end(), param);
 
-  if (position == outputParams_.end()) {
-    outputParams_.insert(param);
-    param->addInputNode(this);
+  if (position != outputParams_.end()) {
+    numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
+    param->numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
+    return;
   }
+
+  outputParams_.push_back(param);
+  param->addInputNode(this);
 }
 
 void AudioNode::disconnectNode(const std::shared_ptr<AudioNode> &node) {
-  auto position = outputNodes_.find(node);
+  auto position = std::find(outputNodes_.begin(), outputNodes_.end(), node);
 
   if (position != outputNodes_.end()) {
     node->onInputDisconnected(this);
-    outputNodes_.erase(node);
+    outputNodes_.erase(position);
+    numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
   }
 }
 
 void AudioNode::disconnectParam(const std::shared_ptr<AudioParam> &param) {
-  auto position = outputParams_.find(param);
+  auto position = std::find(outputParams_.begin(), outputParams_.end(), param);
 
   if (position != outputParams_.end()) {
     param->removeInputNode(this);
-    outputParams_.erase(param);
+    outputParams_.erase(position);
+    numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
   }
 }
 
 void AudioNode::onInputEnabled() {
-  numberOfEnabledInputNodes_ += 1;
+  numberOfEnabledInputNodes_.fetch_add(1, std::memory_order_acq_rel);
 
   if (!isEnabled()) {
     enable();
   }
 }
 
-void AudioNode::onInputDisabled() {
-  numberOfEnabledInputNodes_ -= 1;
+void AudioNode::onInputDisabled(std::size_t frame) {
+  auto previousCount =
+      numberOfEnabledInputNodes_.fetch_sub(1, std::memory_order_acq_rel);
 
-  if (isEnabled() && numberOfEnabledInputNodes_ == 0) {
-    disable();
+  if (previousCount != 1 || !isEnabled()) {
+    return;
   }
+
+  auto tailFrames = tailFrames_.load(std::memory_order_relaxed);
+  if (tailFrames == 0) {
+    disableAtFrame(frame);
+    return;
+  }
+
+  // The node is rendered with silent input until the tail is over.
+  remainingTailFrames_.store(tailFrames, std::memory_order_relaxed);
+}
+
+void AudioNode::advanceTail(int framesToProcess) {
+  auto remainingTailFrames =
+      remainingTailFrames_.load(std::memory_order_relaxed);
+  if (remainingTailFrames == 0) {
+    return;
+  }
+
+  // an input enabled meanwhile cancels the tail
+  if (numberOfEnabledInputNodes_.load(std::memory_order_acquire) != 0) {
+    remainingTailFrames_.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  auto frames = static_cast<std::size_t>(framesToProcess);
+  if (remainingTailFrames > frames) {
+    remainingTailFrames_.store(
+        remainingTailFrames - frames, std::memory_order_relaxed);
+    return;
+  }
+
+  remainingTailFrames_.store(0, std::memory_order_relaxed);
+  disable();
 }
 
 void AudioNode::onInputConnected(AudioNode *node) {
   if (!isInitialized_) {
+    numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
     return;
   }
 
-  inputNodes_.insert(node);
+  inputNodes_.push_back(node);
 
   if (node->isEnabled()) {
     onInputEnabled();
@@ -293,13 +409,14 @@ void AudioNode::onInputDisconnected(AudioNode *node) {
   }
 
   if (node->isEnabled()) {
-    onInputDisabled();
+    onInputDisabled(node->lastRenderedFrame_.load(std::memory_order_relaxed));
   }
 
-  auto position = inputNodes_.find(node);
+  auto position = std::find(inputNodes_.begin(), inputNodes_.end(), node);
 
   if (position != inputNodes_.end()) {
     inputNodes_.erase(position);
+    numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
   }
 }
 
@@ -311,7 +428,14 @@ void AudioNode::cleanup() {
     it->get()->onInputDisconnected(this);
   }
 
+  // Params only hold a pointer to the node, it must not outlive it.
+  for (auto it = outputParams_.begin(), end = outputParams_.end(); it != end;
+       ++it) {
+    it->get()->removeInputNode(this);
+  }
+
   outputNodes_.clear();
+  outputParams_.clear();
 }
 
 } // namespace audioapi
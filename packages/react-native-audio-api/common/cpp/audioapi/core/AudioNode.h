@@ -4,9 +4,9 @@
 #include <audioapi/core/types/ChannelInterpretation.h>
 #include <audioapi/core/utils/Constants.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
-#include <unordered_set>
 #include <cstddef>
 #include <vector>
 #include <cassert>
@@ -14,6 +14,7 @@
 namespace audioapi {
 
 class AudioBus;
+class AudioBusArena;
 class BaseAudioContext;
 class AudioParam;
 
@@ -32,15 +33,19 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   void disconnect();
   void disconnect(const std::shared_ptr<AudioNode> &node);
   void disconnect(const std::shared_ptr<AudioParam> &param);
-  virtual std::shared_ptr<AudioBus> processAudio(const std::shared_ptr<AudioBus> &outputBus, int framesToProcess, bool checkIsAlreadyProcessed);
+  virtual const std::shared_ptr<AudioBus> &processAudio(const std::shared_ptr<AudioBus> &outputBus, int framesToProcess, bool checkIsAlreadyProcessed);
 
   bool isEnabled() const;
+  // Enabled, or disabled while the current quantum was rendered, e.g. by a
+  // source reaching its end. The output of such a node is still used.
+  bool isActive() const;
   void enable();
   virtual void disable();
 
  protected:
   friend class AudioNodeManager;
   friend class AudioDestinationNode;
+  friend class DelayNode;
 
   BaseAudioContext *context_;
   std::shared_ptr<AudioBus> audioBus_;
@@ -52,18 +57,57 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   ChannelInterpretation channelInterpretation_ =
           ChannelInterpretation::SPEAKERS;
 
-  std::unordered_set<AudioNode *> inputNodes_ = {};
-  std::unordered_set<std::shared_ptr<AudioNode>> outputNodes_ = {};
-  std::unordered_set<std::shared_ptr<AudioParam>> outputParams_ = {};
-
-  int numberOfEnabledInputNodes_ = 0;
+  // Kept contiguous, as it is walked every render quantum. The connection
+  // lists are reserved by AudioNodeManager on the JS thread, so connecting
+  // nodes does not reallocate them on the audio thread.
+  std::vector<AudioNode *> inputNodes_ = {};
+  std::vector<std::shared_ptr<AudioNode>> outputNodes_ = {};
+  std::vector<std::shared_ptr<AudioParam>> outputParams_ = {};
+  // Connections of the node in any direction, requested on the JS thread and
+  // not yet removed by the audio thread. Every connection list is reserved
+  // for that many.
+  std::atomic<std::size_t> numberOfConnections_ = 0;
+  // Number of connections the lists are reserved for, JS thread only.
+  std::size_t connectionCapacity_ = 0;
+
+  // Atomic, as inputs rendered on different threads can be disabled at once.
+  std::atomic<int> numberOfEnabledInputNodes_ = 0;
+  // Frames the node keeps rendering after its last input is disabled, e.g. a
+  // reverb or an echo. The node is disabled only once they are rendered.
+  std::atomic<std::size_t> tailFrames_ = 0;
   bool isInitialized_ = false;
-  bool isEnabled_ = true;
+  std::atomic<bool> isEnabled_ = true;
+
+  // Atomic, as disable() may read it on the JS thread.
+  std::atomic<std::size_t> lastRenderedFrame_{SIZE_MAX};
+  // Quantum in which the node was disabled, see isActive().
+  std::atomic<std::size_t> disabledFrame_{SIZE_MAX};
+  // Output of the node for the quantum starting at lastRenderedFrame_.
+  std::shared_ptr<AudioBus> lastRenderedBus_;
+
+  // Nodes calling into a JS runtime are never rendered on a worker thread.
+  bool requiresSerialRender_ = false;
+
+  // Used by AudioNodeManager while building the render list.
+  std::size_t renderListMark_ = 0;
+  std::size_t renderListIndex_ = 0;
 
-  std::size_t lastRenderedFrame_{SIZE_MAX};
+  // Only delay nodes can break a cycle of the graph. A node breaking a cycle
+  // is rendered without its inputs, they are taken after the quantum.
+  bool canBreakCycle_ = false;
+  bool isBreakingCycle_ = false;
 
  private:
-  std::vector<std::shared_ptr<AudioBus>> inputBuses_ = {};
+  // Input buses are owned by the input nodes, they stay valid for the quantum.
+  std::vector<AudioBus *> inputBuses_ = {};
+  // Used to mix inputs whose channel count differs from audioBus_. A view of
+  // the processingBusIndex_ bus of busArena_, unless the arena ran out.
+  std::shared_ptr<AudioBus> processingBus_;
+  // Kept alive by the node, which may outlive the context.
+  std::shared_ptr<AudioBusArena> busArena_;
+  std::size_t processingBusIndex_ = SIZE_MAX;
+  // Frames of the tail left to render, 0 when no tail is being rendered.
+  std::atomic<std::size_t> remainingTailFrames_ = 0;
 
   static std::string toString(ChannelCountMode mode);
   static std::string toString(ChannelInterpretation interpretation);
@@ -71,8 +115,10 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   virtual std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus>&, int) = 0;
 
   bool isAlreadyProcessed();
-  std::shared_ptr<AudioBus> processInputs(const std::shared_ptr<AudioBus>& outputBus, int framesToProcess, bool checkIsAlreadyProcessed);
-  std::shared_ptr<AudioBus> applyChannelCountMode(const std::shared_ptr<AudioBus> &processingBus);
+  const std::shared_ptr<AudioBus> &processInputs(const std::shared_ptr<AudioBus>& outputBus, int framesToProcess, bool checkIsAlreadyProcessed);
+  const std::shared_ptr<AudioBus> &getProcessingBus(int numberOfChannels);
+  void releaseProcessingBus();
+  const std::shared_ptr<AudioBus> &applyChannelCountMode(const std::shared_ptr<AudioBus> &processingBus);
   void mixInputsBuses(const std::shared_ptr<AudioBus>& processingBus);
 
   void connectNode(const std::shared_ptr<AudioNode> &node);
@@ -80,8 +126,12 @@ class AudioNode : public std::enable_shared_from_this<AudioNode> {
   void connectParam(const std::shared_ptr<AudioParam> &param);
   void disconnectParam(const std::shared_ptr<AudioParam> &param);
 
+  // Disables the node, its output is still used in the quantum starting at frame.
+  void disableAtFrame(std::size_t frame);
   void onInputEnabled();
-  void onInputDisabled();
+  void onInputDisabled(std::size_t frame);
+  // Counts the rendered frames of the tail down and disables the node at its end.
+  void advanceTail(int framesToProcess);
   void onInputConnected(AudioNode *node);
   void onInputDisconnected(AudioNode *node);
 
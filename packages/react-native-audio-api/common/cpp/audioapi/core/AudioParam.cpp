@@ -4,6 +4,10 @@
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace audioapi {
 
 AudioParam::AudioParam(
@@ -22,35 +26,69 @@ AudioParam::AudioParam(
           std::make_shared<AudioBus>(
               RENDER_QUANTUM_SIZE,
               1,
-              context->getSampleRate())) {
-  inputBuses_.reserve(4);
-  inputNodes_.reserve(4);
-  startTime_ = 0;
+              context->getSampleRate())),
+      automationArray_(std::make_shared<AudioArray>(RENDER_QUANTUM_SIZE)) {
   endTime_ = 0;
-  startValue_ = value_;
   endValue_ = value_;
-  // Default calculation function just returns the static value
-  calculateValue_ = [this](double, double, float, float, double) {
-    return value_;
-  };
 }
 
 float AudioParam::getValueAtTime(double time) {
+  advanceEvents(time);
+
+  // Calculate value using the current automation segment and clamp to valid
+  setValue(hasCurrentEvent_ ? currentEvent_.getValueAtTime(time) : value_);
+  return value_;
+}
+
+void AudioParam::getValuesAtTime(
+    double time,
+    double timeStep,
+    float *values,
+    size_t length) {
+  size_t offset = 0;
+
+  // Every automation segment overlapping the quantum is computed as a whole.
+  while (offset < length) {
+    auto frameTime = time + static_cast<double>(offset) * timeStep;
+    advanceEvents(frameTime);
+
+    // The current segment lasts until a frame passes its end time while
+    // further events are queued.
+    auto segmentEnd = length;
+    if (!eventsQueue_.isEmpty()) {
+      segmentEnd = offset +
+          ParamChangeEvent::getFirstFrameAtOrAfter(
+                       std::nextafter(
+                           endTime_, std::numeric_limits<double>::infinity()),
+                       frameTime,
+                       timeStep,
+                       length - offset);
+      segmentEnd = std::max(segmentEnd, offset + 1);
+    }
+
+    if (hasCurrentEvent_) {
+      currentEvent_.getValuesAtTime(
+          frameTime, timeStep, values + offset, segmentEnd - offset);
+    } else {
+      dsp::fill(value_, values + offset, segmentEnd - offset);
+    }
+
+    offset = segmentEnd;
+  }
+
+  dsp::clip(values, minValue_, maxValue_, values, length);
+  value_ = values[length - 1];
+}
+
+void AudioParam::advanceEvents(double time) {
   // Check if current automation segment has ended and we need to advance to
   // next event
-  if (endTime_ < time && !eventsQueue_.isEmpty()) {
-    ParamChangeEvent event;
-    eventsQueue_.popFront(event);
-    startTime_ = event.getStartTime();
-    endTime_ = event.getEndTime();
-    startValue_ = event.getStartValue();
-    endValue_ = event.getEndValue();
-    calculateValue_ = std::move(event.getCalculateValue());
+  while (endTime_ < time && !eventsQueue_.isEmpty()) {
+    eventsQueue_.popFront(currentEvent_);
+    endTime_ = currentEvent_.getEndTime();
+    endValue_ = currentEvent_.getEndValue();
+    hasCurrentEvent_ = true;
   }
-
-  // Calculate value using the current automation function and clamp to valid
-  setValue(calculateValue_(startTime_, endTime_, startValue_, endValue_, time));
-  return value_;
 }
 
 void AudioParam::setValueAtTime(float value, double startTime) {
@@ -61,24 +99,11 @@ void AudioParam::setValueAtTime(float value, double startTime) {
     }
 
     // Step function: instant change at startTime
-    auto calculateValue = [](double startTime,
-                             double /* endTime */,
-                             float startValue,
-                             float endValue,
-                             double time) {
-      if (time < startTime) {
-        return startValue;
-      }
-
-      return endValue;
-    };
-
     param.updateQueue(ParamChangeEvent(
         startTime,
         startTime,
         param.getQueueEndValue(),
         value,
-        std::move(calculateValue),
         ParamChangeEventType::SET_VALUE));
   };
   eventScheduler_.scheduleEvent(std::move(event));
@@ -91,32 +116,11 @@ void AudioParam::linearRampToValueAtTime(float value, double endTime) {
       return;
     }
 
-    // Linear interpolation function
-    auto calculateValue = [](double startTime,
-                             double endTime,
-                             float startValue,
-                             float endValue,
-                             double time) {
-      if (time < startTime) {
-        return startValue;
-      }
-
-      if (time < endTime) {
-        return static_cast<float>(
-            startValue +
-            (endValue - startValue) * (time - startTime) /
-                (endTime - startTime));
-      }
-
-      return endValue;
-    };
-
     param.updateQueue(ParamChangeEvent(
         param.getQueueEndTime(),
         endTime,
         param.getQueueEndValue(),
         value,
-        std::move(calculateValue),
         ParamChangeEventType::LINEAR_RAMP));
   };
   eventScheduler_.scheduleEvent(std::move(event));
@@ -128,32 +132,11 @@ void AudioParam::exponentialRampToValueAtTime(float value, double endTime) {
       return;
     }
 
-    // Exponential curve function using power law
-    auto calculateValue = [](double startTime,
-                             double endTime,
-                             float startValue,
-                             float endValue,
-                             double time) {
-      if (time < startTime) {
-        return startValue;
-      }
-
-      if (time < endTime) {
-        return static_cast<float>(
-            startValue *
-            pow(endValue / startValue,
-                (time - startTime) / (endTime - startTime)));
-      }
-
-      return endValue;
-    };
-
     param.updateQueue(ParamChangeEvent(
         param.getQueueEndTime(),
         endTime,
         param.getQueueEndValue(),
         value,
-        std::move(calculateValue),
         ParamChangeEventType::EXPONENTIAL_RAMP));
   };
   eventScheduler_.scheduleEvent(std::move(event));
@@ -167,26 +150,17 @@ void AudioParam::setTargetAtTime(
     if (startTime <= param.getQueueEndTime()) {
       return;
     }
-    // Exponential decay function towards target value
-    auto calculateValue =
-        [timeConstant, target](
-            double startTime, double, float startValue, float, double time) {
-          if (time < startTime) {
-            return startValue;
-          }
-
-          return static_cast<float>(
-              target +
-              (startValue - target) * exp(-(time - startTime) / timeConstant));
-        };
-    param.updateQueue(ParamChangeEvent(
+
+    // Exponential decay towards target value
+    ParamChangeEvent paramChangeEvent(
         startTime,
         startTime, // SetTarget events have infinite duration conceptually
         param.getQueueEndValue(),
         param.getQueueEndValue(), // End value is not meaningful for
                                   // infinite events
-        std::move(calculateValue),
-        ParamChangeEventType::SET_TARGET));
+        ParamChangeEventType::SET_TARGET);
+    paramChangeEvent.setTarget(target, timeConstant);
+    param.updateQueue(std::move(paramChangeEvent));
   };
 
   eventScheduler_.scheduleEvent(std::move(event));
@@ -202,39 +176,14 @@ void AudioParam::setValueCurveAtTime(
       return;
     }
 
-    auto calculateValue = [values, length](
-                              double startTime,
-                              double endTime,
-                              float startValue,
-                              float endValue,
-                              double time) {
-      if (time < startTime) {
-        return startValue;
-      }
-
-      if (time < endTime) {
-        // Calculate position in the array based on time progress
-        auto k = static_cast<int>(std::floor(
-            static_cast<double>(length - 1) / (endTime - startTime) *
-            (time - startTime)));
-        // Calculate interpolation factor between adjacent array elements
-        auto factor = static_cast<float>(
-            (time - startTime) * static_cast<double>(length - 1) /
-                (endTime - startTime) -
-            k);
-        return dsp::linearInterpolate(values->data(), k, k + 1, factor);
-      }
-
-      return endValue;
-    };
-
-    param.updateQueue(ParamChangeEvent(
+    ParamChangeEvent paramChangeEvent(
         startTime,
         startTime + duration,
         param.getQueueEndValue(),
         values->at(length - 1),
-        std::move(calculateValue),
-        ParamChangeEventType::SET_VALUE_CURVE));
+        ParamChangeEventType::SET_VALUE_CURVE);
+    paramChangeEvent.setCurve(values, length);
+    param.updateQueue(std::move(paramChangeEvent));
   };
 
   /// Schedules an event that modifies this param
@@ -255,6 +204,7 @@ void AudioParam::cancelAndHoldAtTime(double cancelTime) {
 }
 
 void AudioParam::addInputNode(AudioNode *node) {
+  // within the capacity reserved for the connection
   inputNodes_.emplace_back(node);
 }
 
@@ -263,12 +213,13 @@ void AudioParam::removeInputNode(AudioNode *node) {
     if (inputNodes_[i] == node) {
       std::swap(inputNodes_[i], inputNodes_.back());
       inputNodes_.resize(inputNodes_.size() - 1);
+      numberOfConnections_.fetch_sub(1, std::memory_order_relaxed);
       break;
     }
   }
 }
 
-std::shared_ptr<AudioBus> AudioParam::calculateInputs(
+const std::shared_ptr<AudioBus> &AudioParam::calculateInputs(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess) {
   processingBus->zero();
@@ -280,35 +231,61 @@ std::shared_ptr<AudioBus> AudioParam::calculateInputs(
   return processingBus;
 }
 
-std::shared_ptr<AudioBus> AudioParam::processARateParam(
+const std::shared_ptr<AudioBus> &AudioParam::processARateParam(
     int framesToProcess,
     double time) {
   processScheduledEvents();
-  auto processingBus = calculateInputs(audioBus_, framesToProcess);
+  const auto &processingBus = calculateInputs(audioBus_, framesToProcess);
 
-  float sampleRate = context_->getSampleRate();
   float *busData = processingBus->getChannel(0)->getData();
-  float timeCache = time;
-  float timeStep = 1.0f / sampleRate;
-  float sample = 0.0f;
+  auto timeStep = 1.0 / context_->getSampleRate();
 
   // Add automated parameter value to each sample
-  for (size_t i = 0; i < framesToProcess; i++, timeCache += timeStep) {
-    sample = getValueAtTime(timeCache);
-    busData[i] += sample;
+  if (inputNodes_.empty()) {
+    getValuesAtTime(time, timeStep, busData, framesToProcess);
+  } else {
+    auto *values = automationArray_->getData();
+    getValuesAtTime(time, timeStep, values, framesToProcess);
+    dsp::add(busData, values, busData, framesToProcess);
   }
+
   // processingBus is a mono bus containing per-sample parameter values
   return processingBus;
 }
 
 float AudioParam::processKRateParam(int framesToProcess, double time) {
   processScheduledEvents();
-  auto processingBus = calculateInputs(audioBus_, framesToProcess);
+
+  if (inputNodes_.empty()) {
+    return getValueAtTime(time);
+  }
+
+  const auto &processingBus = calculateInputs(audioBus_, framesToProcess);
 
   // Return block-rate parameter value plus first sample of input modulation
   return processingBus->getChannel(0)->getData()[0] + getValueAtTime(time);
 }
 
+bool AudioParam::isConstant(int framesToProcess, double time) {
+  if (!inputNodes_.empty()) {
+    return false;
+  }
+
+  processScheduledEvents();
+  advanceEvents(time);
+
+  auto lastFrameTime = time +
+      static_cast<double>(framesToProcess - 1) / context_->getSampleRate();
+
+  // A queued event takes over within the quantum.
+  if (!eventsQueue_.isEmpty() && endTime_ < lastFrameTime) {
+    return false;
+  }
+
+  return !hasCurrentEvent_ ||
+      currentEvent_.isConstantBetween(time, lastFrameTime);
+}
+
 void AudioParam::processInputs(
     const std::shared_ptr<AudioBus> &outputBus,
     int framesToProcess,
@@ -318,14 +295,14 @@ void AudioParam::processInputs(
     auto inputNode = *it;
     assert(inputNode != nullptr);
 
-    if (!inputNode->isEnabled()) {
+    if (!inputNode->isActive()) {
       continue;
     }
 
     // Process this input node and store its output bus
-    auto inputBus = inputNode->processAudio(
+    const auto &inputBus = inputNode->processAudio(
         outputBus, framesToProcess, checkIsAlreadyProcessed);
-    inputBuses_.emplace_back(inputBus);
+    inputBuses_.emplace_back(inputBus.get());
   }
 }
 
@@ -334,9 +311,8 @@ void AudioParam::mixInputsBuses(
   assert(processingBus != nullptr);
 
   // Sum all input buses into the processing bus
-  for (auto it = inputBuses_.begin(), end = inputBuses_.end(); it != end;
-       ++it) {
-    processingBus->sum(it->get(), ChannelInterpretation::SPEAKERS);
+  for (auto *inputBus : inputBuses_) {
+    processingBus->sum(inputBus, ChannelInterpretation::SPEAKERS);
   }
 
   // Clear for next processing cycle
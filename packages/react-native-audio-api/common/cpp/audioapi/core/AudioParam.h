@@ -6,6 +6,7 @@
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/utils/AudioParamEventQueue.h>
 
+#include <atomic>
 #include <cstddef>
 #include <utility>
 #include <memory>
@@ -83,12 +84,21 @@ class AudioParam {
   void removeInputNode(AudioNode* node);
 
   // Audio-Thread only
-  std::shared_ptr<AudioBus> processARateParam(int framesToProcess, double time);
+  const std::shared_ptr<AudioBus> &processARateParam(int framesToProcess, double time);
 
   // Audio-Thread only
   float processKRateParam(int framesToProcess, double time);
 
+  /// @brief Checks if the param holds a single value for the whole render quantum.
+  /// @note It is the case when no node is connected to the param and no automation changes the value within the quantum.
+  /// processKRateParam then returns that value, so per-frame values do not have to be computed.
+  // Audio-Thread only
+  bool isConstant(int framesToProcess, double time);
+
  private:
+  friend class AudioNode;
+  friend class AudioNodeManager;
+
   // Core parameter state
   BaseAudioContext *context_;
   float value_;
@@ -100,16 +110,25 @@ class AudioParam {
   CrossThreadEventScheduler<AudioParam> eventScheduler_;
 
   // Current automation state (cached for performance)
-  double startTime_;
   double endTime_;
-  float startValue_;
   float endValue_;
-  std::function<float(double, double, float, float, double)> calculateValue_;
+  // Segment being rendered, value_ is used until the first event is reached.
+  ParamChangeEvent currentEvent_;
+  bool hasCurrentEvent_ = false;
 
-  // Input modulation system
+  // Input modulation system, the lists are reserved by AudioNodeManager on the
+  // JS thread, so connecting a node does not reallocate them.
   std::vector<AudioNode *> inputNodes_;
   std::shared_ptr<AudioBus> audioBus_;
-  std::vector<std::shared_ptr<AudioBus>> inputBuses_;
+  // Input buses are owned by the input nodes, they stay valid for the quantum.
+  std::vector<AudioBus *> inputBuses_;
+  // Automation values, used only when input modulation has to be added.
+  std::shared_ptr<AudioArray> automationArray_;
+  // Connections requested on the JS thread and not yet removed by the audio
+  // thread, see AudioNode::numberOfConnections_.
+  std::atomic<std::size_t> numberOfConnections_ = 0;
+  // Number of connections the input lists are reserved for, JS thread only.
+  std::size_t connectionCapacity_ = 0;
 
   /// @brief Get the end time of the parameter queue.
   /// @return The end time of the parameter queue or last endTime_ if queue is empty.
@@ -141,9 +160,11 @@ class AudioParam {
     eventsQueue_.pushBack(std::move(event));
   }
   float getValueAtTime(double time);
+  void getValuesAtTime(double time, double timeStep, float *values, size_t length);
+  void advanceEvents(double time);
   void processInputs(const std::shared_ptr<AudioBus>& outputBus, int framesToProcess, bool checkIsAlreadyProcessed);
   void mixInputsBuses(const std::shared_ptr<AudioBus>& processingBus);
-  std::shared_ptr<AudioBus> calculateInputs(const std::shared_ptr<AudioBus>& processingBus, int framesToProcess);
+  const std::shared_ptr<AudioBus> &calculateInputs(const std::shared_ptr<AudioBus>& processingBus, int framesToProcess);
 };
 
 } // namespace audioapi
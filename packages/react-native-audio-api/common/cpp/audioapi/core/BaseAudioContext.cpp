@@ -1,8 +1,12 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/analysis/AnalyserNode.h>
+#include <audioapi/core/analysis/AudioMeterNode.h>
 #include <audioapi/core/destinations/AudioDestinationNode.h>
 #include <audioapi/core/effects/BiquadFilterNode.h>
+#include <audioapi/core/effects/ConvolverNode.h>
+#include <audioapi/core/effects/DelayNode.h>
 #include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/effects/ParametricEQNode.h>
 #include <audioapi/core/effects/StereoPannerNode.h>
 #include <audioapi/core/effects/WorkletNode.h>
 #include <audioapi/core/effects/WorkletProcessingNode.h>
@@ -13,14 +17,20 @@
 #include <audioapi/core/sources/OscillatorNode.h>
 #include <audioapi/core/sources/RecorderAdapterNode.h>
 #include <audioapi/core/sources/StreamerNode.h>
+#include <audioapi/core/sources/StreamingAudioBuffer.h>
+#include <audioapi/core/sources/StreamingBufferSourceNode.h>
 #include <audioapi/core/sources/WorkletSourceNode.h>
 #include <audioapi/core/utils/AudioDecoder.h>
 #include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/AudioStreamDecoder.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/AudioBusArena.h>
 #include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/RenderWorkerPool.hpp>
 
 namespace audioapi {
 
@@ -139,6 +149,25 @@ std::shared_ptr<BiquadFilterNode> BaseAudioContext::createBiquadFilter() {
   return biquadFilter;
 }
 
+std::shared_ptr<ParametricEQNode> BaseAudioContext::createParametricEQ(
+    int numberOfBands) {
+  auto parametricEQ = std::make_shared<ParametricEQNode>(this, numberOfBands);
+  nodeManager_->addProcessingNode(parametricEQ);
+  return parametricEQ;
+}
+
+std::shared_ptr<ConvolverNode> BaseAudioContext::createConvolver() {
+  auto convolver = std::make_shared<ConvolverNode>(this);
+  nodeManager_->addProcessingNode(convolver);
+  return convolver;
+}
+
+std::shared_ptr<DelayNode> BaseAudioContext::createDelay(float maxDelayTime) {
+  auto delay = std::make_shared<DelayNode>(this, maxDelayTime);
+  nodeManager_->addProcessingNode(delay);
+  return delay;
+}
+
 std::shared_ptr<AudioBufferSourceNode> BaseAudioContext::createBufferSource(
     bool pitchCorrection) {
   auto bufferSource =
@@ -155,6 +184,14 @@ BaseAudioContext::createBufferQueueSource(bool pitchCorrection) {
   return bufferSource;
 }
 
+std::shared_ptr<StreamingBufferSourceNode>
+BaseAudioContext::createStreamingBufferSource(bool pitchCorrection) {
+  auto bufferSource =
+      std::make_shared<StreamingBufferSourceNode>(this, pitchCorrection);
+  nodeManager_->addSourceNode(bufferSource);
+  return bufferSource;
+}
+
 std::shared_ptr<AudioBuffer> BaseAudioContext::createBuffer(
     int numberOfChannels,
     size_t length,
@@ -176,14 +213,33 @@ std::shared_ptr<AnalyserNode> BaseAudioContext::createAnalyser() {
   return analyser;
 }
 
+std::shared_ptr<AudioMeterNode> BaseAudioContext::createAudioMeter(
+    int numberOfBands) {
+  auto audioMeter = std::make_shared<AudioMeterNode>(this, numberOfBands);
+  nodeManager_->addProcessingNode(audioMeter);
+  return audioMeter;
+}
+
 std::shared_ptr<AudioBuffer> BaseAudioContext::decodeAudioDataSource(
     const std::string &path) {
+  auto decodedAudioCache = getDecodedAudioCache();
+
+  if (decodedAudioCache) {
+    if (auto audioBus = decodedAudioCache->load(path, sampleRate_)) {
+      return std::make_shared<AudioBuffer>(audioBus);
+    }
+  }
+
   auto audioBus = audioDecoder_->decodeWithFilePath(path);
 
   if (!audioBus) {
     return nullptr;
   }
 
+  if (decodedAudioCache) {
+    decodedAudioCache->store(path, *audioBus);
+  }
+
   return std::make_shared<AudioBuffer>(audioBus);
 }
 
@@ -211,10 +267,44 @@ std::shared_ptr<AudioBuffer> BaseAudioContext::decodeWithPCMInBase64(
   return std::make_shared<AudioBuffer>(audioBus);
 }
 
+std::shared_ptr<StreamingAudioBuffer> BaseAudioContext::streamAudioDataSource(
+    const std::string &path) {
+  auto decoder = audioDecoder_->openFileStream(path);
+
+  if (!decoder) {
+    return nullptr;
+  }
+
+  return std::make_shared<StreamingAudioBuffer>(std::move(decoder));
+}
+
+void BaseAudioContext::setDecodedAudioCacheDirectory(
+    const std::string &directory) {
+  auto decodedAudioCache = directory.empty()
+      ? nullptr
+      : std::make_shared<DecodedAudioCache>(directory);
+
+  std::lock_guard lock(decodedAudioCacheMutex_);
+  decodedAudioCache_ = std::move(decodedAudioCache);
+}
+
+std::shared_ptr<DecodedAudioCache> BaseAudioContext::getDecodedAudioCache() {
+  std::lock_guard lock(decodedAudioCacheMutex_);
+  return decodedAudioCache_;
+}
+
 AudioNodeManager *BaseAudioContext::getNodeManager() {
   return nodeManager_.get();
 }
 
+std::shared_ptr<AudioBusArena> BaseAudioContext::getBusArena() {
+  return busArena_;
+}
+
+RenderWorkerPool *BaseAudioContext::getRenderWorkerPool() {
+  return renderWorkerPool_.get();
+}
+
 bool BaseAudioContext::isRunning() const {
   return state_ == ContextState::RUNNING && isDriverRunning();
 }
@@ -227,6 +317,10 @@ bool BaseAudioContext::isClosed() const {
   return state_ == ContextState::CLOSED;
 }
 
+bool BaseAudioContext::isRealtime() const {
+  return isRealtime_;
+}
+
 float BaseAudioContext::getNyquistFrequency() const {
   return sampleRate_ / 2.0f;
 }
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,6 +17,8 @@
 namespace audioapi {
 
 class AudioBus;
+class AudioBusArena;
+class RenderWorkerPool;
 class GainNode;
 class AudioBuffer;
 class PeriodicWave;
@@ -24,11 +27,18 @@ class ConstantSourceNode;
 class StereoPannerNode;
 class AudioNodeManager;
 class BiquadFilterNode;
+class ConvolverNode;
+class DelayNode;
+class ParametricEQNode;
 class AudioDestinationNode;
 class AudioBufferSourceNode;
 class AudioBufferQueueSourceNode;
+class StreamingBufferSourceNode;
+class StreamingAudioBuffer;
+class DecodedAudioCache;
 class AudioDecoder;
 class AnalyserNode;
+class AudioMeterNode;
 class AudioEventHandlerRegistry;
 class IAudioEventHandlerRegistry;
 class RecorderAdapterNode;
@@ -58,8 +68,12 @@ class BaseAudioContext {
   std::shared_ptr<GainNode> createGain();
   std::shared_ptr<StereoPannerNode> createStereoPanner();
   std::shared_ptr<BiquadFilterNode> createBiquadFilter();
+  std::shared_ptr<ParametricEQNode> createParametricEQ(int numberOfBands);
+  std::shared_ptr<ConvolverNode> createConvolver();
+  std::shared_ptr<DelayNode> createDelay(float maxDelayTime);
   std::shared_ptr<AudioBufferSourceNode> createBufferSource(bool pitchCorrection);
   std::shared_ptr<AudioBufferQueueSourceNode> createBufferQueueSource(bool pitchCorrection);
+  std::shared_ptr<StreamingBufferSourceNode> createStreamingBufferSource(bool pitchCorrection);
   static std::shared_ptr<AudioBuffer>
   createBuffer(int numberOfChannels, size_t length, float sampleRate);
   std::shared_ptr<PeriodicWave> createPeriodicWave(
@@ -67,18 +81,27 @@ class BaseAudioContext {
       bool disableNormalization,
       int length);
   std::shared_ptr<AnalyserNode> createAnalyser();
+  std::shared_ptr<AudioMeterNode> createAudioMeter(int numberOfBands);
 
   std::shared_ptr<AudioBuffer> decodeAudioDataSource(const std::string &path);
   std::shared_ptr<AudioBuffer> decodeAudioData(const void *data, size_t size);
   std::shared_ptr<AudioBuffer> decodeWithPCMInBase64(const std::string &data, float playbackSpeed);
+  std::shared_ptr<StreamingAudioBuffer> streamAudioDataSource(const std::string &path);
+  // Files decoded by decodeAudioDataSource are cached in the directory and memory mapped on later loads,
+  // an empty directory disables the cache.
+  void setDecodedAudioCacheDirectory(const std::string &directory);
 
   std::shared_ptr<PeriodicWave> getBasicWaveForm(OscillatorType type);
   [[nodiscard]] float getNyquistFrequency() const;
   AudioNodeManager *getNodeManager();
+  std::shared_ptr<AudioBusArena> getBusArena();
+  RenderWorkerPool *getRenderWorkerPool();
 
   [[nodiscard]] bool isRunning() const;
   [[nodiscard]] bool isSuspended() const;
   [[nodiscard]] bool isClosed() const;
+  // false for contexts rendering faster than real time, where work can not be deferred to background threads
+  [[nodiscard]] bool isRealtime() const;
 
  protected:
   static std::string toString(ContextState state);
@@ -90,6 +113,12 @@ class BaseAudioContext {
   float sampleRate_ {};
   ContextState state_ = ContextState::RUNNING;
   std::shared_ptr<AudioNodeManager> nodeManager_;
+  // init in AudioContext or OfflineContext constructor
+  std::shared_ptr<AudioBusArena> busArena_ {};
+  // init in AudioContext or OfflineContext constructor
+  bool isRealtime_ {};
+  // set only by contexts rendering in real time, nullptr renders serially
+  std::shared_ptr<RenderWorkerPool> renderWorkerPool_ {};
 
  private:
   std::shared_ptr<PeriodicWave> cachedSineWave_ = nullptr;
@@ -97,6 +126,12 @@ class BaseAudioContext {
   std::shared_ptr<PeriodicWave> cachedSawtoothWave_ = nullptr;
   std::shared_ptr<PeriodicWave> cachedTriangleWave_ = nullptr;
 
+  // set on the JS thread, used by the decoding threads
+  std::mutex decodedAudioCacheMutex_;
+  std::shared_ptr<DecodedAudioCache> decodedAudioCache_ = nullptr;
+
+  [[nodiscard]] std::shared_ptr<DecodedAudioCache> getDecodedAudioCache();
+
   [[nodiscard]] virtual bool isDriverRunning() const = 0;
 
  public:
@@ -9,6 +9,7 @@
 #include <audioapi/core/utils/Locker.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/AudioBusArena.h>
 
 #include <algorithm>
 #include <cassert>
@@ -31,6 +32,8 @@ OfflineAudioContext::OfflineAudioContext(
       currentSampleFrame_(0) {
   sampleRate_ = sampleRate;
   audioDecoder_ = std::make_shared<AudioDecoder>(sampleRate_);
+  busArena_ = std::make_shared<AudioBusArena>(sampleRate_);
+  isRealtime_ = false;
   resultBus_ = std::make_shared<AudioBus>(
       static_cast<int>(length_), numberOfChannels_, sampleRate_);
 }
@@ -1,40 +1,70 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/analysis/AnalyserNode.h>
+#include <audioapi/core/utils/Constants.h>
 #include <audioapi/dsp/AudioUtils.h>
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/dsp/Windows.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 #include <audioapi/utils/CircularAudioArray.h>
+#include <audioapi/utils/SpscAudioRing.h>
+
+#include <chrono>
+#include <cstring>
+#include <limits>
 
 namespace audioapi {
 AnalyserNode::AnalyserNode(audioapi::BaseAudioContext *context)
     : AudioNode(context),
       fftSize_(2048),
+      smoothingTimeConstant_(0.8),
+      windowType_(WindowType::BLACKMAN),
+      analysisInterval_(ANALYSER_DEFAULT_ANALYSIS_INTERVAL),
       minDecibels_(-100),
       maxDecibels_(-30),
-      smoothingTimeConstant_(0.8),
-      windowType_(WindowType::BLACKMAN) {
-  inputBuffer_ = std::make_unique<CircularAudioArray>(MAX_FFT_SIZE * 2);
-  tempBuffer_ = std::make_unique<AudioArray>(fftSize_);
-  magnitudeBuffer_ = std::make_unique<AudioArray>(fftSize_ / 2);
+      snapshots_(Snapshot{
+          std::vector<float>(2048),
+          std::vector<float>(1024, -std::numeric_limits<float>::infinity())}),
+      analysisFftSize_(2048),
+      analysisWindowType_(WindowType::BLACKMAN) {
+  inputRing_ = std::make_unique<SpscAudioRing>(1, MAX_FFT_SIZE * 2);
   downMixBus_ = std::make_unique<AudioBus>(
       RENDER_QUANTUM_SIZE, 1, context_->getSampleRate());
 
-  fft_ = std::make_unique<dsp::FFT>(fftSize_);
-  complexData_ = std::vector<std::complex<float>>(fftSize_);
+  ringReadBus_ = std::make_unique<AudioBus>(
+      RENDER_QUANTUM_SIZE * 8, 1, context_->getSampleRate());
+  inputBuffer_ = std::make_unique<CircularAudioArray>(MAX_FFT_SIZE * 2);
+  tempBuffer_ = std::make_unique<AudioArray>(analysisFftSize_);
+  magnitudeBuffer_ = std::make_unique<AudioArray>(analysisFftSize_ / 2);
+
+  fft_ = std::make_unique<dsp::FFT>(analysisFftSize_);
+  complexData_ = std::vector<std::complex<float>>(analysisFftSize_);
 
-  setWindowData(windowType_, fftSize_);
+  setWindowData(analysisWindowType_, analysisFftSize_);
 
   isInitialized_ = true;
+
+  analysisThread_ = std::thread(&AnalyserNode::runAnalysisLoop, this);
+}
+
+AnalyserNode::~AnalyserNode() {
+  {
+    std::lock_guard lock(analysisMutex_);
+    isAnalysing_ = false;
+  }
+  analysisCondition_.notify_one();
+
+  if (analysisThread_.joinable()) {
+    analysisThread_.join();
+  }
 }
 
 int AnalyserNode::getFftSize() const {
-  return fftSize_;
+  return fftSize_.load(std::memory_order_relaxed);
 }
 
 int AnalyserNode::getFrequencyBinCount() const {
-  return fftSize_ / 2;
+  return getFftSize() / 2;
 }
 
 float AnalyserNode::getMinDecibels() const {
@@ -46,24 +76,19 @@ float AnalyserNode::getMaxDecibels() const {
 }
 
 float AnalyserNode::getSmoothingTimeConstant() const {
-  return smoothingTimeConstant_;
+  return smoothingTimeConstant_.load(std::memory_order_relaxed);
 }
 
 std::string AnalyserNode::getWindowType() const {
-  return AnalyserNode::toString(windowType_);
+  return AnalyserNode::toString(windowType_.load(std::memory_order_relaxed));
 }
 
-void AnalyserNode::setFftSize(int fftSize) {
-  if (fftSize_ == fftSize) {
-    return;
-  }
+int AnalyserNode::getAnalysisInterval() const {
+  return analysisInterval_.load(std::memory_order_relaxed);
+}
 
-  fftSize_ = fftSize;
-  fft_ = std::make_unique<dsp::FFT>(fftSize_);
-  complexData_ = std::vector<std::complex<float>>(fftSize_);
-  magnitudeBuffer_ = std::make_unique<AudioArray>(fftSize_ / 2);
-  tempBuffer_ = std::make_unique<AudioArray>(fftSize_);
-  setWindowData(windowType_, fftSize_);
+void AnalyserNode::setFftSize(int fftSize) {
+  fftSize_.store(fftSize, std::memory_order_relaxed);
 }
 
 void AnalyserNode::setMinDecibels(float minDecibels) {
@@ -75,35 +100,40 @@ void AnalyserNode::setMaxDecibels(float maxDecibels) {
 }
 
 void AnalyserNode::setSmoothingTimeConstant(float smoothingTimeConstant) {
-  smoothingTimeConstant_ = smoothingTimeConstant;
+  smoothingTimeConstant_.store(
+      smoothingTimeConstant, std::memory_order_relaxed);
 }
 
 void AnalyserNode::setWindowType(const std::string &type) {
-  setWindowData(windowType_, fftSize_);
-  windowType_ = AnalyserNode::fromString(type);
+  windowType_.store(
+      AnalyserNode::fromString(type), std::memory_order_relaxed);
+}
+
+void AnalyserNode::setAnalysisInterval(int interval) {
+  analysisInterval_.store(std::max(interval, 1), std::memory_order_relaxed);
 }
 
 void AnalyserNode::getFloatFrequencyData(float *data, int length) {
-  doFFTAnalysis();
+  snapshots_.update();
+  const auto &frequencyData = snapshots_.getReadBuffer().frequencyData;
 
-  length = std::min(static_cast<int>(magnitudeBuffer_->getSize()), length);
-  dsp::linearToDecibels(magnitudeBuffer_->getData(), data, length);
+  length = std::min(static_cast<int>(frequencyData.size()), length);
+  std::memcpy(data, frequencyData.data(), length * sizeof(float));
 }
 
 void AnalyserNode::getByteFrequencyData(uint8_t *data, int length) {
-  doFFTAnalysis();
+  snapshots_.update();
+  const auto &frequencyData = snapshots_.getReadBuffer().frequencyData;
 
-  auto magnitudeBufferData = magnitudeBuffer_->getData();
-  length = std::min(static_cast<int>(magnitudeBuffer_->getSize()), length);
+  length = std::min(static_cast<int>(frequencyData.size()), length);
 
   const auto rangeScaleFactor =
       maxDecibels_ == minDecibels_ ? 1 : 1 / (maxDecibels_ - minDecibels_);
 
   for (int i = 0; i < length; i++) {
-    auto dbMag = magnitudeBufferData[i] == 0
-        ? minDecibels_
-        : dsp::linearToDecibels(magnitudeBufferData[i]);
-    auto scaledValue = UINT8_MAX * (dbMag - minDecibels_) * rangeScaleFactor;
+    // silent bins are -Infinity and end up clamped to 0
+    auto scaledValue =
+        UINT8_MAX * (frequencyData[i] - minDecibels_) * rangeScaleFactor;
 
     if (scaledValue < 0) {
       scaledValue = 0;
@@ -117,18 +147,21 @@ void AnalyserNode::getByteFrequencyData(uint8_t *data, int length) {
 }
 
 void AnalyserNode::getFloatTimeDomainData(float *data, int length) {
-  auto size = std::min(fftSize_, length);
-  inputBuffer_->pop_back(data, size, std::max(0, fftSize_ - size), true);
+  snapshots_.update();
+  const auto &timeDomainData = snapshots_.getReadBuffer().timeDomainData;
+
+  auto size = std::min(static_cast<int>(timeDomainData.size()), length);
+  std::memcpy(data, timeDomainData.data(), size * sizeof(float));
 }
 
 void AnalyserNode::getByteTimeDomainData(uint8_t *data, int length) {
-  auto size = std::min(fftSize_, length);
+  snapshots_.update();
+  const auto &timeDomainData = snapshots_.getReadBuffer().timeDomainData;
 
-  inputBuffer_->pop_back(
-      tempBuffer_->getData(), fftSize_, std::max(0, fftSize_ - size), true);
+  auto size = std::min(static_cast<int>(timeDomainData.size()), length);
 
   for (int i = 0; i < size; i++) {
-    auto value = tempBuffer_->getData()[i];
+    auto value = timeDomainData[i];
 
     float scaledValue = 128 * (value + 1);
 
@@ -151,31 +184,74 @@ std::shared_ptr<AudioBus> AnalyserNode::processNode(
 
   // Down mix the input bus to mono
   downMixBus_->copy(processingBus.get());
-  // Copy the down mixed bus to the input buffer (circular buffer)
-  inputBuffer_->push_back(
-      downMixBus_->getChannel(0)->getData(), framesToProcess, true);
-
-  shouldDoFFTAnalysis_ = true;
+  // Hand the down mixed frames to the analysis thread, if it falls behind by
+  // the whole ring the newest frames are dropped.
+  const float *source[] = {downMixBus_->getChannel(0)->getData()};
+  inputRing_->write(source, framesToProcess);
 
   return processingBus;
 }
 
+void AnalyserNode::runAnalysisLoop() {
+  std::unique_lock lock(analysisMutex_);
+
+  while (isAnalysing_) {
+    auto interval = std::chrono::milliseconds(
+        analysisInterval_.load(std::memory_order_relaxed));
+    if (analysisCondition_.wait_for(
+            lock, interval, [this]() { return !isAnalysing_; })) {
+      break;
+    }
+
+    lock.unlock();
+    doFFTAnalysis();
+    lock.lock();
+  }
+}
+
 void AnalyserNode::doFFTAnalysis() {
-  if (!shouldDoFFTAnalysis_) {
+  size_t framesRead = 0;
+  size_t frames = 0;
+  while ((frames = inputRing_->read(
+              ringReadBus_.get(), 0, ringReadBus_->getSize())) > 0) {
+    inputBuffer_->push_back(
+        ringReadBus_->getChannel(0)->getData(), frames, true);
+    framesRead += frames;
+  }
+
+  auto fftSize = fftSize_.load(std::memory_order_relaxed);
+  auto windowType = windowType_.load(std::memory_order_relaxed);
+
+  // nothing changed since the previous analysis, its snapshot is up to date
+  if (framesRead == 0 && fftSize == analysisFftSize_ &&
+      windowType == analysisWindowType_) {
     return;
   }
 
-  shouldDoFFTAnalysis_ = false;
+  if (fftSize != analysisFftSize_) {
+    analysisFftSize_ = fftSize;
+    fft_ = std::make_unique<dsp::FFT>(fftSize);
+    complexData_ = std::vector<std::complex<float>>(fftSize);
+    magnitudeBuffer_ = std::make_unique<AudioArray>(fftSize / 2);
+    tempBuffer_ = std::make_unique<AudioArray>(fftSize);
+    setWindowData(windowType, fftSize);
+  } else if (windowType != analysisWindowType_) {
+    setWindowData(windowType, fftSize);
+  }
+
+  auto &snapshot = snapshots_.getWriteBuffer();
+  snapshot.timeDomainData.resize(fftSize);
+  snapshot.frequencyData.resize(fftSize / 2);
 
-  // We want to copy last fftSize_ elements added to the input buffer to apply
-  // the window.
-  inputBuffer_->pop_back(tempBuffer_->getData(), fftSize_, 0, true);
+  // We want to copy last fftSize elements added to the input buffer, the
+  // window is applied to a copy of them.
+  inputBuffer_->pop_back(snapshot.timeDomainData.data(), fftSize, 0, true);
 
   dsp::multiply(
-      tempBuffer_->getData(),
+      snapshot.timeDomainData.data(),
       windowData_->getData(),
       tempBuffer_->getData(),
-      fftSize_);
+      fftSize);
 
   // do fft analysis - get frequency domain data
   fft_->doFFT(tempBuffer_->getData(), complexData_);
@@ -183,29 +259,36 @@ void AnalyserNode::doFFTAnalysis() {
   // Zero out nquist component
   complexData_[0] = std::complex<float>(complexData_[0].real(), 0);
 
-  const float magnitudeScale = 1.0f / static_cast<float>(fftSize_);
+  const float magnitudeScale = 1.0f / static_cast<float>(fftSize);
+  const auto smoothingTimeConstant =
+      smoothingTimeConstant_.load(std::memory_order_relaxed);
   auto magnitudeBufferData = magnitudeBuffer_->getData();
 
   for (int i = 0; i < magnitudeBuffer_->getSize(); i++) {
     auto scalarMagnitude = std::abs(complexData_[i]) * magnitudeScale;
     magnitudeBufferData[i] = static_cast<float>(
-        smoothingTimeConstant_ * magnitudeBufferData[i] +
-        (1 - smoothingTimeConstant_) * scalarMagnitude);
+        smoothingTimeConstant * magnitudeBufferData[i] +
+        (1 - smoothingTimeConstant) * scalarMagnitude);
   }
+
+  dsp::linearToDecibels(
+      magnitudeBufferData,
+      snapshot.frequencyData.data(),
+      magnitudeBuffer_->getSize());
+
+  snapshots_.publish();
 }
 
 void AnalyserNode::setWindowData(
     audioapi::AnalyserNode::WindowType type,
     int size) {
-  if (windowType_ == type && windowData_ && windowData_->getSize() == size) {
-    return;
-  }
-
   if (!windowData_ || windowData_->getSize() != size) {
     windowData_ = std::make_shared<AudioArray>(size);
   }
 
-  switch (windowType_) {
+  analysisWindowType_ = type;
+
+  switch (type) {
     case WindowType::BLACKMAN:
       dsp::Blackman().apply(
           windowData_->getData(), static_cast<int>(windowData_->getSize()));
@@ -2,11 +2,16 @@
 
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/dsp/FFT.h>
+#include <audioapi/utils/TripleBuffer.hpp>
 
 #include <memory>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <mutex>
 #include <string>
 #include <complex>
+#include <thread>
 #include <vector>
 
 namespace audioapi {
@@ -14,11 +19,17 @@ namespace audioapi {
 class AudioBus;
 class AudioArray;
 class CircularAudioArray;
+class SpscAudioRing;
 
+/// @brief Exposes the time-domain and frequency data of its input, which it passes through unchanged.
+/// @note The audio thread only copies the input to a lock-free ring. A background analysis thread reads it
+/// every analysisInterval, runs the FFT and publishes a snapshot of both kinds of data through a triple buffer.
+/// Getters called from JS take the latest snapshot and copy it, they never run the FFT and never wait.
 class AnalyserNode : public AudioNode {
  public:
   enum class WindowType { BLACKMAN, HANN };
   explicit AnalyserNode(BaseAudioContext *context);
+  ~AnalyserNode() override;
 
   int getFftSize() const;
   int getFrequencyBinCount() const;
@@ -26,12 +37,14 @@ class AnalyserNode : public AudioNode {
   float getMaxDecibels() const;
   float getSmoothingTimeConstant() const;
   std::string getWindowType() const;
+  int getAnalysisInterval() const;
 
   void setFftSize(int fftSize);
   void setMinDecibels(float minDecibels);
   void setMaxDecibels(float maxDecibels);
   void setSmoothingTimeConstant(float smoothingTimeConstant);
   void setWindowType(const std::string &type);
+  void setAnalysisInterval(int interval);
 
   void getFloatFrequencyData(float *data, int length);
   void getByteFrequencyData(uint8_t *data, int length);
@@ -42,22 +55,45 @@ class AnalyserNode : public AudioNode {
   std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus>& processingBus, int framesToProcess) override;
 
  private:
-  int fftSize_;
+  struct Snapshot {
+    // last fftSize frames of the input
+    std::vector<float> timeDomainData;
+    // smoothed magnitudes in decibels
+    std::vector<float> frequencyData;
+  };
+
+  // set from JS, the analysis thread picks them up on its next analysis
+  std::atomic<int> fftSize_;
+  std::atomic<float> smoothingTimeConstant_;
+  std::atomic<WindowType> windowType_;
+  std::atomic<int> analysisInterval_;
+
+  // only used by the JS thread
   float minDecibels_;
   float maxDecibels_;
-  float smoothingTimeConstant_;
 
-  WindowType windowType_;
-  std::shared_ptr<AudioArray> windowData_;
+  // written by the audio thread, read by the analysis thread
+  std::unique_ptr<SpscAudioRing> inputRing_;
+  std::unique_ptr<AudioBus> downMixBus_;
 
+  // written by the analysis thread, read by the JS thread
+  TripleBuffer<Snapshot> snapshots_;
+
+  // only used by the analysis thread
+  std::unique_ptr<AudioBus> ringReadBus_;
   std::unique_ptr<CircularAudioArray> inputBuffer_;
-  std::unique_ptr<AudioBus> downMixBus_;
+  int analysisFftSize_;
+  WindowType analysisWindowType_;
+  std::shared_ptr<AudioArray> windowData_;
   std::unique_ptr<AudioArray> tempBuffer_;
-
   std::unique_ptr<dsp::FFT> fft_;
   std::vector<std::complex<float>> complexData_;
   std::unique_ptr<AudioArray> magnitudeBuffer_;
-  bool shouldDoFFTAnalysis_ { true };
+
+  std::thread analysisThread_;
+  std::mutex analysisMutex_;
+  std::condition_variable analysisCondition_;
+  bool isAnalysing_ = true; // guarded by analysisMutex_
 
   static WindowType fromString(const std::string &type) {
     std::string lowerType = type;
@@ -84,6 +120,9 @@ class AnalyserNode : public AudioNode {
     }
   }
 
+  // body of the analysis thread, runs doFFTAnalysis every analysisInterval
+  void runAnalysisLoop();
+  // analyses the frames rendered since the previous analysis and publishes a snapshot
   void doFFTAnalysis();
 
   void setWindowData(WindowType type, int size);
@@ -0,0 +1,426 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/analysis/AudioMeterNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/Resampler.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace audioapi {
+
+namespace {
+
+constexpr int OVERSAMPLING_FACTOR = 4;
+
+float powerToDecibels(double power) {
+  if (power <= 0.0) {
+    return -std::numeric_limits<float>::infinity();
+  }
+
+  return static_cast<float>(10.0 * std::log10(power));
+}
+
+float amplitudeToDecibels(float amplitude) {
+  if (amplitude <= 0.0f) {
+    return -std::numeric_limits<float>::infinity();
+  }
+
+  return 20.0f * std::log10(amplitude);
+}
+
+// BS.1770 channel weights, the LFE channel of a 5.1 layout is left out and
+// the surround channels are boosted by 1.5 dB.
+float getLoudnessWeight(int channel, int numberOfChannels) {
+  if (numberOfChannels != 6) {
+    return 1.0f;
+  }
+
+  switch (channel) {
+    case AudioBus::ChannelLFE:
+      return 0.0f;
+    case AudioBus::ChannelSurroundLeft:
+    case AudioBus::ChannelSurroundRight:
+      return 1.41f;
+    default:
+      return 1.0f;
+  }
+}
+
+// The K-weighting filter of BS.1770 is specified for 48 kHz only, both of its
+// stages are derived from their analog prototypes for any sample rate
+// (the same way as libebur128 does).
+dsp::BiquadCoefficients getPreFilterCoefficients(double sampleRate) {
+  const double f0 = 1681.974450955533;
+  const double G = 3.999843853973347;
+  const double Q = 0.7071752369554196;
+
+  const double K = std::tan(PI * f0 / sampleRate);
+  const double Vh = std::pow(10.0, G / 20.0);
+  const double Vb = std::pow(Vh, 0.4996667741545416);
+  const double a0 = 1.0 + K / Q + K * K;
+
+  return {
+      static_cast<float>((Vh + Vb * K / Q + K * K) / a0),
+      static_cast<float>(2.0 * (K * K - Vh) / a0),
+      static_cast<float>((Vh - Vb * K / Q + K * K) / a0),
+      static_cast<float>(2.0 * (K * K - 1.0) / a0),
+      static_cast<float>((1.0 - K / Q + K * K) / a0)};
+}
+
+dsp::BiquadCoefficients getRlbFilterCoefficients(double sampleRate) {
+  const double f0 = 38.13547087602444;
+  const double Q = 0.5003270373238773;
+
+  const double K = std::tan(PI * f0 / sampleRate);
+  const double a0 = 1.0 + K / Q + K * K;
+
+  return {
+      1.0f,
+      -2.0f,
+      1.0f,
+      static_cast<float>(2.0 * (K * K - 1.0) / a0),
+      static_cast<float>((1.0 - K / Q + K * K) / a0)};
+}
+
+} // namespace
+
+AudioMeterNode::AudioMeterNode(BaseAudioContext *context, int numberOfBands)
+    : AudioNode(context),
+      numberOfBands_(
+          std::clamp(numberOfBands, 1, AUDIO_METER_MAX_NUMBER_OF_BANDS)),
+      kWeightingFilter_(AUDIO_METER_MAX_CHANNEL_COUNT, 2),
+      measurements_([]() {
+        Measurements initial;
+        initial.rms.fill(-std::numeric_limits<float>::infinity());
+        initial.peak.fill(-std::numeric_limits<float>::infinity());
+        initial.truePeak.fill(-std::numeric_limits<float>::infinity());
+        initial.momentaryLoudness = -std::numeric_limits<float>::infinity();
+        initial.shortTermLoudness = -std::numeric_limits<float>::infinity();
+        initial.bandEnergies.fill(-std::numeric_limits<float>::infinity());
+        return initial;
+      }()) {
+  auto sampleRate = context_->getSampleRate();
+  auto blocksIn = [sampleRate](float seconds) {
+    return std::max(
+        static_cast<size_t>(
+            std::ceil(seconds * sampleRate / RENDER_QUANTUM_SIZE)),
+        size_t(1));
+  };
+
+  levelBlocks_.resize(blocksIn(AUDIO_METER_LEVEL_WINDOW));
+  for (int i = 0; i < AUDIO_METER_MAX_CHANNEL_COUNT; i++) {
+    peaks_[i].resize(levelBlocks_.size());
+    truePeaks_[i].resize(levelBlocks_.size());
+  }
+  loudnessBlocks_.resize(blocksIn(AUDIO_METER_SHORT_TERM_LOUDNESS_WINDOW));
+  momentaryNumberOfBlocks_ = std::min(
+      blocksIn(AUDIO_METER_MOMENTARY_LOUDNESS_WINDOW), loudnessBlocks_.size());
+
+  kWeightingFilter_.setCoefficients(getPreFilterCoefficients(sampleRate), 0);
+  kWeightingFilter_.setCoefficients(getRlbFilterCoefficients(sampleRate), 1);
+  kWeightedBus_ = std::make_unique<AudioBus>(
+      RENDER_QUANTUM_SIZE, AUDIO_METER_MAX_CHANNEL_COUNT, sampleRate);
+
+  oversamplers_.reserve(AUDIO_METER_MAX_CHANNEL_COUNT);
+  for (int i = 0; i < AUDIO_METER_MAX_CHANNEL_COUNT; i++) {
+    oversamplers_.push_back(std::make_unique<dsp::Resampler>(
+        1,
+        sampleRate,
+        sampleRate * OVERSAMPLING_FACTOR,
+        dsp::Resampler::Quality::LOW));
+  }
+  oversampledBus_ = std::make_unique<AudioBus>(
+      oversamplers_[0]->getMaxOutputFrames(RENDER_QUANTUM_SIZE),
+      1,
+      sampleRate * OVERSAMPLING_FACTOR);
+
+  // The first call of process sizes the history of the resampler, do it here
+  // and not on the audio thread.
+  AudioBus silence(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  const float *input[] = {silence.getChannel(0)->getData()};
+  float *output[] = {oversampledBus_->getChannel(0)->getData()};
+  for (auto &oversampler : oversamplers_) {
+    oversampler->process(
+        input, RENDER_QUANTUM_SIZE, output, oversampledBus_->getSize());
+    oversampler->reset();
+  }
+
+  // Centers are spaced evenly on the log scale, every band is as wide as the
+  // spacing, a single band spans the whole range.
+  auto highestFrequency =
+      std::min(AUDIO_METER_HIGHEST_BAND_FREQUENCY, 0.45f * sampleRate);
+  auto lowestFrequency =
+      std::min(AUDIO_METER_LOWEST_BAND_FREQUENCY, highestFrequency);
+  auto octaves = std::log2(highestFrequency / lowestFrequency);
+  auto bandwidth = numberOfBands_ > 1
+      ? octaves / static_cast<float>(numberOfBands_ - 1)
+      : octaves;
+  auto bandwidthRatio = std::pow(2.0f, std::max(bandwidth, 0.1f));
+  auto Q = std::sqrt(bandwidthRatio) / (bandwidthRatio - 1.0f);
+
+  bandFilters_.reserve(numberOfBands_);
+  for (int i = 0; i < numberOfBands_; i++) {
+    bandFrequencies_[i] = numberOfBands_ > 1
+        ? lowestFrequency * std::pow(2.0f, bandwidth * static_cast<float>(i))
+        : std::sqrt(lowestFrequency * highestFrequency);
+
+    auto coefficients = dsp::BiquadCoefficients::design(
+        BiquadFilterType::BANDPASS,
+        bandFrequencies_[i] / context_->getNyquistFrequency(),
+        Q,
+        0.0f);
+    auto &filter = bandFilters_.emplace_back(1, 2);
+    filter.setCoefficients(coefficients, 0);
+    filter.setCoefficients(coefficients, 1);
+  }
+
+  downMixBus_ = std::make_unique<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+  bandBus_ = std::make_unique<AudioBus>(RENDER_QUANTUM_SIZE, 1, sampleRate);
+
+  isInitialized_ = true;
+}
+
+AudioMeterNode::~AudioMeterNode() = default;
+
+int AudioMeterNode::getNumberOfBands() const {
+  return numberOfBands_;
+}
+
+float AudioMeterNode::getBandFrequency(int band) const {
+  return bandFrequencies_[std::clamp(band, 0, numberOfBands_ - 1)];
+}
+
+const AudioMeterNode::Measurements &AudioMeterNode::getMeasurements() {
+  measurements_.update();
+  return measurements_.getReadBuffer();
+}
+
+std::shared_ptr<AudioBus> AudioMeterNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  // Meter behaves like a sniffer node, it measures the processingBus without
+  // modifying it.
+  auto numberOfChannels = std::min(
+      processingBus->getNumberOfChannels(), AUDIO_METER_MAX_CHANNEL_COUNT);
+  if (numberOfChannels != numberOfChannels_) {
+    reset(numberOfChannels);
+  }
+
+  measureLevels(*processingBus, framesToProcess);
+  measureLoudness(*processingBus, framesToProcess);
+  publishMeasurements();
+
+  return processingBus;
+}
+
+void AudioMeterNode::reset(int numberOfChannels) {
+  numberOfChannels_ = numberOfChannels;
+
+  std::fill(levelBlocks_.begin(), levelBlocks_.end(), LevelBlock{});
+  levelBlockIndex_ = 0;
+  levelFrames_ = 0;
+  levelSumOfSquares_.fill(0.0);
+  bandSumOfSquares_.fill(0.0);
+  for (int i = 0; i < AUDIO_METER_MAX_CHANNEL_COUNT; i++) {
+    peaks_[i].reset();
+    truePeaks_[i].reset();
+  }
+
+  std::fill(loudnessBlocks_.begin(), loudnessBlocks_.end(), LoudnessBlock{});
+  loudnessBlockIndex_ = 0;
+  momentaryFrames_ = 0;
+  shortTermFrames_ = 0;
+  momentarySumOfSquares_ = 0.0;
+  shortTermSumOfSquares_ = 0.0;
+
+  kWeightingFilter_.reset();
+  for (auto &oversampler : oversamplers_) {
+    oversampler->reset();
+  }
+  for (auto &filter : bandFilters_) {
+    filter.reset();
+  }
+}
+
+void AudioMeterNode::measureLevels(const AudioBus &bus, int framesToProcess) {
+  auto &block = levelBlocks_[levelBlockIndex_];
+
+  // the oldest quantum leaves the window
+  levelFrames_ -= block.frames;
+  for (int i = 0; i < numberOfChannels_; i++) {
+    levelSumOfSquares_[i] -= block.sumOfSquares[i];
+  }
+  for (int i = 0; i < numberOfBands_; i++) {
+    bandSumOfSquares_[i] -= block.bandSumOfSquares[i];
+  }
+
+  block.frames = framesToProcess;
+  float *output[] = {oversampledBus_->getChannel(0)->getData()};
+
+  for (int i = 0; i < numberOfChannels_; i++) {
+    const float *data = bus.getChannel(i)->getData();
+    block.sumOfSquares[i] = dsp::dotProduct(data, data, framesToProcess);
+    auto peak = dsp::maximumMagnitude(data, framesToProcess);
+
+    auto oversampledFrames = oversamplers_[i]->process(
+        &data, framesToProcess, output, oversampledBus_->getSize());
+    peaks_[i].push(peak);
+    truePeaks_[i].push(std::max(
+        peak, dsp::maximumMagnitude(output[0], oversampledFrames)));
+
+    levelSumOfSquares_[i] += block.sumOfSquares[i];
+  }
+
+  measureBands(bus, framesToProcess, block);
+
+  levelFrames_ += block.frames;
+  levelBlockIndex_ = (levelBlockIndex_ + 1) % levelBlocks_.size();
+}
+
+void AudioMeterNode::measureLoudness(const AudioBus &bus, int framesToProcess) {
+  std::array<float *, AUDIO_METER_MAX_CHANNEL_COUNT> channels{};
+  for (int i = 0; i < numberOfChannels_; i++) {
+    channels[i] = kWeightedBus_->getChannel(i)->getData();
+    std::memcpy(
+        channels[i],
+        bus.getChannel(i)->getData(),
+        framesToProcess * sizeof(float));
+  }
+
+  kWeightingFilter_.process(
+      channels.data(), numberOfChannels_, framesToProcess);
+
+  float sumOfSquares = 0.0f;
+  for (int i = 0; i < numberOfChannels_; i++) {
+    auto weight = getLoudnessWeight(i, numberOfChannels_);
+    if (weight > 0.0f) {
+      sumOfSquares +=
+          weight * dsp::dotProduct(channels[i], channels[i], framesToProcess);
+    }
+  }
+
+  // The momentary window is the newest part of the short-term one, a block
+  // leaves it momentaryNumberOfBlocks_ quanta after it was written.
+  auto numberOfBlocks = loudnessBlocks_.size();
+  auto leavingIndex =
+      (loudnessBlockIndex_ + numberOfBlocks - momentaryNumberOfBlocks_) %
+      numberOfBlocks;
+  const auto &leavingMomentary = loudnessBlocks_[leavingIndex];
+  momentaryFrames_ -= leavingMomentary.frames;
+  momentarySumOfSquares_ -= leavingMomentary.sumOfSquares;
+
+  auto &block = loudnessBlocks_[loudnessBlockIndex_];
+  shortTermFrames_ -= block.frames;
+  shortTermSumOfSquares_ -= block.sumOfSquares;
+
+  block.frames = framesToProcess;
+  block.sumOfSquares = sumOfSquares;
+
+  momentaryFrames_ += block.frames;
+  momentarySumOfSquares_ += block.sumOfSquares;
+  shortTermFrames_ += block.frames;
+  shortTermSumOfSquares_ += block.sumOfSquares;
+
+  loudnessBlockIndex_ = (loudnessBlockIndex_ + 1) % numberOfBlocks;
+}
+
+void AudioMeterNode::measureBands(
+    const AudioBus &bus,
+    int framesToProcess,
+    LevelBlock &block) {
+  downMixBus_->copy(&bus);
+
+  const float *downMixData = downMixBus_->getChannel(0)->getData();
+  float *bandData[] = {bandBus_->getChannel(0)->getData()};
+
+  for (int i = 0; i < numberOfBands_; i++) {
+    std::memcpy(bandData[0], downMixData, framesToProcess * sizeof(float));
+    bandFilters_[i].process(bandData, 1, framesToProcess);
+
+    block.bandSumOfSquares[i] =
+        dsp::dotProduct(bandData[0], bandData[0], framesToProcess);
+    bandSumOfSquares_[i] += block.bandSumOfSquares[i];
+  }
+}
+
+void AudioMeterNode::WindowMaximum::resize(size_t numberOfQuanta) {
+  entries_.resize(numberOfQuanta);
+  reset();
+}
+
+void AudioMeterNode::WindowMaximum::reset() {
+  front_ = 0;
+  size_ = 0;
+  numberOfQuanta_ = 0;
+}
+
+void AudioMeterNode::WindowMaximum::push(float value) {
+  auto capacity = entries_.size();
+
+  // the oldest quantum leaves the window
+  if (size_ > 0 && entries_[front_].quantum + capacity <= numberOfQuanta_) {
+    front_ = (front_ + 1) % capacity;
+    size_ -= 1;
+  }
+
+  // quanta with a value not greater than the new one can not hold the maximum
+  // before they leave the window
+  while (size_ > 0 &&
+         entries_[(front_ + size_ - 1) % capacity].value <= value) {
+    size_ -= 1;
+  }
+
+  entries_[(front_ + size_) % capacity] = {numberOfQuanta_, value};
+  size_ += 1;
+  numberOfQuanta_ += 1;
+}
+
+float AudioMeterNode::WindowMaximum::getMaximum() const {
+  return size_ > 0 ? entries_[front_].value : 0.0f;
+}
+
+void AudioMeterNode::publishMeasurements() {
+  auto &measurements = measurements_.getWriteBuffer();
+  measurements.numberOfChannels = numberOfChannels_;
+
+  // running sums lose a little precision with every quantum, they must not
+  // end up below zero
+  auto levelFrames = static_cast<double>(std::max(levelFrames_, size_t(1)));
+  for (int i = 0; i < AUDIO_METER_MAX_CHANNEL_COUNT; i++) {
+    if (i >= numberOfChannels_) {
+      measurements.rms[i] = -std::numeric_limits<float>::infinity();
+      measurements.peak[i] = -std::numeric_limits<float>::infinity();
+      measurements.truePeak[i] = -std::numeric_limits<float>::infinity();
+      continue;
+    }
+
+    measurements.rms[i] =
+        powerToDecibels(std::max(levelSumOfSquares_[i], 0.0) / levelFrames);
+    measurements.peak[i] = amplitudeToDecibels(peaks_[i].getMaximum());
+    measurements.truePeak[i] = amplitudeToDecibels(truePeaks_[i].getMaximum());
+  }
+
+  for (int i = 0; i < AUDIO_METER_MAX_NUMBER_OF_BANDS; i++) {
+    measurements.bandEnergies[i] = i < numberOfBands_
+        ? powerToDecibels(std::max(bandSumOfSquares_[i], 0.0) / levelFrames)
+        : -std::numeric_limits<float>::infinity();
+  }
+
+  // -0.691 cancels the gain of the K-weighting at 997 Hz, a full scale sine
+  // in one channel reads -3.01 LUFS
+  auto momentaryPower = std::max(momentarySumOfSquares_, 0.0) /
+      static_cast<double>(std::max(momentaryFrames_, size_t(1)));
+  auto shortTermPower = std::max(shortTermSumOfSquares_, 0.0) /
+      static_cast<double>(std::max(shortTermFrames_, size_t(1)));
+  measurements.momentaryLoudness = -0.691f + powerToDecibels(momentaryPower);
+  measurements.shortTermLoudness = -0.691f + powerToDecibels(shortTermPower);
+
+  measurements_.publish();
+}
+
+} // namespace audioapi
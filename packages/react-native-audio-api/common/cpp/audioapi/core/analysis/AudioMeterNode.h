@@ -0,0 +1,146 @@
+#pragma once
+
+#include <audioapi/core/AudioNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/Biquad.h>
+#include <audioapi/utils/TripleBuffer.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+
+namespace dsp {
+class Resampler;
+} // namespace dsp
+
+/// @brief Meters its input, which it passes through unchanged.
+/// @note Every quantum the audio thread measures the per channel rms, sample
+/// peak and true peak, the K-weighted momentary and short-term loudness
+/// (ITU-R BS.1770) and the energies of log-spaced bands of the down mixed
+/// input. Levels are sliding windows over the last quanta, kept as running
+/// sums and running maxima, so a quantum costs a few vector reductions,
+/// independent of the window length.
+/// @note The latest measurements are published through a triple buffer, JS
+/// reads all of them at once without waiting.
+class AudioMeterNode : public AudioNode {
+ public:
+  /// @brief Levels in decibels, -Infinity for silence.
+  struct Measurements {
+    int numberOfChannels = 0;
+    // dBFS, over the last AUDIO_METER_LEVEL_WINDOW seconds
+    std::array<float, AUDIO_METER_MAX_CHANNEL_COUNT> rms{};
+    std::array<float, AUDIO_METER_MAX_CHANNEL_COUNT> peak{};
+    // peak of the 4 times oversampled signal, dBTP
+    std::array<float, AUDIO_METER_MAX_CHANNEL_COUNT> truePeak{};
+    // LUFS
+    float momentaryLoudness = 0.0f;
+    float shortTermLoudness = 0.0f;
+    // mean square of every band of the down mixed input, dBFS
+    std::array<float, AUDIO_METER_MAX_NUMBER_OF_BANDS> bandEnergies{};
+  };
+
+  explicit AudioMeterNode(BaseAudioContext *context, int numberOfBands);
+  ~AudioMeterNode() override;
+
+  [[nodiscard]] int getNumberOfBands() const;
+  [[nodiscard]] float getBandFrequency(int band) const;
+
+  /// @brief The latest measurements, called from the JS thread.
+  const Measurements &getMeasurements();
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override;
+
+ private:
+  // measurements of one quantum, linear
+  struct LevelBlock {
+    size_t frames = 0;
+    std::array<float, AUDIO_METER_MAX_CHANNEL_COUNT> sumOfSquares{};
+    std::array<float, AUDIO_METER_MAX_NUMBER_OF_BANDS> bandSumOfSquares{};
+  };
+
+  // Maximum of the values of the last quanta, amortized O(1) per quantum.
+  // Keeps only the quanta whose value is greater than the value of every later
+  // one, oldest first, so the front one holds the maximum.
+  class WindowMaximum {
+   public:
+    void resize(size_t numberOfQuanta);
+    void reset();
+    void push(float value);
+    [[nodiscard]] float getMaximum() const;
+
+   private:
+    struct Entry {
+      size_t quantum = 0;
+      float value = 0.0f;
+    };
+
+    // ring, one entry per quantum of the window at most
+    std::vector<Entry> entries_;
+    size_t front_ = 0;
+    size_t size_ = 0;
+    size_t numberOfQuanta_ = 0;
+  };
+
+  struct LoudnessBlock {
+    size_t frames = 0;
+    // channel weighted sum of squares of the K-weighted input
+    float sumOfSquares = 0.0f;
+  };
+
+  int numberOfBands_;
+  std::array<float, AUDIO_METER_MAX_NUMBER_OF_BANDS> bandFrequencies_{};
+
+  // audio thread only, reset when the number of input channels changes
+  int numberOfChannels_ = 0;
+
+  std::vector<LevelBlock> levelBlocks_;
+  size_t levelBlockIndex_ = 0;
+  size_t levelFrames_ = 0;
+  std::array<double, AUDIO_METER_MAX_CHANNEL_COUNT> levelSumOfSquares_{};
+  std::array<double, AUDIO_METER_MAX_NUMBER_OF_BANDS> bandSumOfSquares_{};
+  std::array<WindowMaximum, AUDIO_METER_MAX_CHANNEL_COUNT> peaks_;
+  std::array<WindowMaximum, AUDIO_METER_MAX_CHANNEL_COUNT> truePeaks_;
+
+  std::vector<LoudnessBlock> loudnessBlocks_;
+  size_t loudnessBlockIndex_ = 0;
+  size_t momentaryNumberOfBlocks_;
+  size_t momentaryFrames_ = 0;
+  size_t shortTermFrames_ = 0;
+  double momentarySumOfSquares_ = 0.0;
+  double shortTermSumOfSquares_ = 0.0;
+
+  // pre-filter and RLB high-pass of BS.1770, shared by all channels
+  dsp::Biquad kWeightingFilter_;
+  std::unique_ptr<AudioBus> kWeightedBus_;
+
+  // one per channel, so only the channels present are oversampled
+  std::vector<std::unique_ptr<dsp::Resampler>> oversamplers_;
+  std::unique_ptr<AudioBus> oversampledBus_;
+
+  // two band-pass sections per band
+  std::vector<dsp::Biquad> bandFilters_;
+  std::unique_ptr<AudioBus> downMixBus_;
+  std::unique_ptr<AudioBus> bandBus_;
+
+  // written by the audio thread, read by the JS thread
+  TripleBuffer<Measurements> measurements_;
+
+  void reset(int numberOfChannels);
+  void measureLevels(const AudioBus &bus, int framesToProcess);
+  void measureLoudness(const AudioBus &bus, int framesToProcess);
+  void measureBands(
+      const AudioBus &bus,
+      int framesToProcess,
+      LevelBlock &block);
+  void publishMeasurements();
+};
+
+} // namespace audioapi
@@ -1,8 +1,11 @@
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/DelayNode.h>
 #include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/utils/AllocationGuard.h>
 #include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/RenderWorkerPool.hpp>
 
 namespace audioapi {
 
@@ -29,16 +32,60 @@ void AudioDestinationNode::renderAudio(
     return;
   }
 
-  context_->getNodeManager()->preProcessGraph();
+  // Nothing below touches the heap, graph changes are applied to storage
+  // reserved on the JS thread and storage swapped out is released by the node
+  // destructor.
+  [[maybe_unused]] AllocationGuard allocationGuard;
+
+  auto *nodeManager = context_->getNodeManager();
+  nodeManager->preProcessGraph();
 
   destinationBus->zero();
 
-  auto processedBus = processAudio(destinationBus, numFrames, true);
+  const auto &renderList = nodeManager->getRenderList(this);
+
+  auto renderNodes = [&destinationBus, numFrames](auto &&nodes) {
+    for (auto *node : nodes) {
+      if (node->isActive()) {
+        node->processAudio(destinationBus, numFrames, true);
+      }
+    }
+  };
+
+  // Inputs are rendered in topological order, so by the time a node pulls its
+  // inputs they already hold their output for this quantum.
+  auto *renderWorkerPool = context_->getRenderWorkerPool();
+  auto numberOfRenderGroups = nodeManager->getNumberOfRenderGroups();
+
+  // Fanning out costs a wake-up and a join, small graphs are rendered inline.
+  if (renderWorkerPool != nullptr &&
+      nodeManager->getNumberOfLargeRenderGroups() > 1) {
+    // Independent subgraphs meet only here, they are rendered concurrently
+    // and joined before being mixed into the destination.
+    renderNodes(nodeManager->getSerialRenderList());
+
+    auto renderGroup = [&renderNodes, nodeManager](size_t group) {
+      renderNodes(nodeManager->getRenderGroup(group));
+    };
+    renderWorkerPool->run(numberOfRenderGroups, renderGroup);
+  } else {
+    renderNodes(renderList);
+  }
+
+  const auto &processedBus = processAudio(destinationBus, numFrames, true);
 
   if (processedBus && processedBus != destinationBus) {
     destinationBus->copy(processedBus.get());
   }
 
+  // Delays breaking cycles take their inputs only now, once every node of the
+  // cycle has its output for this quantum.
+  for (auto *delayNode : nodeManager->getCycleBreakingDelays()) {
+    if (delayNode->isActive()) {
+      delayNode->processCycleInputs(numFrames);
+    }
+  }
+
   destinationBus->normalize();
 
   currentSampleFrame_ += numFrames;
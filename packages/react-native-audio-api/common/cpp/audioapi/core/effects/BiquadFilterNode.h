@@ -3,8 +3,10 @@
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/types/BiquadFilterType.h>
+#include <audioapi/dsp/Biquad.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <memory>
@@ -26,37 +28,14 @@ class BiquadFilterNode : public AudioNode {
   [[nodiscard]] std::shared_ptr<AudioParam> getDetuneParam() const;
   [[nodiscard]] std::shared_ptr<AudioParam> getQParam() const;
   [[nodiscard]] std::shared_ptr<AudioParam> getGainParam() const;
+  [[nodiscard]] int getAutomationSubBlockSize() const;
+  void setAutomationSubBlockSize(int automationSubBlockSize);
   void getFrequencyResponse(
       const float *frequencyArray,
       float *magResponseOutput,
       float *phaseResponseOutput,
       int length);
 
- protected:
-  std::shared_ptr<AudioBus> processNode(
-      const std::shared_ptr<AudioBus> &processingBus,
-      int framesToProcess) override;
-
- private:
-  std::shared_ptr<AudioParam> frequencyParam_;
-  std::shared_ptr<AudioParam> detuneParam_;
-  std::shared_ptr<AudioParam> QParam_;
-  std::shared_ptr<AudioParam> gainParam_;
-  audioapi::BiquadFilterType type_;
-
-  // delayed samples
-  float x1_ = 0;
-  float x2_ = 0;
-  float y1_ = 0;
-  float y2_ = 0;
-
-  // coefficients
-  float b0_ = 1.0;
-  float b1_ = 0;
-  float b2_ = 0;
-  float a1_ = 0;
-  float a2_ = 0;
-
   static BiquadFilterType fromString(const std::string &type) {
     std::string lowerType = type;
     std::transform(
@@ -105,22 +84,43 @@ class BiquadFilterNode : public AudioNode {
     }
   }
 
-  void setNormalizedCoefficients(
-      float b0,
-      float b1,
-      float b2,
-      float a0,
-      float a1,
-      float a2);
-  void setLowpassCoefficients(float frequency, float Q);
-  void setHighpassCoefficients(float frequency, float Q);
-  void setBandpassCoefficients(float frequency, float Q);
-  void setLowshelfCoefficients(float frequency, float gain);
-  void setHighshelfCoefficients(float frequency, float gain);
-  void setPeakingCoefficients(float frequency, float Q, float gain);
-  void setNotchCoefficients(float frequency, float Q);
-  void setAllpassCoefficients(float frequency, float Q);
+ protected:
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override;
+
+ private:
+  std::shared_ptr<AudioParam> frequencyParam_;
+  std::shared_ptr<AudioParam> detuneParam_;
+  std::shared_ptr<AudioParam> QParam_;
+  std::shared_ptr<AudioParam> gainParam_;
+  audioapi::BiquadFilterType type_;
+  // 0 computes the coefficients once per quantum, otherwise automated params are sampled at the end of every
+  // sub-block of this many frames and the coefficients are interpolated towards them sample by sample.
+  std::atomic<int> automationSubBlockSize_ = 0;
+
+  // coefficients and per-channel state
+  dsp::Biquad biquad_;
+
+  // Inputs of the current coefficients, trigonometry is skipped when they do not change.
+  struct CoefficientsKey {
+    BiquadFilterType type;
+    float frequency;
+    float detune;
+    float Q;
+    float gain;
+
+    bool operator==(const CoefficientsKey &other) const = default;
+  };
+  // NaN never compares equal, so the first update always computes coefficients.
+  CoefficientsKey coefficientsKey_ = {BiquadFilterType::LOWPASS, std::nanf(""), 0.0f, 0.0f, 0.0f};
+  dsp::BiquadCoefficients designedCoefficients_;
+
+  const dsp::BiquadCoefficients &designCoefficients(float frequency, float detune, float Q, float gain);
+  [[nodiscard]] dsp::BiquadCoefficients
+  computeCoefficients(BiquadFilterType type, float frequency, float detune, float Q, float gain) const;
   void applyFilter();
+  void applyAutomatedFilter(const std::shared_ptr<AudioBus> &processingBus, int framesToProcess, int subBlockSize);
 };
 
 } // namespace audioapi
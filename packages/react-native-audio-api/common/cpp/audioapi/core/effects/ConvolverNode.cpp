@@ -0,0 +1,143 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/effects/ConvolverNode.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// https://webaudio.github.io/web-audio-api/#ConvolverNode
+
+namespace audioapi {
+
+ConvolverNode::ConvolverNode(BaseAudioContext *context) : AudioNode(context) {
+  channelCountMode_ = ChannelCountMode::CLAMPED_MAX;
+  isInitialized_ = true;
+}
+
+bool ConvolverNode::getNormalize() const {
+  return normalize_;
+}
+
+std::shared_ptr<AudioBuffer> ConvolverNode::getBuffer() const {
+  return buffer_;
+}
+
+void ConvolverNode::setNormalize(bool normalize) {
+  normalize_ = normalize;
+}
+
+void ConvolverNode::setBuffer(const std::shared_ptr<AudioBuffer> &buffer) {
+  std::shared_ptr<dsp::Convolver> convolver;
+
+  if (buffer != nullptr) {
+    std::vector<dsp::Convolver::Path> paths;
+
+    switch (buffer->getNumberOfChannels()) {
+      case 1:
+        paths = {
+            {0, 0, buffer->getChannelData(0)},
+            {1, 1, buffer->getChannelData(0)}};
+        break;
+      case 2:
+        paths = {
+            {0, 0, buffer->getChannelData(0)},
+            {1, 1, buffer->getChannelData(1)}};
+        break;
+      case 4:
+        // true stereo, channels are L->L, L->R, R->L and R->R
+        paths = {
+            {0, 0, buffer->getChannelData(0)},
+            {0, 1, buffer->getChannelData(1)},
+            {1, 0, buffer->getChannelData(2)},
+            {1, 1, buffer->getChannelData(3)}};
+        break;
+      default:
+        throw std::invalid_argument(
+            "The number of channels of the buffer has to be 1, 2 or 4");
+    }
+
+    auto gain = normalize_ ? getNormalizationScale(*buffer) : 1.0f;
+    convolver = std::make_shared<dsp::Convolver>(
+        paths, buffer->getLength(), gain, context_->isRealtime());
+  }
+
+  buffer_ = buffer;
+  // the output keeps decaying for the whole impulse response
+  tailFrames_.store(
+      buffer != nullptr ? buffer->getLength() + CONVOLVER_HEAD_PARTITION_SIZE
+                        : 0,
+      std::memory_order_relaxed);
+
+  // Overwrites a convolver the audio thread no longer uses, so it is
+  // destroyed here rather than on the audio thread.
+  convolvers_.getWriteBuffer() = std::move(convolver);
+  convolvers_.publish();
+}
+
+std::shared_ptr<AudioBus> ConvolverNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  convolvers_.update();
+  const auto &convolver = convolvers_.getReadBuffer();
+
+  if (convolver == nullptr) {
+    audioBus_->zero();
+    return audioBus_;
+  }
+
+  auto lastChannel = processingBus->getNumberOfChannels() - 1;
+  std::array<const float *, 2> inputs = {
+      processingBus->getChannel(0)->getData(),
+      processingBus->getChannel(std::min(1, lastChannel))->getData()};
+  std::array<float *, 2> outputs = {
+      audioBus_->getChannel(0)->getData(),
+      audioBus_->getChannel(1)->getData()};
+
+  convolver->process(
+      inputs.data(),
+      outputs.data(),
+      static_cast<int>(outputs.size()),
+      framesToProcess);
+
+  return audioBus_;
+}
+
+// https://webaudio.github.io/web-audio-api/#ConvolverNode-normalize
+float ConvolverNode::getNormalizationScale(const AudioBuffer &buffer) {
+  static constexpr float GAIN_CALIBRATION = 0.00125f;
+  static constexpr float GAIN_CALIBRATION_SAMPLE_RATE = 44100.0f;
+  static constexpr float MIN_POWER = 0.000125f;
+
+  auto numberOfChannels = buffer.getNumberOfChannels();
+  auto length = buffer.getLength();
+
+  double power = 0.0;
+  for (int channel = 0; channel < numberOfChannels; ++channel) {
+    const auto *data = buffer.getChannelData(channel);
+    for (size_t i = 0; i < length; ++i) {
+      power += static_cast<double>(data[i]) * data[i];
+    }
+  }
+
+  power = std::sqrt(power / static_cast<double>(numberOfChannels * length));
+  if (!std::isfinite(power) || power < MIN_POWER) {
+    power = MIN_POWER;
+  }
+
+  auto scale = GAIN_CALIBRATION / static_cast<float>(power);
+  scale *= GAIN_CALIBRATION_SAMPLE_RATE / buffer.getSampleRate();
+
+  if (numberOfChannels == 4) {
+    scale *= 0.5f;
+  }
+
+  return scale;
+}
+
+} // namespace audioapi
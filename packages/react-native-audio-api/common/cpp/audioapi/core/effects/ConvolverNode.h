@@ -0,0 +1,47 @@
+#pragma once
+
+#include <audioapi/core/AudioNode.h>
+#include <audioapi/dsp/Convolver.h>
+#include <audioapi/utils/TripleBuffer.hpp>
+
+#include <memory>
+
+namespace audioapi {
+
+class AudioBus;
+class AudioBuffer;
+
+/// @brief Convolves the input with the impulse response held in an AudioBuffer, e.g. for convolution reverb.
+/// @note Uses non-uniformly partitioned FFT convolution, spectra of the partitions are computed once in setBuffer.
+/// In a realtime context the long tail partitions are processed on a background thread.
+/// @note Output is always stereo and delayed by CONVOLVER_HEAD_PARTITION_SIZE frames.
+/// A mono input is treated as identical left and right channels.
+/// @note Once the inputs stop, the node keeps rendering for the length of the impulse response, so the reverb decays.
+class ConvolverNode : public AudioNode {
+ public:
+  explicit ConvolverNode(BaseAudioContext *context);
+
+  [[nodiscard]] bool getNormalize() const;
+  [[nodiscard]] std::shared_ptr<AudioBuffer> getBuffer() const;
+
+  /// @note Takes effect on the next setBuffer call, as in the Web Audio API.
+  void setNormalize(bool normalize);
+  /// @brief Sets the impulse response, it has to have 1, 2 or 4 channels.
+  /// @note The convolver is built on the calling thread, the audio thread only picks it up.
+  /// Previous convolvers are destroyed on the calling thread too, by the following calls.
+  void setBuffer(const std::shared_ptr<AudioBuffer> &buffer);
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus> &processingBus, int framesToProcess) override;
+
+ private:
+  bool normalize_ = true;
+  std::shared_ptr<AudioBuffer> buffer_;
+
+  // Handed to the audio thread without locking, so it never renders silence while a new one is set.
+  TripleBuffer<std::shared_ptr<dsp::Convolver>> convolvers_ {nullptr};
+
+  static float getNormalizationScale(const AudioBuffer &buffer);
+};
+
+} // namespace audioapi
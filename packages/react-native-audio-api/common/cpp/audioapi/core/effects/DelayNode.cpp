@@ -0,0 +1,224 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/effects/DelayNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// https://webaudio.github.io/web-audio-api/#DelayNode
+
+namespace audioapi {
+
+namespace {
+
+// Calls f(ringStart, offset, length) for the contiguous parts of
+// [start, start + length) in a ring, the ring is longer than length.
+template <typename F>
+void forEachRingSegment(size_t start, size_t length, size_t ringSize, F &&f) {
+  auto firstLength = std::min(length, ringSize - start);
+  f(start, 0, firstLength);
+
+  if (firstLength < length) {
+    f(0, firstLength, length - firstLength);
+  }
+}
+
+} // namespace
+
+DelayNode::DelayNode(BaseAudioContext *context, float maxDelayTime)
+    : AudioNode(context),
+      maxDelayTime_(maxDelayTime),
+      delayFrames_(RENDER_QUANTUM_SIZE) {
+  channelCountMode_ = ChannelCountMode::EXPLICIT;
+  canBreakCycle_ = true;
+  delayTimeParam_ =
+      std::make_shared<AudioParam>(0.0f, 0.0f, maxDelayTime, context);
+
+  // In a cycle the delay is at least one quantum, whatever maxDelayTime is.
+  // One frame more is kept for the interpolation.
+  auto maxDelayFrames = std::max(
+      static_cast<size_t>(std::ceil(maxDelayTime * context->getSampleRate())),
+      static_cast<size_t>(RENDER_QUANTUM_SIZE));
+  delayBuffer_ = std::make_shared<AudioBus>(
+      maxDelayFrames + RENDER_QUANTUM_SIZE + 1,
+      channelCount_,
+      context->getSampleRate());
+  // the echoes in the ring are played out after the input stops
+  tailFrames_.store(
+      maxDelayFrames + RENDER_QUANTUM_SIZE, std::memory_order_relaxed);
+
+  isInitialized_ = true;
+}
+
+std::shared_ptr<AudioParam> DelayNode::getDelayTimeParam() const {
+  return delayTimeParam_;
+}
+
+const std::shared_ptr<AudioBus> &DelayNode::processAudio(
+    const std::shared_ptr<AudioBus> &outputBus,
+    int framesToProcess,
+    bool checkIsAlreadyProcessed) {
+  if (!isBreakingCycle_) {
+    return AudioNode::processAudio(
+        outputBus, framesToProcess, checkIsAlreadyProcessed);
+  }
+
+  if (!isInitialized_) {
+    return outputBus;
+  }
+
+  if (checkIsAlreadyProcessed && isAlreadyProcessed()) {
+    return lastRenderedBus_ != nullptr ? lastRenderedBus_ : audioBus_;
+  }
+
+  // Inputs are not pulled, they are written in processCycleInputs.
+  readOutput(framesToProcess, static_cast<float>(RENDER_QUANTUM_SIZE));
+  lastRenderedBus_ = audioBus_;
+
+  return lastRenderedBus_;
+}
+
+void DelayNode::processCycleInputs(int framesToProcess) {
+  // Reuses audioBus_, its output has already been consumed in this quantum.
+  const auto &inputsBus = processInputs(audioBus_, framesToProcess, true);
+  const auto &processingBus = applyChannelCountMode(inputsBus);
+  mixInputsBuses(processingBus);
+
+  writeInput(processingBus, framesToProcess);
+  writeIndex_ = (writeIndex_ + framesToProcess) % delayBuffer_->getSize();
+}
+
+std::shared_ptr<AudioBus> DelayNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  // Input is written first, so delays shorter than the quantum read it too.
+  writeInput(processingBus, framesToProcess);
+  readOutput(framesToProcess, 0.0f);
+  writeIndex_ = (writeIndex_ + framesToProcess) % delayBuffer_->getSize();
+
+  return audioBus_;
+}
+
+void DelayNode::writeInput(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  auto ringSize = delayBuffer_->getSize();
+
+  for (int c = 0; c < delayBuffer_->getNumberOfChannels(); ++c) {
+    auto *ring = delayBuffer_->getChannel(c)->getData();
+    const auto *input = processingBus->getChannel(c)->getData();
+
+    forEachRingSegment(
+        writeIndex_,
+        framesToProcess,
+        ringSize,
+        [ring, input](size_t ringStart, size_t offset, size_t length) {
+          std::memcpy(ring + ringStart, input + offset, length * sizeof(float));
+        });
+  }
+}
+
+void DelayNode::readOutput(int framesToProcess, float minDelayFrames) {
+  double time = context_->getCurrentTime();
+  auto sampleRate = context_->getSampleRate();
+  auto maxDelayFrames = std::max(maxDelayTime_ * sampleRate, minDelayFrames);
+
+  if (delayTimeParam_->isConstant(framesToProcess, time)) {
+    auto delayFrames = std::clamp(
+        delayTimeParam_->processKRateParam(framesToProcess, time) * sampleRate,
+        minDelayFrames,
+        maxDelayFrames);
+    readConstantDelay(delayFrames, framesToProcess);
+    return;
+  }
+
+  const auto *delayTimes =
+      delayTimeParam_->processARateParam(framesToProcess, time)
+          ->getChannel(0)
+          ->getData();
+  auto *delayFrames = delayFrames_.getData();
+
+  dsp::multiplyByScalar(delayTimes, sampleRate, delayFrames, framesToProcess);
+  dsp::clip(
+      delayFrames,
+      minDelayFrames,
+      maxDelayFrames,
+      delayFrames,
+      framesToProcess);
+  readAutomatedDelay(delayFrames, framesToProcess);
+}
+
+void DelayNode::readConstantDelay(float delayFrames, int framesToProcess) {
+  auto ringSize = delayBuffer_->getSize();
+  auto integerDelay = static_cast<size_t>(delayFrames);
+  auto fraction = delayFrames - static_cast<float>(integerDelay);
+  auto readIndex = (writeIndex_ + ringSize - integerDelay) % ringSize;
+  auto previousIndex = readIndex == 0 ? ringSize - 1 : readIndex - 1;
+
+  for (int c = 0; c < audioBus_->getNumberOfChannels(); ++c) {
+    const auto *ring = delayBuffer_->getChannel(c)->getData();
+    auto *output = audioBus_->getChannel(c)->getData();
+
+    if (fraction == 0.0f) {
+      forEachRingSegment(
+          readIndex,
+          framesToProcess,
+          ringSize,
+          [ring, output](size_t ringStart, size_t offset, size_t length) {
+            std::memcpy(
+                output + offset, ring + ringStart, length * sizeof(float));
+          });
+      continue;
+    }
+
+    // y[i] = (1 - fraction) * x[i - delay] + fraction * x[i - delay - 1]
+    forEachRingSegment(
+        readIndex,
+        framesToProcess,
+        ringSize,
+        [ring, output, fraction](
+            size_t ringStart, size_t offset, size_t length) {
+          dsp::multiplyByScalar(
+              ring + ringStart, 1.0f - fraction, output + offset, length);
+        });
+    forEachRingSegment(
+        previousIndex,
+        framesToProcess,
+        ringSize,
+        [ring, output, fraction](
+            size_t ringStart, size_t offset, size_t length) {
+          dsp::multiplyByScalarThenAddToOutput(
+              ring + ringStart, fraction, output + offset, length);
+        });
+  }
+}
+
+void DelayNode::readAutomatedDelay(float *delayFrames, int framesToProcess) {
+  auto ringSize = delayBuffer_->getSize();
+
+  // Read positions are shared by all channels, delayFrames is turned into the
+  // interpolation factors in place.
+  for (int i = 0; i < framesToProcess; ++i) {
+    auto integerDelay = static_cast<size_t>(delayFrames[i]);
+    delayFrames[i] -= static_cast<float>(integerDelay);
+    readIndices_[i] = (writeIndex_ + i + ringSize - integerDelay) % ringSize;
+  }
+
+  for (int c = 0; c < audioBus_->getNumberOfChannels(); ++c) {
+    const auto *ring = delayBuffer_->getChannel(c)->getData();
+    auto *output = audioBus_->getChannel(c)->getData();
+
+    for (int i = 0; i < framesToProcess; ++i) {
+      auto index = readIndices_[i];
+      auto previousIndex = index == 0 ? ringSize - 1 : index - 1;
+      output[i] =
+          ring[index] + delayFrames[i] * (ring[previousIndex] - ring[index]);
+    }
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <audioapi/core/AudioNode.h>
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/utils/AudioArray.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief Delays the input by delayTime seconds, up to maxDelayTime.
+/// @note Input is kept in a ring buffer. A constant whole number of frames is read with block copies,
+/// a constant fractional delay with vectorized linear interpolation and an automated one is interpolated per frame.
+/// @note A DelayNode on a cycle of the graph breaks it. Its output is read from the ring before the rest of the cycle is rendered
+/// and its inputs are written once the quantum is rendered, so in a cycle the delay is at least one render quantum.
+/// @note Output is always stereo, mono input is upmixed.
+class DelayNode : public AudioNode {
+ public:
+  explicit DelayNode(BaseAudioContext *context, float maxDelayTime);
+
+  [[nodiscard]] std::shared_ptr<AudioParam> getDelayTimeParam() const;
+
+  const std::shared_ptr<AudioBus> &processAudio(const std::shared_ptr<AudioBus> &outputBus, int framesToProcess, bool checkIsAlreadyProcessed) override;
+
+  /// @brief Writes the inputs of a delay node breaking a cycle into the ring.
+  /// @note Called once per quantum, after all nodes are rendered, see AudioNodeManager::getCycleBreakingDelays.
+  void processCycleInputs(int framesToProcess);
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus> &processingBus, int framesToProcess) override;
+
+ private:
+  std::shared_ptr<AudioParam> delayTimeParam_;
+  float maxDelayTime_;
+
+  // ring of past input, writeIndex_ is where the current quantum starts
+  std::shared_ptr<AudioBus> delayBuffer_;
+  size_t writeIndex_ = 0;
+
+  // per frame delays and read positions of an automated delay
+  AudioArray delayFrames_;
+  std::array<size_t, RENDER_QUANTUM_SIZE> readIndices_ {};
+
+  void writeInput(const std::shared_ptr<AudioBus> &processingBus, int framesToProcess);
+  void readOutput(int framesToProcess, float minDelayFrames);
+  void readConstantDelay(float delayFrames, int framesToProcess);
+  void readAutomatedDelay(float *delayFrames, int framesToProcess);
+};
+
+} // namespace audioapi
@@ -20,7 +20,22 @@ std::shared_ptr<AudioBus> GainNode::processNode(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess) {
   double time = context_->getCurrentTime();
-  auto gainParamValues = gainParam_->processARateParam(framesToProcess, time);
+
+  if (gainParam_->isConstant(framesToProcess, time)) {
+    auto gain = gainParam_->processKRateParam(framesToProcess, time);
+    for (int i = 0; i < processingBus->getNumberOfChannels(); i += 1) {
+      dsp::multiplyByScalar(
+          processingBus->getChannel(i)->getData(),
+          gain,
+          processingBus->getChannel(i)->getData(),
+          framesToProcess);
+    }
+
+    return processingBus;
+  }
+
+  const auto &gainParamValues =
+      gainParam_->processARateParam(framesToProcess, time);
   for (int i = 0; i < processingBus->getNumberOfChannels(); i += 1) {
     dsp::multiply(
         processingBus->getChannel(i)->getData(),
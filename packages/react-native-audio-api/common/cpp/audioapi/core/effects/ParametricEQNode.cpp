@@ -0,0 +1,163 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/effects/BiquadFilterNode.h>
+#include <audioapi/core/effects/ParametricEQNode.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <array>
+#include <complex>
+
+namespace audioapi {
+
+ParametricEQNode::ParametricEQNode(
+    BaseAudioContext *context,
+    int numberOfBands)
+    : AudioNode(context),
+      numberOfBands_(
+          std::clamp(numberOfBands, 1, PARAMETRIC_EQ_MAX_NUMBER_OF_BANDS)),
+      bands_(std::make_unique<Band[]>(numberOfBands_)),
+      biquad_(MAX_CHANNEL_COUNT, numberOfBands_) {
+  for (int i = 0; i < numberOfBands_; ++i) {
+    float position = numberOfBands_ == 1
+        ? 0.5f
+        : static_cast<float>(i) / static_cast<float>(numberOfBands_ - 1);
+    bands_[i].frequency = PARAMETRIC_EQ_LOWEST_BAND_FREQUENCY *
+        std::pow(PARAMETRIC_EQ_HIGHEST_BAND_FREQUENCY /
+                     PARAMETRIC_EQ_LOWEST_BAND_FREQUENCY,
+                 position);
+  }
+
+  isInitialized_ = true;
+  channelCountMode_ = ChannelCountMode::MAX;
+}
+
+int ParametricEQNode::getNumberOfBands() const {
+  return numberOfBands_;
+}
+
+std::string ParametricEQNode::getBandType(int band) const {
+  return BiquadFilterNode::toString(bands_[band].type.load());
+}
+
+void ParametricEQNode::setBandType(int band, const std::string &type) {
+  bands_[band].type.store(BiquadFilterNode::fromString(type));
+}
+
+float ParametricEQNode::getBandFrequency(int band) const {
+  return bands_[band].frequency.load();
+}
+
+void ParametricEQNode::setBandFrequency(int band, float frequency) {
+  bands_[band].frequency.store(frequency);
+}
+
+float ParametricEQNode::getBandQ(int band) const {
+  return bands_[band].Q.load();
+}
+
+void ParametricEQNode::setBandQ(int band, float Q) {
+  bands_[band].Q.store(Q);
+}
+
+float ParametricEQNode::getBandGain(int band) const {
+  return bands_[band].gain.load();
+}
+
+void ParametricEQNode::setBandGain(int band, float gain) {
+  bands_[band].gain.store(gain);
+}
+
+void ParametricEQNode::getFrequencyResponse(
+    const float *frequencyArray,
+    float *magResponseOutput,
+    float *phaseResponseOutput,
+    int length) {
+  auto nyquistFrequency = context_->getNyquistFrequency();
+
+  for (int i = 0; i < length; ++i) {
+    if (frequencyArray[i] < 0.0f || frequencyArray[i] > nyquistFrequency) {
+      magResponseOutput[i] = std::nanf("");
+      phaseResponseOutput[i] = std::nanf("");
+    } else {
+      magResponseOutput[i] = 1.0f;
+      phaseResponseOutput[i] = 0.0f;
+    }
+  }
+
+  // The response of a cascade is the product of the section responses.
+  for (int band = 0; band < numberOfBands_; ++band) {
+    auto coefficients = getBandCoefficients(
+        bands_[band].type.load(),
+        bands_[band].frequency.load(),
+        bands_[band].Q.load(),
+        bands_[band].gain.load());
+
+    for (int i = 0; i < length; ++i) {
+      if (std::isnan(magResponseOutput[i])) {
+        continue;
+      }
+
+      auto response =
+          coefficients.getResponse(frequencyArray[i] / nyquistFrequency);
+      magResponseOutput[i] *= std::abs(response);
+      phaseResponseOutput[i] += std::arg(response);
+    }
+  }
+
+  // wrap the accumulated phase back to [-pi, pi]
+  for (int i = 0; i < length; ++i) {
+    phaseResponseOutput[i] = std::remainder(phaseResponseOutput[i], 2 * PI);
+  }
+}
+
+std::shared_ptr<AudioBus> ParametricEQNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  updateCoefficients();
+
+  int numChannels =
+      std::min(processingBus->getNumberOfChannels(), MAX_CHANNEL_COUNT);
+  std::array<float *, MAX_CHANNEL_COUNT> channels{};
+  for (int c = 0; c < numChannels; ++c) {
+    channels[c] = processingBus->getChannel(c)->getData();
+  }
+
+  biquad_.process(channels.data(), numChannels, framesToProcess);
+
+  return processingBus;
+}
+
+dsp::BiquadCoefficients ParametricEQNode::getBandCoefficients(
+    BiquadFilterType type,
+    float frequency,
+    float Q,
+    float gain) const {
+  return dsp::BiquadCoefficients::design(
+      type, frequency / context_->getNyquistFrequency(), Q, gain);
+}
+
+void ParametricEQNode::updateCoefficients() {
+  for (int i = 0; i < numberOfBands_; ++i) {
+    auto &band = bands_[i];
+    auto type = band.type.load(std::memory_order_relaxed);
+    auto frequency = band.frequency.load(std::memory_order_relaxed);
+    auto Q = band.Q.load(std::memory_order_relaxed);
+    auto gain = band.gain.load(std::memory_order_relaxed);
+
+    if (type == band.coefficientsType &&
+        frequency == band.coefficientsFrequency && Q == band.coefficientsQ &&
+        gain == band.coefficientsGain) {
+      continue;
+    }
+
+    band.coefficientsType = type;
+    band.coefficientsFrequency = frequency;
+    band.coefficientsQ = Q;
+    band.coefficientsGain = gain;
+
+    biquad_.setCoefficients(getBandCoefficients(type, frequency, Q, gain), i);
+  }
+}
+
+} // namespace audioapi
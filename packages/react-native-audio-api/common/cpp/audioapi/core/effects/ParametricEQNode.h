@@ -0,0 +1,72 @@
+#pragma once
+
+#include <audioapi/core/AudioNode.h>
+#include <audioapi/core/types/BiquadFilterType.h>
+#include <audioapi/dsp/Biquad.h>
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief Multiband equalizer, every band is one biquad section of the same fused cascade.
+/// @note Bands are plain values rather than AudioParams, they are set from the JS thread and picked up at the start of the next quantum.
+/// Coefficients of a band are recomputed only when its settings change.
+class ParametricEQNode : public AudioNode {
+ public:
+  explicit ParametricEQNode(BaseAudioContext *context, int numberOfBands);
+
+  [[nodiscard]] int getNumberOfBands() const;
+  [[nodiscard]] std::string getBandType(int band) const;
+  void setBandType(int band, const std::string &type);
+  [[nodiscard]] float getBandFrequency(int band) const;
+  void setBandFrequency(int band, float frequency);
+  [[nodiscard]] float getBandQ(int band) const;
+  void setBandQ(int band, float Q);
+  [[nodiscard]] float getBandGain(int band) const;
+  void setBandGain(int band, float gain);
+
+  /// @brief Computes the response of the whole cascade.
+  /// @note Frequencies are in Hz, NaN is written for frequencies outside of [0, nyquist].
+  void getFrequencyResponse(
+      const float *frequencyArray,
+      float *magResponseOutput,
+      float *phaseResponseOutput,
+      int length);
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(
+      const std::shared_ptr<AudioBus> &processingBus,
+      int framesToProcess) override;
+
+ private:
+  struct Band {
+    // written on the JS thread
+    std::atomic<BiquadFilterType> type {BiquadFilterType::PEAKING};
+    std::atomic<float> frequency {0.0f};
+    std::atomic<float> Q {1.0f};
+    std::atomic<float> gain {0.0f};
+
+    // settings of the current coefficients, audio thread only
+    // NaN never compares equal, so the first quantum always computes coefficients.
+    BiquadFilterType coefficientsType = BiquadFilterType::PEAKING;
+    float coefficientsFrequency = std::nanf("");
+    float coefficientsQ = 0.0f;
+    float coefficientsGain = 0.0f;
+  };
+
+  int numberOfBands_;
+  std::unique_ptr<Band[]> bands_;
+
+  // one section per band
+  dsp::Biquad biquad_;
+
+  [[nodiscard]] dsp::BiquadCoefficients getBandCoefficients(BiquadFilterType type, float frequency, float Q, float gain) const;
+  void updateCoefficients();
+};
+
+} // namespace audioapi
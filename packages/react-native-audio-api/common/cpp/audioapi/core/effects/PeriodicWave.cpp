@@ -30,11 +30,95 @@
 #include <audioapi/core/utils/Constants.h>
 #include <audioapi/dsp/VectorMath.h>
 
+#include <bit>
+
 constexpr unsigned NumberOfOctaveBands = 3;
 constexpr float CentsPerRange = 1200.0f / NumberOfOctaveBands;
 constexpr float interpolate2Point = 0.3;
 constexpr float interpolate3Point = 0.16;
 
+namespace {
+
+// Number of phases computed at once by render, they fit on the stack.
+constexpr size_t RenderChunkSize = 64;
+
+// Lagrange weights of the samples around the phase, factor is the fraction
+// past the sample at index.
+template <int NumberOfPoints>
+inline void getInterpolationWeights(float factor, float *weights) {
+  if constexpr (NumberOfPoints == 2) {
+    weights[0] = 1 - factor;
+    weights[1] = factor;
+  } else if constexpr (NumberOfPoints == 3) {
+    weights[0] = factor * (factor - 1) / 2;
+    weights[1] = 1 - factor * factor;
+    weights[2] = factor * (factor + 1) / 2;
+  } else {
+    weights[0] = factor * (factor * factor - 1) * (factor - 2) / 24;
+    weights[1] = -factor * (factor - 1) * (factor * factor - 4) / 6;
+    weights[2] = (factor * factor - 1) * (factor * factor - 4) / 4;
+    weights[3] = -factor * (factor + 1) * (factor * factor - 4) / 6;
+    weights[4] = factor * (factor * factor - 1) * (factor + 2) / 24;
+  }
+}
+
+template <int NumberOfPoints>
+uint32_t renderWithInterpolation(
+    const float *lowerWaveData,
+    const float *higherWaveData,
+    float waveTableInterpolationFactor,
+    uint32_t phase,
+    uint32_t phaseIncrement,
+    int phaseFractionBits,
+    float *output,
+    size_t frames) {
+  // the first point is that many samples before the index
+  constexpr int firstPoint = (NumberOfPoints - 1) / 2;
+
+  const uint32_t indexMask = (~0u) >> phaseFractionBits;
+  const uint32_t fractionMask = (1u << phaseFractionBits) - 1;
+  const float fractionScale =
+      1.0f / static_cast<float>(1u << phaseFractionBits);
+
+  uint32_t indices[RenderChunkSize];
+  float factors[RenderChunkSize];
+
+  for (size_t start = 0; start < frames; start += RenderChunkSize) {
+    auto chunkSize = std::min(RenderChunkSize, frames - start);
+
+    // Every phase is computed from the first one, there is no dependency
+    // between the frames, so the compiler vectorizes this loop.
+    for (size_t i = 0; i < chunkSize; i++) {
+      auto framePhase = phase + static_cast<uint32_t>(i) * phaseIncrement;
+      indices[i] = framePhase >> phaseFractionBits;
+      factors[i] =
+          static_cast<float>(framePhase & fractionMask) * fractionScale;
+    }
+    phase += static_cast<uint32_t>(chunkSize) * phaseIncrement;
+
+    for (size_t i = 0; i < chunkSize; i++) {
+      float weights[NumberOfPoints];
+      getInterpolationWeights<NumberOfPoints>(factors[i], weights);
+
+      float lowerWaveDataSample = 0;
+      float higherWaveDataSample = 0;
+      for (int j = 0; j < NumberOfPoints; j++) {
+        auto index = (indices[i] + j - firstPoint) & indexMask;
+        lowerWaveDataSample += lowerWaveData[index] * weights[j];
+        higherWaveDataSample += higherWaveData[index] * weights[j];
+      }
+
+      output[start + i] =
+          (1 - waveTableInterpolationFactor) * higherWaveDataSample +
+          waveTableInterpolationFactor * lowerWaveDataSample;
+    }
+  }
+
+  return phase;
+}
+
+} // namespace
+
 namespace audioapi {
 PeriodicWave::PeriodicWave(float sampleRate, bool disableNormalization)
     : sampleRate_(sampleRate), disableNormalization_(disableNormalization) {
@@ -45,6 +129,8 @@ PeriodicWave::PeriodicWave(float sampleRate, bool disableNormalization)
       static_cast<float>(getMaxNumberOfPartials());
   scale_ = static_cast<float>(getPeriodicWaveSize()) /
       static_cast<float>(sampleRate_);
+  phaseFractionBits_ =
+      32 - std::countr_zero(static_cast<uint32_t>(getPeriodicWaveSize()));
   bandLimitedTables_ = new float *[numberOfRanges_];
 
   fft_ = std::make_unique<dsp::FFT>(getPeriodicWaveSize());
@@ -101,14 +187,101 @@ float PeriodicWave::getSample(
   auto interpolationFactor = getWaveDataForFundamentalFrequency(
       fundamentalFrequency, lowerWaveData, higherWaveData);
 
+  int index = static_cast<int>(phase);
   return doInterpolation(
-      phase,
+      index,
+      phase - static_cast<float>(index),
       phaseIncrement,
       interpolationFactor,
       lowerWaveData,
       higherWaveData);
 }
 
+uint32_t PeriodicWave::getPhaseIncrement(float fundamentalFrequency) const {
+  auto phaseIncrement = static_cast<double>(fundamentalFrequency * scale_) *
+      static_cast<double>(1u << phaseFractionBits_);
+  // negative frequencies wrap around to a decreasing phase
+  return static_cast<uint32_t>(
+      static_cast<int64_t>(std::llround(phaseIncrement)));
+}
+
+uint32_t PeriodicWave::render(
+    float fundamentalFrequency,
+    uint32_t phase,
+    float *output,
+    size_t frames) const {
+  float *lowerWaveData = nullptr;
+  float *higherWaveData = nullptr;
+  auto interpolationFactor = getWaveDataForFundamentalFrequency(
+      fundamentalFrequency, lowerWaveData, higherWaveData);
+
+  auto phaseIncrement = getPhaseIncrement(fundamentalFrequency);
+  auto tableIncrement = std::fabs(fundamentalFrequency * scale_);
+
+  if (tableIncrement >= interpolate2Point) {
+    return renderWithInterpolation<2>(
+        lowerWaveData,
+        higherWaveData,
+        interpolationFactor,
+        phase,
+        phaseIncrement,
+        phaseFractionBits_,
+        output,
+        frames);
+  }
+
+  if (tableIncrement >= interpolate3Point) {
+    return renderWithInterpolation<3>(
+        lowerWaveData,
+        higherWaveData,
+        interpolationFactor,
+        phase,
+        phaseIncrement,
+        phaseFractionBits_,
+        output,
+        frames);
+  }
+
+  return renderWithInterpolation<5>(
+      lowerWaveData,
+      higherWaveData,
+      interpolationFactor,
+      phase,
+      phaseIncrement,
+      phaseFractionBits_,
+      output,
+      frames);
+}
+
+uint32_t PeriodicWave::render(
+    const float *fundamentalFrequencies,
+    uint32_t phase,
+    float *output,
+    size_t frames) const {
+  const uint32_t fractionMask = (1u << phaseFractionBits_) - 1;
+  const float fractionScale =
+      1.0f / static_cast<float>(1u << phaseFractionBits_);
+
+  for (size_t i = 0; i < frames; i++) {
+    float *lowerWaveData = nullptr;
+    float *higherWaveData = nullptr;
+    auto interpolationFactor = getWaveDataForFundamentalFrequency(
+        fundamentalFrequencies[i], lowerWaveData, higherWaveData);
+
+    output[i] = doInterpolation(
+        static_cast<int>(phase >> phaseFractionBits_),
+        static_cast<float>(phase & fractionMask) * fractionScale,
+        std::fabs(fundamentalFrequencies[i] * scale_),
+        interpolationFactor,
+        lowerWaveData,
+        higherWaveData);
+
+    phase += getPhaseIncrement(fundamentalFrequencies[i]);
+  }
+
+  return phase;
+}
+
 int PeriodicWave::getMaxNumberOfPartials() const {
   return getPeriodicWaveSize() / 2;
 }
@@ -248,7 +421,7 @@ void PeriodicWave::createBandLimitedTables(
 float PeriodicWave::getWaveDataForFundamentalFrequency(
     float fundamentalFrequency,
     float *&lowerWaveData,
-    float *&higherWaveData) {
+    float *&higherWaveData) const {
   // negative frequencies are allowed and will be treated as positive.
   fundamentalFrequency = std::fabs(fundamentalFrequency);
 
@@ -278,7 +451,8 @@ float PeriodicWave::getWaveDataForFundamentalFrequency(
 }
 
 float PeriodicWave::doInterpolation(
-    float phase,
+    int index,
+    float factor,
     float phaseIncrement,
     float waveTableInterpolationFactor,
     const float *lowerWaveData,
@@ -289,9 +463,6 @@ float PeriodicWave::doInterpolation(
   // We use linear, 3-point Lagrange, or 5-point Lagrange interpolation based on
   // the value of phase increment. https://dlmf.nist.gov/3.3#ii
 
-  int index = static_cast<int>(phase);
-  auto factor = phase - static_cast<float>(index);
-
   if (phaseIncrement >= interpolate2Point) { // linear interpolation
     int indices[2];
 
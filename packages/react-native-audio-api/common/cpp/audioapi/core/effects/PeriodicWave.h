@@ -33,6 +33,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <complex>
@@ -57,6 +59,30 @@ class PeriodicWave {
   float
   getSample(float fundamentalFrequency, float phase, float phaseIncrement);
 
+  // Oscillators keep a fixed-point phase, the whole period is 2^32, so it
+  // wraps around by itself. The upper bits index the tables, the rest is the
+  // fraction between two of their samples.
+  [[nodiscard]] uint32_t getPhaseIncrement(float fundamentalFrequency) const;
+
+  // Renders frames samples of a tone of constant fundamental frequency,
+  // starting at phase. Tables and interpolation are chosen once for the whole
+  // block and the phases of all samples are computed independently, so the
+  // loop has no per sample pow, log or floor. Returns the phase after the last
+  // sample.
+  uint32_t render(
+      float fundamentalFrequency,
+      uint32_t phase,
+      float *output,
+      size_t frames) const;
+
+  // Renders one sample per fundamental frequency, for frequencies changing
+  // every sample. Returns the phase after the last sample.
+  uint32_t render(
+      const float *fundamentalFrequencies,
+      uint32_t phase,
+      float *output,
+      size_t frames) const;
+
  private:
   explicit PeriodicWave(float sampleRate, bool disableNormalization);
 
@@ -89,14 +115,15 @@ class PeriodicWave {
   float getWaveDataForFundamentalFrequency(
       float fundamentalFrequency,
       float *&lowerWaveData,
-      float *&higherWaveData);
+      float *&higherWaveData) const;
 
   // This function performs interpolation between the lower and higher range
-  // data based on the interpolation factor and current buffer index. Type of
-  // interpolation is determined by the phase increment. Returns the
-  // interpolated sample.
+  // data based on the interpolation factor and current buffer index and the
+  // fraction past it. Type of interpolation is determined by the phase
+  // increment. Returns the interpolated sample.
   float doInterpolation(
-      float bufferIndex,
+      int index,
+      float factor,
       float phaseIncrement,
       float waveTableInterpolationFactor,
       const float *lowerWaveData,
@@ -112,6 +139,8 @@ class PeriodicWave {
   // scaling factor used to adjust size of period of waveform to the sample
   // rate.
   float scale_;
+  // number of bits of the fixed-point phase below the table index.
+  int phaseFractionBits_;
   // array of band-limited waveforms.
   float **bandLimitedTables_;
   //
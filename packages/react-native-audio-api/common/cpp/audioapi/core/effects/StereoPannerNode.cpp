@@ -1,6 +1,7 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/effects/StereoPannerNode.h>
 #include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 
@@ -26,13 +27,69 @@ std::shared_ptr<AudioBus> StereoPannerNode::processNode(
   double deltaTime = 1.0 / context_->getSampleRate();
 
   auto *inputLeft = processingBus->getChannelByType(AudioBus::ChannelLeft);
+  auto *outputLeft = audioBus_->getChannelByType(AudioBus::ChannelLeft);
+  auto *outputRight = audioBus_->getChannelByType(AudioBus::ChannelRight);
+
+  if (panParam_->isConstant(framesToProcess, time)) {
+    auto pan = std::clamp(
+        panParam_->processKRateParam(framesToProcess, time), -1.0f, 1.0f);
+
+    // Input is mono
+    if (processingBus->getNumberOfChannels() == 1) {
+      auto x = (pan + 1) / 2;
+
+      dsp::multiplyByScalar(
+          inputLeft->getData(),
+          static_cast<float>(cos(x * PI / 2)),
+          outputLeft->getData(),
+          framesToProcess);
+      dsp::multiplyByScalar(
+          inputLeft->getData(),
+          static_cast<float>(sin(x * PI / 2)),
+          outputRight->getData(),
+          framesToProcess);
+    } else { // Input is stereo
+      auto *inputRight =
+          processingBus->getChannelByType(AudioBus::ChannelRight);
+      auto x = (pan <= 0 ? pan + 1 : pan);
+
+      auto gainL = static_cast<float>(cos(x * PI / 2));
+      auto gainR = static_cast<float>(sin(x * PI / 2));
+
+      if (pan <= 0) {
+        outputLeft->copy(inputLeft, 0, framesToProcess);
+        dsp::multiplyByScalarThenAddToOutput(
+            inputRight->getData(),
+            gainL,
+            outputLeft->getData(),
+            framesToProcess);
+        dsp::multiplyByScalar(
+            inputRight->getData(),
+            gainR,
+            outputRight->getData(),
+            framesToProcess);
+      } else {
+        outputRight->copy(inputRight, 0, framesToProcess);
+        dsp::multiplyByScalar(
+            inputLeft->getData(),
+            gainL,
+            outputLeft->getData(),
+            framesToProcess);
+        dsp::multiplyByScalarThenAddToOutput(
+            inputLeft->getData(),
+            gainR,
+            outputRight->getData(),
+            framesToProcess);
+      }
+    }
+
+    return audioBus_;
+  }
+
   auto panParamValues = panParam_->processARateParam(framesToProcess, time)
                             ->getChannel(0)
                             ->getData();
 
-  auto *outputLeft = audioBus_->getChannelByType(AudioBus::ChannelLeft);
-  auto *outputRight = audioBus_->getChannelByType(AudioBus::ChannelRight);
-
   // Input is mono
   if (processingBus->getNumberOfChannels() == 1) {
     for (int i = 0; i < framesToProcess; i++) {
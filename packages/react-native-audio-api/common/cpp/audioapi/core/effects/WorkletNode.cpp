@@ -15,6 +15,7 @@ WorkletNode::WorkletNode(
       shareableWorklet_(worklet),
       inputChannelCount_(inputChannelCount),
       curBuffIndex_(0) {
+  requiresSerialRender_ = true;
   buffs_.reserve(inputChannelCount_);
   for (size_t i = 0; i < inputChannelCount_; ++i) {
     buffs_.emplace_back(new uint8_t[buffRealLength_]);
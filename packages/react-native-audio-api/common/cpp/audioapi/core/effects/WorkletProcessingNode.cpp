@@ -9,6 +9,7 @@ WorkletProcessingNode::WorkletProcessingNode(
     std::weak_ptr<worklets::WorkletRuntime> runtime)
     : AudioNode(context), workletRunner_(runtime), shareableWorklet_(worklet) {
   isInitialized_ = true;
+  requiresSerialRender_ = true;
 
   // Pre-allocate buffers for max 128 frames and 2 channels (stereo)
   size_t maxChannelCount = 2;
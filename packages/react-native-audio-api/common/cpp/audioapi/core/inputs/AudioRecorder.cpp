@@ -6,6 +6,7 @@
 #include <audioapi/utils/AudioBus.h>
 #include <audioapi/utils/CircularAudioArray.h>
 #include <audioapi/utils/CircularOverflowableAudioArray.h>
+#include <audioapi/utils/SharedAudioRing.h>
 
 namespace audioapi {
 
@@ -23,12 +24,22 @@ AudioRecorder::AudioRecorder(
 }
 
 void AudioRecorder::setOnAudioReadyCallbackId(uint64_t callbackId) {
-  onAudioReadyCallbackId_ = callbackId;
+  onAudioReadyCallbackId_.store(callbackId, std::memory_order_release);
+}
+
+bool AudioRecorder::hasOnAudioReadyCallback() const {
+  return audioEventHandlerRegistry_ != nullptr &&
+      onAudioReadyCallbackId_.load(std::memory_order_acquire) != 0;
 }
 
 void AudioRecorder::invokeOnAudioReadyCallback(
     const std::shared_ptr<AudioBus> &bus,
     int numFrames) {
+  auto callbackId = onAudioReadyCallbackId_.load(std::memory_order_acquire);
+  if (audioEventHandlerRegistry_ == nullptr || callbackId == 0) {
+    return;
+  }
+
   auto audioBuffer = std::make_shared<AudioBuffer>(bus);
   auto audioBufferHostObject =
       std::make_shared<AudioBufferHostObject>(audioBuffer);
@@ -37,13 +48,16 @@ void AudioRecorder::invokeOnAudioReadyCallback(
   body.insert({"buffer", audioBufferHostObject});
   body.insert({"numFrames", numFrames});
 
-  if (audioEventHandlerRegistry_ != nullptr) {
-    audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        "audioReady", onAudioReadyCallbackId_, body);
-  }
+  audioEventHandlerRegistry_->invokeHandlerWithEventBody(
+      "audioReady", callbackId, body);
 }
 
 void AudioRecorder::sendRemainingData() {
+  if (!hasOnAudioReadyCallback() ||
+      circularBuffer_->getNumberOfAvailableFrames() == 0) {
+    return;
+  }
+
   auto bus = std::make_shared<AudioBus>(
       circularBuffer_->getNumberOfAvailableFrames(), 1, sampleRate_);
   auto *outputChannel = bus->getChannel(0)->getData();
@@ -69,6 +83,12 @@ void AudioRecorder::disconnect() {
   adapterNodeLock_.unlock();
 }
 
+void AudioRecorder::setTap(const std::shared_ptr<SharedAudioRing> &tap) {
+  tapLock_.lock();
+  tap_ = tap;
+  tapLock_.unlock();
+}
+
 void AudioRecorder::writeToBuffers(const float *data, int numFrames) {
   if (adapterNodeLock_.try_lock()) {
     if (adapterNode_ != nullptr) {
@@ -76,7 +96,17 @@ void AudioRecorder::writeToBuffers(const float *data, int numFrames) {
     }
     adapterNodeLock_.unlock();
   }
-  circularBuffer_->push_back(data, numFrames);
+  if (tapLock_.try_lock()) {
+    if (tap_ != nullptr) {
+      tap_->write(data, numFrames);
+    }
+    tapLock_.unlock();
+  }
+  // nobody listens, e.g. when the audio is read through a tap, so nothing
+  // is buffered for the audioReady events
+  if (hasOnAudioReadyCallback()) {
+    circularBuffer_->push_back(data, numFrames);
+  }
 }
 
 } // namespace audioapi
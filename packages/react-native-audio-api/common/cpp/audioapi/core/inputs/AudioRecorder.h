@@ -11,6 +11,7 @@ class AudioBus;
 class CircularAudioArray;
 class CircularOverflowableAudioArray;
 class AudioEventHandlerRegistry;
+class SharedAudioRing;
 
 class AudioRecorder {
  public:
@@ -23,6 +24,9 @@ class AudioRecorder {
   virtual ~AudioRecorder() = default;
 
   void setOnAudioReadyCallbackId(uint64_t callbackId);
+  /// @brief Whether recorded buffers are sent to JS in audioReady events.
+  /// @note Without a listener, e.g. when the audio is read through a tap, the recorder allocates nothing per buffer.
+  bool hasOnAudioReadyCallback() const;
   void invokeOnAudioReadyCallback(const std::shared_ptr<AudioBus> &bus, int numFrames);
   void sendRemainingData();
 
@@ -40,6 +44,13 @@ class AudioRecorder {
   /// @note Last few frames of audio might be written to the buffer after disconnecting.
   void disconnect();
 
+  /// @brief
+  /// # Sets the ring every recorded frame is written to, nullptr removes it.
+  ///
+  /// The ring is read by JS in place, so recorded audio reaches it without any allocation or event.
+  /// @note Frames recorded while the ring is full are dropped.
+  void setTap(const std::shared_ptr<SharedAudioRing> &tap);
+
   virtual void start() = 0;
   virtual void stop() = 0;
 
@@ -54,8 +65,11 @@ class AudioRecorder {
   mutable std::mutex adapterNodeLock_;
   std::shared_ptr<RecorderAdapterNode> adapterNode_ = nullptr;
 
+  mutable std::mutex tapLock_;
+  std::shared_ptr<SharedAudioRing> tap_ = nullptr;
+
   std::shared_ptr<AudioEventHandlerRegistry> audioEventHandlerRegistry_;
-  uint64_t onAudioReadyCallbackId_ = 0;
+  std::atomic<uint64_t> onAudioReadyCallbackId_ = 0;
 
   void writeToBuffers(const float *data, int numFrames);
 };
@@ -70,14 +70,15 @@ std::mutex &AudioBufferBaseSourceNode::getBufferLock() {
 }
 
 void AudioBufferBaseSourceNode::sendOnPositionChangedEvent() {
-  if (onPositionChangedCallbackId_ != 0 &&
+  auto onPositionChangedCallbackId =
+      onPositionChangedCallbackId_.load(std::memory_order_acquire);
+  if (onPositionChangedCallbackId != 0 &&
       onPositionChangedTime_ > onPositionChangedInterval_ &&
       context_->audioEventHandlerRegistry_ != nullptr) {
-    std::unordered_map<std::string, EventValue> body = {
-        {"value", getCurrentPosition()}};
-
-    context_->audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        "positionChanged", onPositionChangedCallbackId_, body);
+    context_->audioEventHandlerRegistry_->enqueueEvent(
+        {.type = AudioEventType::POSITION_CHANGED,
+         .listenerId = onPositionChangedCallbackId,
+         .value = getCurrentPosition()});
 
     onPositionChangedTime_ = 0;
   }
@@ -2,28 +2,30 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/AudioBufferQueueSourceNode.h>
 #include <audioapi/core/utils/Constants.h>
-#include <audioapi/core/utils/Locker.h>
 #include <audioapi/dsp/AudioUtils.h>
 #include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 
+#include <cmath>
+
 namespace audioapi {
 
 AudioBufferQueueSourceNode::AudioBufferQueueSourceNode(
     BaseAudioContext *context,
     bool pitchCorrection)
-    : AudioBufferBaseSourceNode(context, pitchCorrection) {
-  buffers_ = {};
+    : AudioBufferBaseSourceNode(context, pitchCorrection),
+      slots_(AUDIO_BUFFER_QUEUE_CAPACITY) {
+  // same size as playbackRateBus_, the largest bus the buffers are copied to
+  crossfadeBus_ = std::make_shared<AudioBus>(
+      RENDER_QUANTUM_SIZE * 3, channelCount_, context_->getSampleRate());
   stretch_->presetDefault(channelCount_, context_->getSampleRate());
 
   isInitialized_ = true;
 }
 
 AudioBufferQueueSourceNode::~AudioBufferQueueSourceNode() {
-  Locker locker(getBufferLock());
-
-  buffers_ = {};
+  clearOnBufferConsumedCallback();
 }
 
 void AudioBufferQueueSourceNode::stop(double when) {
@@ -36,42 +38,52 @@ void AudioBufferQueueSourceNode::pause() {
   isPaused_ = true;
 }
 
-std::string AudioBufferQueueSourceNode::enqueueBuffer(
+std::optional<std::string> AudioBufferQueueSourceNode::enqueueBuffer(
     const std::shared_ptr<AudioBuffer> &buffer) {
-  auto locker = Locker(getBufferLock());
-  buffers_.emplace(bufferId_, buffer);
+  releaseConsumedSlots();
+
+  auto writeIndex = writeIndex_.load(std::memory_order_relaxed);
+  if (writeIndex - readIndex_.load(std::memory_order_acquire) >=
+      AUDIO_BUFFER_QUEUE_CAPACITY) {
+    return std::nullopt;
+  }
+
+  // the slot was played already, the audio thread does not read it anymore
+  auto &slot = slots_[writeIndex % AUDIO_BUFFER_QUEUE_CAPACITY];
+  slot.bufferId = bufferId_;
+  slot.buffer = buffer;
+  slot.isRemoved.store(false, std::memory_order_relaxed);
+
+  // publishes the slot, the audio thread acquires the index before reading it
+  writeIndex_.store(writeIndex + 1, std::memory_order_release);
 
   return std::to_string(bufferId_++);
 }
 
 void AudioBufferQueueSourceNode::dequeueBuffer(const size_t bufferId) {
-  auto locker = Locker(getBufferLock());
-  if (buffers_.empty()) {
-    return;
-  }
-
-  if (buffers_.front().first == bufferId) {
-    buffers_.pop();
-    vReadIndex_ = 0.0;
-    return;
-  }
-
-  // If the buffer is not at the front, we need to remove it from the queue.
-  // And keep vReadIndex_ at the same position.
-  std::queue<std::pair<size_t, std::shared_ptr<AudioBuffer>>> newQueue;
-  while (!buffers_.empty()) {
-    if (buffers_.front().first != bufferId) {
-      newQueue.push(buffers_.front());
+  releaseConsumedSlots();
+
+  auto writeIndex = writeIndex_.load(std::memory_order_relaxed);
+  auto index = std::max(
+      readIndex_.load(std::memory_order_acquire),
+      clearIndex_.load(std::memory_order_relaxed));
+
+  // The buffer stays in its slot until the audio thread skips it. When it is
+  // the one being played, the next buffer starts from its beginning.
+  for (; index < writeIndex; ++index) {
+    auto &slot = slots_[index % AUDIO_BUFFER_QUEUE_CAPACITY];
+    if (slot.bufferId == bufferId) {
+      slot.isRemoved.store(true, std::memory_order_release);
+      return;
     }
-    buffers_.pop();
   }
-  std::swap(buffers_, newQueue);
 }
 
 void AudioBufferQueueSourceNode::clearBuffers() {
-  auto locker = Locker(getBufferLock());
-  buffers_ = {};
-  vReadIndex_ = 0.0;
+  releaseConsumedSlots();
+
+  clearIndex_.store(
+      writeIndex_.load(std::memory_order_relaxed), std::memory_order_release);
 }
 
 void AudioBufferQueueSourceNode::disable() {
@@ -84,30 +96,57 @@ void AudioBufferQueueSourceNode::disable() {
   }
 
   AudioScheduledSourceNode::disable();
-  buffers_ = {};
+  readIndex_.store(
+      writeIndex_.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+double AudioBufferQueueSourceNode::getCrossfadeDuration() const {
+  return crossfadeDuration_.load(std::memory_order_relaxed);
+}
+
+void AudioBufferQueueSourceNode::setCrossfadeDuration(
+    double crossfadeDuration) {
+  crossfadeDuration_.store(
+      std::max(crossfadeDuration, 0.0), std::memory_order_relaxed);
+}
+
+void AudioBufferQueueSourceNode::clearOnBufferConsumedCallback() {
+  if (onBufferConsumedCallbackId_ == 0 || context_ == nullptr ||
+      context_->audioEventHandlerRegistry_ == nullptr) {
+    return;
+  }
+
+  context_->audioEventHandlerRegistry_->unregisterHandler(
+      "bufferConsumed", onBufferConsumedCallbackId_);
+  onBufferConsumedCallbackId_ = 0;
+}
+
+void AudioBufferQueueSourceNode::setOnBufferConsumedCallbackId(
+    uint64_t callbackId) {
+  onBufferConsumedCallbackId_ = callbackId;
 }
 
 std::shared_ptr<AudioBus> AudioBufferQueueSourceNode::processNode(
     const std::shared_ptr<AudioBus> &processingBus,
     int framesToProcess) {
-  if (auto locker = Locker::tryLock(getBufferLock())) {
-    // no audio data to fill, zero the output and return.
-    if (buffers_.empty()) {
-      processingBus->zero();
-      return processingBus;
-    }
+  maxCrossfadeFrames_ = static_cast<size_t>(
+      crossfadeDuration_.load(std::memory_order_relaxed) *
+      context_->getSampleRate());
 
-    if (!pitchCorrection_) {
-      processWithoutPitchCorrection(processingBus, framesToProcess);
-    } else {
-      processWithPitchCorrection(processingBus, framesToProcess);
-    }
+  // no audio data to fill, zero the output and return.
+  if (getCurrentSlot() == nullptr) {
+    processingBus->zero();
+    return processingBus;
+  }
 
-    handleStopScheduled();
+  if (!pitchCorrection_) {
+    processWithoutPitchCorrection(processingBus, framesToProcess);
   } else {
-    processingBus->zero();
+    processWithPitchCorrection(processingBus, framesToProcess);
   }
 
+  handleStopScheduled();
+
   return processingBus;
 }
 
@@ -121,62 +160,234 @@ double AudioBufferQueueSourceNode::getCurrentPosition() const {
  * Helper functions
  */
 
+void AudioBufferQueueSourceNode::releaseConsumedSlots() {
+  auto readIndex = readIndex_.load(std::memory_order_acquire);
+
+  for (; releasedIndex_ < readIndex; ++releasedIndex_) {
+    slots_[releasedIndex_ % AUDIO_BUFFER_QUEUE_CAPACITY].buffer.reset();
+  }
+}
+
+AudioBufferQueueSourceNode::Slot *AudioBufferQueueSourceNode::getCurrentSlot() {
+  // the clear index is loaded first, so it never exceeds the write index
+  auto clearIndex = clearIndex_.load(std::memory_order_acquire);
+  auto writeIndex = writeIndex_.load(std::memory_order_acquire);
+  auto readIndex =
+      std::max(readIndex_.load(std::memory_order_relaxed), clearIndex);
+
+  while (readIndex < writeIndex &&
+         slots_[readIndex % AUDIO_BUFFER_QUEUE_CAPACITY].isRemoved.load(
+             std::memory_order_acquire)) {
+    readIndex += 1;
+  }
+
+  if (readIndex != readIndex_.load(std::memory_order_relaxed)) {
+    readIndex_.store(readIndex, std::memory_order_release);
+  }
+
+  // the buffer being played was removed, the next one starts from the beginning
+  if (readIndex != playingIndex_) {
+    playingIndex_ = readIndex;
+    vReadIndex_ = 0.0;
+    isCrossfadeDecided_ = false;
+    crossfadeFrames_ = 0;
+    crossfadeSlotIndex_ = NO_SLOT;
+  }
+
+  if (readIndex == writeIndex) {
+    return nullptr;
+  }
+
+  return &slots_[readIndex % AUDIO_BUFFER_QUEUE_CAPACITY];
+}
+
+size_t AudioBufferQueueSourceNode::findNextSlotIndex(size_t index) const {
+  auto clearIndex = clearIndex_.load(std::memory_order_acquire);
+  auto writeIndex = writeIndex_.load(std::memory_order_acquire);
+
+  for (index = std::max(index + 1, clearIndex); index < writeIndex; ++index) {
+    if (!slots_[index % AUDIO_BUFFER_QUEUE_CAPACITY].isRemoved.load(
+            std::memory_order_acquire)) {
+      return index;
+    }
+  }
+
+  return NO_SLOT;
+}
+
+size_t AudioBufferQueueSourceNode::getCrossfadeStart(size_t length) const {
+  if (!isCrossfadeDecided_) {
+    return length - std::min(maxCrossfadeFrames_, length);
+  }
+
+  return length - crossfadeFrames_;
+}
+
+AudioBufferQueueSourceNode::Slot *AudioBufferQueueSourceNode::updateCrossfade(
+    size_t length,
+    size_t position) {
+  if (!isCrossfadeDecided_) {
+    if (maxCrossfadeFrames_ == 0 || position < getCrossfadeStart(length)) {
+      return nullptr;
+    }
+
+    // Only a buffer queued before the overlap starts is mixed in, from its
+    // first frame. When the overlap is reached late, e.g. the playing buffer
+    // was itself crossfaded into, it gets shorter.
+    isCrossfadeDecided_ = true;
+    crossfadeSlotIndex_ = findNextSlotIndex(playingIndex_);
+    if (crossfadeSlotIndex_ != NO_SLOT) {
+      const auto &nextSlot =
+          slots_[crossfadeSlotIndex_ % AUDIO_BUFFER_QUEUE_CAPACITY];
+      crossfadeFrames_ = std::min(
+          {maxCrossfadeFrames_,
+           length - position,
+           nextSlot.buffer->getLength()});
+    }
+  }
+
+  if (crossfadeFrames_ == 0 || position < getCrossfadeStart(length)) {
+    return nullptr;
+  }
+
+  auto &nextSlot = slots_[crossfadeSlotIndex_ % AUDIO_BUFFER_QUEUE_CAPACITY];
+  if (nextSlot.isRemoved.load(std::memory_order_acquire) ||
+      clearIndex_.load(std::memory_order_acquire) > crossfadeSlotIndex_) {
+    // the next buffer was removed in the middle of the crossfade
+    crossfadeFrames_ = 0;
+    return nullptr;
+  }
+
+  return &nextSlot;
+}
+
+void AudioBufferQueueSourceNode::finishCurrentSlot(const Slot &slot) {
+  // read before the slot is handed back to the JS thread
+  auto bufferId = static_cast<int64_t>(slot.bufferId);
+  auto length = slot.buffer->getLength();
+  auto nextIndex = findNextSlotIndex(playingIndex_);
+  bool isLast = nextIndex == NO_SLOT;
+
+  playedBuffersDuration_ += slot.buffer->getDuration();
+
+  if (crossfadeFrames_ > 0) {
+    // the next buffer has been playing since the crossfade started
+    nextIndex = crossfadeSlotIndex_;
+    playedBuffersDuration_ -= static_cast<double>(crossfadeFrames_) /
+        static_cast<double>(context_->getSampleRate());
+  } else if (isLast) {
+    nextIndex = playingIndex_ + 1;
+  }
+
+  vReadIndex_ -= static_cast<double>(length - crossfadeFrames_);
+  playingIndex_ = nextIndex;
+  isCrossfadeDecided_ = false;
+  crossfadeFrames_ = 0;
+  crossfadeSlotIndex_ = NO_SLOT;
+
+  auto onBufferConsumedCallbackId =
+      onBufferConsumedCallbackId_.load(std::memory_order_acquire);
+  int queuedBuffers = 0;
+  double queuedDuration = 0.0;
+  if (onBufferConsumedCallbackId != 0) {
+    for (auto index = isLast ? NO_SLOT : nextIndex; index != NO_SLOT;
+         index = findNextSlotIndex(index)) {
+      queuedBuffers += 1;
+      queuedDuration += slots_[index % AUDIO_BUFFER_QUEUE_CAPACITY]
+                            .buffer->getDuration();
+    }
+  }
+
+  // hands the slot back, the JS thread releases the buffer
+  readIndex_.store(nextIndex, std::memory_order_release);
+
+  auto onEndedCallbackId = onEndedCallbackId_.load(std::memory_order_acquire);
+  if (onEndedCallbackId != 0) {
+    context_->audioEventHandlerRegistry_->enqueueEvent(
+        {.type = AudioEventType::ENDED,
+         .listenerId = onEndedCallbackId,
+         .bufferId = bufferId,
+         .isLast = isLast});
+  }
+
+  if (onBufferConsumedCallbackId != 0) {
+    context_->audioEventHandlerRegistry_->enqueueEvent(
+        {.type = AudioEventType::BUFFER_CONSUMED,
+         .listenerId = onBufferConsumedCallbackId,
+         .value = queuedDuration,
+         .count = queuedBuffers,
+         .bufferId = bufferId});
+  }
+}
+
 void AudioBufferQueueSourceNode::processWithoutInterpolation(
     const std::shared_ptr<AudioBus> &processingBus,
     size_t startOffset,
     size_t offsetLength,
     float playbackRate) {
-  auto readIndex = static_cast<size_t>(vReadIndex_);
   size_t writeIndex = startOffset;
-
-  auto data = buffers_.front();
-  auto bufferId = data.first;
-  auto buffer = data.second;
-
   size_t framesLeft = offsetLength;
 
   while (framesLeft > 0) {
-    size_t framesToEnd = buffer->getLength() - readIndex;
-    size_t framesToCopy = std::min(framesToEnd, framesLeft);
-    framesToCopy = framesToCopy > 0 ? framesToCopy : 0;
+    auto *slot = getCurrentSlot();
+    if (slot == nullptr) {
+      processingBus->zero(writeIndex, framesLeft);
+      break;
+    }
+
+    auto *buffer = slot->buffer.get();
+    auto length = buffer->getLength();
+    auto readIndex = static_cast<size_t>(vReadIndex_);
+    auto *nextSlot = updateCrossfade(length, readIndex);
+
+    // copies up to the end of the buffer, or to the start of the crossfade
+    size_t framesToCopy = std::min(framesLeft, length - readIndex);
+    auto crossfadeStart = getCrossfadeStart(length);
+    if (nextSlot == nullptr && readIndex < crossfadeStart) {
+      framesToCopy = std::min(framesToCopy, crossfadeStart - readIndex);
+    }
 
-    assert(readIndex >= 0);
-    assert(writeIndex >= 0);
     assert(readIndex + framesToCopy <= buffer->getLength());
     assert(writeIndex + framesToCopy <= processingBus->getSize());
 
     processingBus->copy(
         buffer->bus_.get(), readIndex, writeIndex, framesToCopy);
 
+    if (nextSlot != nullptr) {
+      // equal-power gains, the next buffer starts where the overlap does
+      auto nextReadIndex = readIndex - crossfadeStart;
+      crossfadeBus_->copy(
+          nextSlot->buffer->bus_.get(),
+          nextReadIndex,
+          writeIndex,
+          framesToCopy);
+
+      auto numberOfChannels = std::min(
+          processingBus->getNumberOfChannels(),
+          crossfadeBus_->getNumberOfChannels());
+      for (int ch = 0; ch < numberOfChannels; ++ch) {
+        float *destination = processingBus->getChannel(ch)->getData();
+        const float *next = crossfadeBus_->getChannel(ch)->getData();
+
+        for (size_t i = 0; i < framesToCopy; ++i) {
+          auto angle = 0.5f * PI *
+              static_cast<float>(nextReadIndex + i) /
+              static_cast<float>(crossfadeFrames_);
+          destination[writeIndex + i] =
+              destination[writeIndex + i] * std::cos(angle) +
+              next[writeIndex + i] * std::sin(angle);
+        }
+      }
+    }
+
     writeIndex += framesToCopy;
-    readIndex += framesToCopy;
     framesLeft -= framesToCopy;
+    vReadIndex_ = static_cast<double>(readIndex + framesToCopy);
 
-    if (readIndex >= buffer->getLength()) {
-      playedBuffersDuration_ += buffer->getDuration();
-      buffers_.pop();
-
-      std::unordered_map<std::string, EventValue> body = {
-          {"bufferId", std::to_string(bufferId)}, {"isLast", buffers_.empty()}};
-      context_->audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-          "ended", onEndedCallbackId_, body);
-
-      if (buffers_.empty()) {
-        processingBus->zero(writeIndex, framesLeft);
-        readIndex = 0;
-
-        break;
-      }
-
-      data = buffers_.front();
-      bufferId = data.first;
-      buffer = data.second;
-      readIndex = 0;
+    if (readIndex + framesToCopy >= length) {
+      finishCurrentSlot(*slot);
     }
   }
-
-  // update reading index for next render quantum
-  vReadIndex_ = static_cast<double>(readIndex);
 }
 
 void AudioBufferQueueSourceNode::processWithInterpolation(
@@ -187,26 +398,36 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
   size_t writeIndex = startOffset;
   size_t framesLeft = offsetLength;
 
-  auto data = buffers_.front();
-  auto bufferId = data.first;
-  auto buffer = data.second;
-
   while (framesLeft > 0) {
+    auto *slot = getCurrentSlot();
+    if (slot == nullptr) {
+      processingBus->zero(writeIndex, framesLeft);
+      break;
+    }
+
+    auto *buffer = slot->buffer.get();
+    auto length = buffer->getLength();
+
+    // a short buffer can be played through entirely while fading in
+    if (vReadIndex_ >= static_cast<double>(length)) {
+      finishCurrentSlot(*slot);
+      continue;
+    }
+
     auto readIndex = static_cast<size_t>(vReadIndex_);
     size_t nextReadIndex = readIndex + 1;
     auto factor =
         static_cast<float>(vReadIndex_ - static_cast<double>(readIndex));
-
-    bool crossBufferInterpolation = false;
-    std::shared_ptr<AudioBuffer> nextBuffer = nullptr;
-
-    if (nextReadIndex >= buffer->getLength()) {
-      if (buffers_.size() > 1) {
-        auto tempQueue = buffers_;
-        tempQueue.pop();
-        nextBuffer = tempQueue.front().second;
+    auto *crossfadeSlot = updateCrossfade(length, readIndex);
+
+    // the last frame interpolates towards the next buffer, unless it fades out
+    const AudioBuffer *nextBuffer = buffer;
+    if (nextReadIndex >= length) {
+      auto nextSlotIndex = findNextSlotIndex(playingIndex_);
+      if (crossfadeSlot == nullptr && nextSlotIndex != NO_SLOT) {
+        nextBuffer =
+            slots_[nextSlotIndex % AUDIO_BUFFER_QUEUE_CAPACITY].buffer.get();
         nextReadIndex = 0;
-        crossBufferInterpolation = true;
       } else {
         nextReadIndex = readIndex;
       }
@@ -215,16 +436,41 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
     for (int i = 0; i < processingBus->getNumberOfChannels(); i += 1) {
       float *destination = processingBus->getChannel(i)->getData();
       const float *currentSource = buffer->bus_->getChannel(i)->getData();
+      const float *nextSource = nextBuffer->bus_->getChannel(i)->getData();
 
-      if (crossBufferInterpolation) {
-        const float *nextSource = nextBuffer->bus_->getChannel(i)->getData();
-        float currentSample = currentSource[readIndex];
-        float nextSample = nextSource[nextReadIndex];
-        destination[writeIndex] =
-            currentSample + factor * (nextSample - currentSample);
-      } else {
-        destination[writeIndex] = dsp::linearInterpolate(
-            currentSource, readIndex, nextReadIndex, factor);
+      float currentSample = currentSource[readIndex];
+      float nextSample = nextSource[nextReadIndex];
+      destination[writeIndex] =
+          currentSample + factor * (nextSample - currentSample);
+    }
+
+    if (crossfadeSlot != nullptr) {
+      const auto *crossfadeBuffer = crossfadeSlot->buffer.get();
+      auto crossfadePosition =
+          vReadIndex_ - static_cast<double>(getCrossfadeStart(length));
+      auto crossfadeIndex = static_cast<size_t>(crossfadePosition);
+      auto crossfadeFactor = static_cast<float>(
+          crossfadePosition - static_cast<double>(crossfadeIndex));
+      auto crossfadeNextIndex =
+          std::min(crossfadeIndex + 1, crossfadeBuffer->getLength() - 1);
+
+      auto angle = 0.5f * PI * static_cast<float>(crossfadePosition) /
+          static_cast<float>(crossfadeFrames_);
+      auto gain = std::cos(angle);
+      auto crossfadeGain = std::sin(angle);
+
+      for (int i = 0; i < processingBus->getNumberOfChannels(); i += 1) {
+        float *destination = processingBus->getChannel(i)->getData();
+        const float *crossfadeSource =
+            crossfadeBuffer->bus_->getChannel(i)->getData();
+
+        destination[writeIndex] = gain * destination[writeIndex] +
+            crossfadeGain *
+                dsp::linearInterpolate(
+                    crossfadeSource,
+                    crossfadeIndex,
+                    crossfadeNextIndex,
+                    crossfadeFactor);
       }
     }
 
@@ -233,25 +479,8 @@ void AudioBufferQueueSourceNode::processWithInterpolation(
     vReadIndex_ += std::abs(playbackRate);
     framesLeft -= 1;
 
-    if (vReadIndex_ >= static_cast<double>(buffer->getLength())) {
-      playedBuffersDuration_ += buffer->getDuration();
-      buffers_.pop();
-
-      std::unordered_map<std::string, EventValue> body = {
-          {"bufferId", std::to_string(bufferId)}};
-      context_->audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-          "ended", onEndedCallbackId_, body);
-
-      if (buffers_.empty()) {
-        processingBus->zero(writeIndex, framesLeft);
-        vReadIndex_ = 0.0;
-        break;
-      }
-
-      vReadIndex_ = vReadIndex_ - buffer->getLength();
-      data = buffers_.front();
-      bufferId = data.first;
-      buffer = data.second;
+    if (vReadIndex_ >= static_cast<double>(length)) {
+      finishCurrentSlot(*slot);
     }
   }
 }
@@ -7,14 +7,22 @@
 #include <memory>
 #include <cstddef>
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <optional>
 #include <string>
-#include <queue>
+#include <vector>
 
 namespace audioapi {
 
 class AudioBus;
 class AudioParam;
 
+/// @brief Plays the enqueued buffers one after another, without a gap between them.
+/// @note The queue is a preallocated ring of slots, the JS thread fills it and the audio thread plays it,
+/// neither of them ever locks. Buffers are released only on the JS thread.
+/// @note With a crossfade duration set, the end of each buffer is mixed with the beginning of the next one
+/// using equal-power gains, provided the next buffer is already queued when the crossfade starts.
 class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
  public:
     explicit AudioBufferQueueSourceNode(BaseAudioContext *context, bool pitchCorrection);
@@ -23,24 +31,76 @@ class AudioBufferQueueSourceNode : public AudioBufferBaseSourceNode {
     void stop(double when) override;
     void pause();
 
-    std::string enqueueBuffer(const std::shared_ptr<AudioBuffer> &buffer);
+    /// @return Id of the buffer, std::nullopt when the queue is full.
+    std::optional<std::string> enqueueBuffer(const std::shared_ptr<AudioBuffer> &buffer);
     void dequeueBuffer(size_t bufferId);
     void clearBuffers();
     void disable() override;
 
+    [[nodiscard]] double getCrossfadeDuration() const;
+    void setCrossfadeDuration(double crossfadeDuration);
+
+    void clearOnBufferConsumedCallback();
+    void setOnBufferConsumedCallbackId(uint64_t callbackId);
+
  protected:
     std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus>& processingBus, int framesToProcess) override;
     double getCurrentPosition() const override;
 
  private:
-    // User provided buffers
-    std::queue<std::pair<size_t, std::shared_ptr<AudioBuffer>>> buffers_;
+    static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+    struct Slot {
+      size_t bufferId = 0;
+      std::shared_ptr<AudioBuffer> buffer;
+      // set by dequeueBuffer, the audio thread skips the slot
+      std::atomic<bool> isRemoved{false};
+    };
+
+    // User provided buffers, slot i holds the buffer enqueued as i-th modulo the capacity.
+    std::vector<Slot> slots_;
+    // number of enqueued buffers, stored only by the JS thread
+    std::atomic<size_t> writeIndex_{0};
+    // write index at the last clearBuffers(), slots before it are skipped
+    std::atomic<size_t> clearIndex_{0};
+    // index of the slot being played, stored only by the audio thread
+    std::atomic<size_t> readIndex_{0};
+    // slots before it have their buffers released, JS thread only
+    size_t releasedIndex_ = 0;
     size_t bufferId_ = 0;
 
+    // slot vReadIndex_ refers to, audio thread only
+    size_t playingIndex_ = 0;
+
+    std::atomic<double> crossfadeDuration_{0.0};
+    // crossfade duration in frames, read once per render quantum
+    size_t maxCrossfadeFrames_ = 0;
+    // the crossfade of the playing buffer is decided once it reaches the possible overlap
+    bool isCrossfadeDecided_ = false;
+    // frames of the playing buffer overlapping with the next one, 0 when not crossfading
+    size_t crossfadeFrames_ = 0;
+    size_t crossfadeSlotIndex_ = NO_SLOT;
+    std::shared_ptr<AudioBus> crossfadeBus_;
+
     bool isPaused_ = false;
 
     double playedBuffersDuration_ = 0;
 
+    std::atomic<uint64_t> onBufferConsumedCallbackId_ = 0; // 0 means no callback
+
+    // drops the references to the buffers already played, JS thread only
+    void releaseConsumedSlots();
+
+    // skips the removed slots, returns the one being played or nullptr when the queue is empty
+    Slot *getCurrentSlot();
+    [[nodiscard]] size_t findNextSlotIndex(size_t index) const;
+    // first frame of the playing buffer that may overlap with the next one
+    [[nodiscard]] size_t getCrossfadeStart(size_t length) const;
+    // returns the slot mixed into the playing buffer at position, nullptr outside of a crossfade
+    Slot *updateCrossfade(size_t length, size_t position);
+    // moves to the next buffer and keeps vReadIndex_ at the same point of the timeline
+    void finishCurrentSlot(const Slot &slot);
+
     void processWithoutInterpolation(
             const std::shared_ptr<AudioBus>& processingBus,
             size_t startOffset,
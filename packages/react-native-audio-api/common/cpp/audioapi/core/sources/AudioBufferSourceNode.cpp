@@ -173,8 +173,9 @@ void AudioBufferSourceNode::sendOnLoopEndedEvent() {
   auto onLoopEndedCallbackId =
       onLoopEndedCallbackId_.load(std::memory_order_acquire);
   if (onLoopEndedCallbackId != 0) {
-    context_->audioEventHandlerRegistry_->invokeHandlerWithEventBody(
-        "loopEnded", onLoopEndedCallbackId_, {});
+    context_->audioEventHandlerRegistry_->enqueueEvent(
+        {.type = AudioEventType::LOOP_ENDED,
+         .listenerId = onLoopEndedCallbackId});
   }
 }
 
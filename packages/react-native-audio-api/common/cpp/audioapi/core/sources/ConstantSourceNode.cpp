@@ -1,6 +1,7 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/ConstantSourceNode.h>
 #include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 
@@ -29,19 +30,33 @@ std::shared_ptr<AudioBus> ConstantSourceNode::processNode(
     return processingBus;
   }
 
-  auto offsetBus = offsetParam_->processARateParam(
-      framesToProcess, context_->getCurrentTime());
+  auto time = context_->getCurrentTime();
 
-  auto offsetChannelData = offsetBus->getChannel(0)->getData();
+  if (offsetParam_->isConstant(framesToProcess, time)) {
+    auto offset = offsetParam_->processKRateParam(framesToProcess, time);
 
-  for (int channel = 0; channel < processingBus->getNumberOfChannels();
-       ++channel) {
-    auto outputChannelData = processingBus->getChannel(channel)->getData();
+    for (int channel = 0; channel < processingBus->getNumberOfChannels();
+         ++channel) {
+      dsp::fill(
+          offset,
+          processingBus->getChannel(channel)->getData() + startOffset,
+          offsetLength);
+    }
+  } else {
+    const auto &offsetBus =
+        offsetParam_->processARateParam(framesToProcess, time);
 
-    std::copy(
-        offsetChannelData + startOffset,
-        offsetChannelData + startOffset + offsetLength,
-        outputChannelData + startOffset);
+    auto offsetChannelData = offsetBus->getChannel(0)->getData();
+
+    for (int channel = 0; channel < processingBus->getNumberOfChannels();
+         ++channel) {
+      auto outputChannelData = processingBus->getChannel(channel)->getData();
+
+      std::copy(
+          offsetChannelData + startOffset,
+          offsetChannelData + startOffset + offsetLength,
+          outputChannelData + startOffset);
+    }
   }
 
   if (isStopScheduled()) {
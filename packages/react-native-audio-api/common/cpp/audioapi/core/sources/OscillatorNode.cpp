@@ -1,6 +1,7 @@
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/OscillatorNode.h>
 #include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 
@@ -23,6 +24,7 @@ OscillatorNode::OscillatorNode(BaseAudioContext *context)
 
   audioBus_ = std::make_shared<AudioBus>(
       RENDER_QUANTUM_SIZE, 1, context_->getSampleRate());
+  detunedFrequencies_ = std::make_shared<AudioArray>(RENDER_QUANTUM_SIZE);
 
   isInitialized_ = true;
 }
@@ -65,30 +67,51 @@ std::shared_ptr<AudioBus> OscillatorNode::processNode(
 
   auto time = context_->getCurrentTime() +
       static_cast<double>(startOffset) * 1.0 / context_->getSampleRate();
-  auto detuneParamValues =
-      detuneParam_->processARateParam(framesToProcess, time);
-  auto frequencyParamValues =
-      frequencyParam_->processARateParam(framesToProcess, time);
 
-  for (size_t i = startOffset; i < offsetLength; i += 1) {
+  auto *outputData = processingBus->getChannel(0)->getData() + startOffset;
+  auto frames = offsetLength > startOffset ? offsetLength - startOffset : 0;
+  auto isDetuneConstant = detuneParam_->isConstant(framesToProcess, time);
+
+  if (isDetuneConstant && frequencyParam_->isConstant(framesToProcess, time)) {
+    // the whole quantum has a single frequency, the wave tables and the
+    // interpolation are chosen once for it
     auto detuneRatio = std::pow(
-        2.0f, detuneParamValues->getChannel(0)->getData()[i] / 1200.0f);
+        2.0f, detuneParam_->processKRateParam(framesToProcess, time) / 1200.0f);
     auto detunedFrequency =
-        frequencyParamValues->getChannel(0)->getData()[i] * detuneRatio;
-    auto phaseIncrement = detunedFrequency * periodicWave_->getScale();
-
-    float sample =
-        periodicWave_->getSample(detunedFrequency, phase_, phaseIncrement);
-
-    for (int j = 0; j < processingBus->getNumberOfChannels(); j += 1) {
-      (*processingBus->getChannel(j))[i] = sample;
+        frequencyParam_->processKRateParam(framesToProcess, time) * detuneRatio;
+
+    phase_ =
+        periodicWave_->render(detunedFrequency, phase_, outputData, frames);
+  } else {
+    const auto &frequencyParamValues =
+        frequencyParam_->processARateParam(framesToProcess, time);
+    auto *frequencies =
+        frequencyParamValues->getChannel(0)->getData() + startOffset;
+    auto *detunedFrequencies = detunedFrequencies_->getData();
+
+    if (isDetuneConstant) {
+      auto detuneRatio = std::pow(
+          2.0f,
+          detuneParam_->processKRateParam(framesToProcess, time) / 1200.0f);
+      dsp::multiplyByScalar(
+          frequencies, detuneRatio, detunedFrequencies, frames);
+    } else {
+      const auto &detuneParamValues =
+          detuneParam_->processARateParam(framesToProcess, time);
+      auto *detune = detuneParamValues->getChannel(0)->getData() + startOffset;
+
+      for (size_t i = 0; i < frames; i += 1) {
+        detunedFrequencies[i] = frequencies[i] * exp2f(detune[i] / 1200.0f);
+      }
     }
 
-    phase_ += phaseIncrement;
-    phase_ -=
-        floor(
-            phase_ / static_cast<float>(periodicWave_->getPeriodicWaveSize())) *
-        static_cast<float>(periodicWave_->getPeriodicWaveSize());
+    phase_ =
+        periodicWave_->render(detunedFrequencies, phase_, outputData, frames);
+  }
+
+  for (int j = 1; j < processingBus->getNumberOfChannels(); j += 1) {
+    processingBus->getChannel(j)->copy(
+        processingBus->getChannel(0), startOffset, frames);
   }
 
   handleStopScheduled();
@@ -6,12 +6,14 @@
 #include <audioapi/core/effects/PeriodicWave.h>
 
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <string>
 
 namespace audioapi {
 
 class AudioBus;
+class AudioArray;
 
 class OscillatorNode : public AudioScheduledSourceNode {
  public:
@@ -30,8 +32,11 @@ class OscillatorNode : public AudioScheduledSourceNode {
   std::shared_ptr<AudioParam> frequencyParam_;
   std::shared_ptr<AudioParam> detuneParam_;
   OscillatorType type_;
-  float phase_ = 0.0;
+  // fixed-point, see PeriodicWave::getPhaseIncrement
+  uint32_t phase_ = 0;
   std::shared_ptr<PeriodicWave> periodicWave_;
+  // detuned frequency of every frame, when the params are automated
+  std::shared_ptr<AudioArray> detunedFrequencies_;
 
   static OscillatorType fromString(const std::string &type) {
     std::string lowerType = type;
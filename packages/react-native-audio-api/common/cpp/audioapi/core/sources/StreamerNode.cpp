@@ -10,11 +10,14 @@
 
 #include <audioapi/core/BaseAudioContext.h>
 #include <audioapi/core/sources/StreamerNode.h>
-#include <audioapi/core/utils/Locker.h>
 #include <audioapi/dsp/VectorMath.h>
+#include <audioapi/events/AudioEventHandlerRegistry.h>
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
-#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
 
 namespace audioapi {
 StreamerNode::StreamerNode(BaseAudioContext *context)
@@ -26,16 +29,36 @@ StreamerNode::StreamerNode(BaseAudioContext *context)
       pkt_(nullptr),
       frame_(nullptr),
       pendingFrame_(nullptr),
-      bufferedBus_(nullptr),
-      bufferedBusIndex_(0),
-      maxBufferSize_(0),
+      bufferedAudio_(nullptr),
       audio_stream_index_(-1),
       swrCtx_(nullptr),
       resampledData_(nullptr),
-      maxResampledSamples_(0) {}
+      maxResampledSamples_(0),
+      convertedSamples_(0),
+      streamFlag(false),
+      streamEpoch_(0),
+      isStreamingThreadWaiting_(false),
+      isStreamFinished_(false),
+      seekTarget_(NO_SEEK),
+      seekGeneration_(0),
+      seenSeekGeneration_(0),
+      seekTimestamp_(AV_NOPTS_VALUE),
+      framesToSkip_(0),
+      convertedOffset_(0),
+      lowWatermark_(DEFAULT_LOW_WATERMARK_SECONDS),
+      highWatermark_(DEFAULT_HIGH_WATERMARK_SECONDS),
+      prebufferFrames_(0),
+      isPrebuffering_(true),
+      underrunCount_(0),
+      onBufferUnderrunCallbackId_(0),
+      onBufferLevelChangedCallbackId_(0),
+      onBufferLevelChangedInterval_(
+          static_cast<int>(context->getSampleRate() * 0.1)),
+      onBufferLevelChangedTime_(0) {}
 
 StreamerNode::~StreamerNode() {
   cleanup();
+  clearOnBufferEventCallbacks();
 }
 
 bool StreamerNode::initialize(const std::string &input_url) {
@@ -60,17 +83,25 @@ bool StreamerNode::initialize(const std::string &input_url) {
     return false;
   }
 
-  maxBufferSize_ = BUFFER_LENGTH_SECONDS * codecCtx_->sample_rate;
   // If decoding is faster than playing, we buffer few seconds of audio
-  bufferedBus_ = std::make_shared<AudioBus>(
-      maxBufferSize_, codecpar_->ch_layout.nb_channels, codecCtx_->sample_rate);
+  bufferedAudio_ = std::make_unique<SpscAudioRing>(
+      codecpar_->ch_layout.nb_channels,
+      static_cast<size_t>(BUFFER_LENGTH_SECONDS * context_->getSampleRate()));
 
   channelCount_ = codecpar_->ch_layout.nb_channels;
   audioBus_ = std::make_shared<AudioBus>(
       RENDER_QUANTUM_SIZE, channelCount_, context_->getSampleRate());
 
-  streamingThread_ = std::thread(&StreamerNode::streamAudio, this);
+  prebufferFrames_ = getWatermarkFrames(
+      std::min(lowWatermark_.load(), highWatermark_.load()));
+  isPrebuffering_ = true;
+  isStreamFinished_.store(false);
+  seekTarget_.store(NO_SEEK);
+  seenSeekGeneration_ = seekGeneration_.load();
+
+  // the flag is raised first, the thread would exit right away otherwise
   streamFlag.store(true);
+  streamingThread_ = std::thread(&StreamerNode::streamAudio, this);
   isInitialized_ = true;
   return true;
 }
@@ -78,6 +109,47 @@ bool StreamerNode::initialize(const std::string &input_url) {
 void StreamerNode::stop(double when) {
   AudioScheduledSourceNode::stop(when);
   streamFlag.store(false);
+  wakeUpStreamingThread();
+}
+
+void StreamerNode::seek(double position) {
+  seekTarget_.store(std::max(position, 0.0));
+  wakeUpStreamingThread();
+}
+
+float StreamerNode::getHighWatermark() const {
+  return highWatermark_.load();
+}
+
+void StreamerNode::setHighWatermark(float seconds) {
+  highWatermark_.store(std::clamp(seconds, 0.0f, BUFFER_LENGTH_SECONDS));
+  wakeUpStreamingThread();
+}
+
+float StreamerNode::getLowWatermark() const {
+  return lowWatermark_.load();
+}
+
+void StreamerNode::setLowWatermark(float seconds) {
+  lowWatermark_.store(std::clamp(seconds, 0.0f, BUFFER_LENGTH_SECONDS));
+  wakeUpStreamingThread();
+}
+
+void StreamerNode::setOnBufferUnderrunCallbackId(uint64_t callbackId) {
+  onBufferUnderrunCallbackId_ = callbackId;
+}
+
+void StreamerNode::setOnBufferLevelChangedCallbackId(uint64_t callbackId) {
+  onBufferLevelChangedCallbackId_ = callbackId;
+}
+
+void StreamerNode::setOnBufferLevelChangedInterval(int interval) {
+  onBufferLevelChangedInterval_ = static_cast<int>(
+      context_->getSampleRate() * static_cast<float>(interval) / 1000);
+}
+
+int StreamerNode::getOnBufferLevelChangedInterval() const {
+  return onBufferLevelChangedInterval_;
 }
 
 bool StreamerNode::setupResampler() {
@@ -92,9 +164,9 @@ bool StreamerNode::setupResampler() {
   av_opt_set_int(swrCtx_, "in_sample_rate", codecCtx_->sample_rate, 0);
   av_opt_set_sample_fmt(swrCtx_, "in_sample_fmt", codecCtx_->sample_fmt, 0);
 
-  // Set output parameters (float)
+  // Set output parameters (planar float at the codec rate)
   av_opt_set_chlayout(swrCtx_, "out_chlayout", &codecCtx_->ch_layout, 0);
-  av_opt_set_int(swrCtx_, "out_sample_rate", context_->getSampleRate(), 0);
+  av_opt_set_int(swrCtx_, "out_sample_rate", codecCtx_->sample_rate, 0);
   av_opt_set_sample_fmt(swrCtx_, "out_sample_fmt", AV_SAMPLE_FMT_FLTP, 0);
 
   // Initialize the resampler
@@ -102,6 +174,20 @@ bool StreamerNode::setupResampler() {
     return false;
   }
 
+  auto numChannels = codecCtx_->ch_layout.nb_channels;
+  auto sampleRate = context_->getSampleRate();
+  if (codecCtx_->sample_rate != static_cast<int>(sampleRate)) {
+    resampler_ = std::make_unique<dsp::Resampler>(
+        numChannels,
+        static_cast<float>(codecCtx_->sample_rate),
+        sampleRate,
+        dsp::Resampler::Quality::MEDIUM);
+    resamplerBus_ = std::make_shared<AudioBus>(
+        resampler_->getMaxOutputFrames(INITIAL_MAX_RESAMPLED_SAMPLES),
+        numChannels,
+        sampleRate);
+  }
+
   // Allocate output buffer for resampled data
   maxResampledSamples_ = INITIAL_MAX_RESAMPLED_SAMPLES;
   int ret = av_samples_alloc_array_and_samples(
@@ -117,33 +203,199 @@ bool StreamerNode::setupResampler() {
 
 void StreamerNode::streamAudio() {
   while (streamFlag.load()) {
-    if (pendingFrame_ != nullptr) {
-      if (!processFrameWithResampler(pendingFrame_)) {
-        cleanup();
-        return;
-      }
-    } else {
-      if (av_read_frame(fmtCtx_, pkt_) < 0) {
-        cleanup();
-        return;
+    // Read before the fill level, so a wake-up that comes in between is not
+    // missed by the wait.
+    auto seenEpoch = streamEpoch_.load(std::memory_order_acquire);
+
+    auto seekTarget = seekTarget_.exchange(NO_SEEK);
+    if (seekTarget != NO_SEEK) {
+      seekTo(seekTarget);
+      continue;
+    }
+
+    // Frames of a stream that ended keep playing, the audio thread stops
+    // reporting underruns once they are gone. Only a seek or stop wakes the
+    // thread up then.
+    if (isStreamFinished_.load()) {
+      streamEpoch_.wait(seenEpoch, std::memory_order_acquire);
+      continue;
+    }
+
+    if (pendingFrame_ != nullptr ||
+        bufferedAudio_->getNumberOfAvailableFrames() >=
+            getWatermarkFrames(highWatermark_.load())) {
+      if (pendingFrame_ != nullptr &&
+          !processFrameWithResampler(pendingFrame_)) {
+        break;
       }
-      if (pkt_->stream_index == audio_stream_index_) {
-        if (avcodec_send_packet(codecCtx_, pkt_) != 0) {
-          cleanup();
-          return;
-        }
-        if (avcodec_receive_frame(codecCtx_, frame_) != 0) {
-          cleanup();
-          return;
-        }
-        if (!processFrameWithResampler(frame_)) {
-          cleanup();
-          return;
-        }
-        av_packet_unref(pkt_);
+
+      if (pendingFrame_ != nullptr ||
+          bufferedAudio_->getNumberOfAvailableFrames() >=
+              getWatermarkFrames(highWatermark_.load())) {
+        // the audio thread wakes it up below the low watermark
+        isStreamingThreadWaiting_.store(true, std::memory_order_release);
+        streamEpoch_.wait(seenEpoch, std::memory_order_acquire);
       }
+      continue;
+    }
+
+    int ret = decodeNextFrame();
+    if (ret == AVERROR_EOF) {
+      isStreamFinished_.store(true);
+      continue;
+    }
+
+    if (ret < 0) {
+      break;
+    }
+
+    if (trimFrameToSeekTarget() && !processFrameWithResampler(frame_)) {
+      break;
+    }
+  }
+
+  isStreamFinished_.store(true);
+}
+
+void StreamerNode::seekTo(double position) {
+  auto *stream = fmtCtx_->streams[audio_stream_index_];
+  auto startTime =
+      stream->start_time == AV_NOPTS_VALUE ? 0 : stream->start_time;
+  // rounded, a truncated division lands a frame early on positions that are
+  // not exact in binary
+  auto timestamp = startTime +
+      av_rescale_q(
+          std::llround(position * AV_TIME_BASE),
+          AV_TIME_BASE_Q,
+          stream->time_base);
+
+  // Lands on the closest seek point before the target, for most audio formats
+  // that is a packet or two of frames that are decoded and dropped.
+  if (av_seek_frame(
+          fmtCtx_, audio_stream_index_, timestamp, AVSEEK_FLAG_BACKWARD) < 0) {
+    return;
+  }
+
+  avcodec_flush_buffers(codecCtx_);
+  if (resampler_ != nullptr) {
+    resampler_->reset();
+  }
+
+  pendingFrame_ = nullptr;
+  seekTimestamp_ = timestamp;
+  framesToSkip_ = 0;
+  bufferedAudio_->discard();
+  isStreamFinished_.store(false);
+  seekGeneration_.fetch_add(1, std::memory_order_release);
+}
+
+bool StreamerNode::trimFrameToSeekTarget() {
+  if (seekTimestamp_ == AV_NOPTS_VALUE) {
+    return true;
+  }
+
+  auto frameTimestamp = frame_->best_effort_timestamp;
+  if (frameTimestamp == AV_NOPTS_VALUE) {
+    seekTimestamp_ = AV_NOPTS_VALUE;
+    return true;
+  }
+
+  auto samplesBeforeTarget = av_rescale_q(
+      seekTimestamp_ - frameTimestamp,
+      fmtCtx_->streams[audio_stream_index_]->time_base,
+      AVRational{1, codecCtx_->sample_rate});
+  if (samplesBeforeTarget >= frame_->nb_samples) {
+    return false;
+  }
+
+  framesToSkip_ = static_cast<int>(std::max<int64_t>(samplesBeforeTarget, 0));
+  seekTimestamp_ = AV_NOPTS_VALUE;
+  return true;
+}
+
+int StreamerNode::decodeNextFrame() {
+  while (true) {
+    // a packet may hold several frames, all of them are taken before the next
+    // packet is read
+    int ret = avcodec_receive_frame(codecCtx_, frame_);
+    if (ret != AVERROR(EAGAIN)) {
+      return ret;
+    }
+
+    ret = av_read_frame(fmtCtx_, pkt_);
+    if (ret < 0) {
+      // end of input, the decoder is flushed of the frames it still holds
+      ret = avcodec_send_packet(codecCtx_, nullptr);
+    } else if (pkt_->stream_index == audio_stream_index_) {
+      ret = avcodec_send_packet(codecCtx_, pkt_);
+      av_packet_unref(pkt_);
+    } else {
+      av_packet_unref(pkt_);
+      continue;
+    }
+
+    if (ret < 0) {
+      return ret;
     }
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+void StreamerNode::wakeUpStreamingThread() {
+  streamEpoch_.fetch_add(1, std::memory_order_release);
+  streamEpoch_.notify_one();
+}
+
+size_t StreamerNode::getWatermarkFrames(float seconds) const {
+  // a whole frame of the codec has to fit above the high watermark
+  auto maxFrames =
+      bufferedAudio_->getCapacity() - 2 * INITIAL_MAX_RESAMPLED_SAMPLES;
+  return std::min(
+      static_cast<size_t>(seconds * context_->getSampleRate()), maxFrames);
+}
+
+void StreamerNode::sendOnBufferUnderrunEvent() {
+  auto onBufferUnderrunCallbackId =
+      onBufferUnderrunCallbackId_.load(std::memory_order_acquire);
+  if (onBufferUnderrunCallbackId != 0 &&
+      context_->audioEventHandlerRegistry_ != nullptr) {
+    context_->audioEventHandlerRegistry_->enqueueEvent(
+        {.type = AudioEventType::BUFFER_UNDERRUN,
+         .listenerId = onBufferUnderrunCallbackId,
+         .count = underrunCount_});
+  }
+}
+
+void StreamerNode::sendOnBufferLevelChangedEvent(size_t bufferedFrames) {
+  auto onBufferLevelChangedCallbackId =
+      onBufferLevelChangedCallbackId_.load(std::memory_order_acquire);
+  if (onBufferLevelChangedCallbackId != 0 &&
+      onBufferLevelChangedTime_ > onBufferLevelChangedInterval_ &&
+      context_->audioEventHandlerRegistry_ != nullptr) {
+    context_->audioEventHandlerRegistry_->enqueueEvent(
+        {.type = AudioEventType::BUFFER_LEVEL_CHANGED,
+         .listenerId = onBufferLevelChangedCallbackId,
+         .value =
+             static_cast<double>(bufferedFrames) / context_->getSampleRate()});
+
+    onBufferLevelChangedTime_ = 0;
+  }
+}
+
+void StreamerNode::clearOnBufferEventCallbacks() {
+  if (context_ == nullptr || context_->audioEventHandlerRegistry_ == nullptr) {
+    return;
+  }
+
+  if (onBufferUnderrunCallbackId_ != 0) {
+    context_->audioEventHandlerRegistry_->unregisterHandler(
+        "bufferUnderrun", onBufferUnderrunCallbackId_);
+    onBufferUnderrunCallbackId_ = 0;
+  }
+
+  if (onBufferLevelChangedCallbackId_ != 0) {
+    context_->audioEventHandlerRegistry_->unregisterHandler(
+        "bufferLevelChanged", onBufferLevelChangedCallbackId_);
+    onBufferLevelChangedCallbackId_ = 0;
   }
 }
 
@@ -159,75 +411,140 @@ std::shared_ptr<AudioBus> StreamerNode::processNode(
     return processingBus;
   }
 
-  // If we have enough buffered data, copy to output bus
-  if (bufferedBusIndex_ >= framesToProcess) {
-    Locker locker(mutex_);
-    for (int ch = 0; ch < processingBus->getNumberOfChannels(); ch++) {
-      memcpy(
-          processingBus->getChannel(ch)->getData(),
-          bufferedBus_->getChannel(ch)->getData(),
-          offsetLength * sizeof(float));
+  // after a seek playback waits for the low watermark at the new position,
+  // which does not count as an underrun
+  auto seekGeneration = seekGeneration_.load(std::memory_order_acquire);
+  if (seekGeneration != seenSeekGeneration_) {
+    seenSeekGeneration_ = seekGeneration;
+    isPrebuffering_ = true;
+    prebufferFrames_ = getWatermarkFrames(
+        std::min(lowWatermark_.load(), highWatermark_.load()));
+  }
+
+  auto bufferedFrames = bufferedAudio_->getNumberOfAvailableFrames();
+  auto isStreamFinished = isStreamFinished_.load(std::memory_order_acquire);
+  if (isPrebuffering_ &&
+      (bufferedFrames >= prebufferFrames_ || isStreamFinished)) {
+    isPrebuffering_ = false;
+  }
 
-      memmove(
-          bufferedBus_->getChannel(ch)->getData(),
-          bufferedBus_->getChannel(ch)->getData() + offsetLength,
-          (maxBufferSize_ - offsetLength) * sizeof(float));
-    }
-    bufferedBusIndex_ -= offsetLength;
+  // Wait-free, the streaming thread is never waited for. Whatever is missing
+  // when decoding falls behind plays as silence. While prebuffering nothing is
+  // read, but the ring still skips the frames dropped by a seek.
+  auto framesRead = bufferedAudio_->read(
+      processingBus.get(), startOffset, isPrebuffering_ ? 0 : offsetLength);
+  if (framesRead < offsetLength) {
+    processingBus->zero(startOffset + framesRead, offsetLength - framesRead);
+  }
+
+  // An underrun is followed by rebuffering, every next one asks for a larger
+  // prebuffer so a stream that keeps falling behind stutters less often.
+  if (!isPrebuffering_ && framesRead < offsetLength && !isStreamFinished) {
+    isPrebuffering_ = true;
+    prebufferFrames_ = std::min(
+        std::max(prebufferFrames_ * 2, getWatermarkFrames(lowWatermark_)),
+        getWatermarkFrames(highWatermark_));
+    underrunCount_++;
+    sendOnBufferUnderrunEvent();
+  }
+
+  // Read again, the streaming thread may have written since bufferedFrames was
+  // taken, so bufferedFrames - framesRead could wrap around.
+  auto remainingFrames = bufferedAudio_->getNumberOfAvailableFrames();
+
+  // decoding resumes below the low watermark, which never exceeds the high one
+  auto lowWatermark = std::min(lowWatermark_.load(), highWatermark_.load());
+  if (remainingFrames < getWatermarkFrames(lowWatermark) &&
+      isStreamingThreadWaiting_.exchange(false, std::memory_order_acq_rel)) {
+    wakeUpStreamingThread();
   }
 
+  onBufferLevelChangedTime_ += framesToProcess;
+  sendOnBufferLevelChangedEvent(remainingFrames);
+
   return processingBus;
 }
 
 bool StreamerNode::processFrameWithResampler(AVFrame *frame) {
-  // Check if we need to reallocate the resampled buffer
-  int out_samples = swr_get_out_samples(swrCtx_, frame->nb_samples);
-  if (out_samples > maxResampledSamples_) {
-    av_freep(&resampledData_[0]);
-    av_freep(&resampledData_);
+  // A pending frame has already been converted, resampledData_ still holds it.
+  if (frame != pendingFrame_) {
+    // Check if we need to reallocate the resampled buffer
+    int out_samples = swr_get_out_samples(swrCtx_, frame->nb_samples);
+    if (out_samples > maxResampledSamples_) {
+      av_freep(&resampledData_[0]);
+      av_freep(&resampledData_);
+
+      maxResampledSamples_ = out_samples;
+      int ret = av_samples_alloc_array_and_samples(
+          &resampledData_,
+          nullptr,
+          codecCtx_->ch_layout.nb_channels,
+          maxResampledSamples_,
+          AV_SAMPLE_FMT_FLTP,
+          0);
+
+      if (ret < 0) {
+        return false;
+      }
+    }
 
-    maxResampledSamples_ = out_samples;
-    int ret = av_samples_alloc_array_and_samples(
-        &resampledData_,
-        nullptr,
-        codecCtx_->ch_layout.nb_channels,
+    // Convert the frame
+    convertedSamples_ = swr_convert(
+        swrCtx_,
+        resampledData_,
         maxResampledSamples_,
-        AV_SAMPLE_FMT_FLTP,
-        0);
+        (const uint8_t **)frame->data,
+        frame->nb_samples);
 
-    if (ret < 0) {
+    if (convertedSamples_ < 0) {
       return false;
     }
-  }
 
-  // Convert the frame
-  int converted_samples = swr_convert(
-      swrCtx_,
-      resampledData_,
-      maxResampledSamples_,
-      (const uint8_t **)frame->data,
-      frame->nb_samples);
-
-  if (converted_samples < 0) {
-    return false;
+    convertedOffset_ = std::min(framesToSkip_, convertedSamples_);
+    framesToSkip_ = 0;
   }
 
+  auto numChannels = codecCtx_->ch_layout.nb_channels;
+  auto convertedFrames =
+      static_cast<size_t>(convertedSamples_ - convertedOffset_);
+  auto framesToCopy = resampler_ == nullptr
+      ? convertedFrames
+      : resampler_->getMaxOutputFrames(convertedFrames);
+
   // Check if converted data fits in buffer
-  if (bufferedBusIndex_ + converted_samples > maxBufferSize_) {
+  if (framesToCopy > bufferedAudio_->getAvailableSpace()) {
     pendingFrame_ = frame;
     return true;
   } else {
     pendingFrame_ = nullptr;
   }
 
-  // Copy converted data to our buffer
-  Locker locker(mutex_);
-  for (int ch = 0; ch < codecCtx_->ch_layout.nb_channels; ch++) {
-    auto *src = reinterpret_cast<float *>(resampledData_[ch]);
-    float *dst = bufferedBus_->getChannel(ch)->getData() + bufferedBusIndex_;
-    memcpy(dst, src, converted_samples * sizeof(float));
+  std::vector<const float *> source(numChannels);
+  for (int ch = 0; ch < numChannels; ch++) {
+    source[ch] =
+        reinterpret_cast<const float *>(resampledData_[ch]) + convertedOffset_;
+  }
+
+  if (resampler_ != nullptr) {
+    if (resamplerBus_->getSize() < framesToCopy) {
+      resamplerBus_ = std::make_shared<AudioBus>(
+          framesToCopy, numChannels, context_->getSampleRate());
+    }
+
+    std::vector<float *> destination(numChannels);
+    for (int ch = 0; ch < numChannels; ch++) {
+      destination[ch] = resamplerBus_->getChannel(ch)->getData();
+    }
+    framesToCopy = resampler_->process(
+        source.data(),
+        convertedFrames,
+        destination.data(),
+        framesToCopy);
+    source.assign(destination.begin(), destination.end());
   }
-  bufferedBusIndex_ += converted_samples;
+
+  // Copy converted data to our buffer
+  bufferedAudio_->write(source.data(), framesToCopy);
   return true;
 }
 
@@ -273,7 +590,10 @@ bool StreamerNode::setupDecoder() {
 
 void StreamerNode::cleanup() {
   streamFlag.store(false);
-  streamingThread_.join();
+  wakeUpStreamingThread();
+  if (streamingThread_.joinable()) {
+    streamingThread_.join();
+  }
   if (swrCtx_ != nullptr) {
     swr_free(&swrCtx_);
   }
@@ -283,6 +603,9 @@ void StreamerNode::cleanup() {
     av_freep(&resampledData_);
   }
 
+  resampler_.reset();
+  resamplerBus_.reset();
+
   if (frame_ != nullptr) {
     av_frame_free(&frame_);
   }
@@ -304,5 +627,10 @@ void StreamerNode::cleanup() {
   decoder_ = nullptr;
   codecpar_ = nullptr;
   maxResampledSamples_ = 0;
+  convertedSamples_ = 0;
+  pendingFrame_ = nullptr;
+  seekTimestamp_ = AV_NOPTS_VALUE;
+  framesToSkip_ = 0;
+  convertedOffset_ = 0;
 }
 } // namespace audioapi
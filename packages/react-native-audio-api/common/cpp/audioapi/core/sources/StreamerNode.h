@@ -11,6 +11,8 @@
 #pragma once
 
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
+#include <audioapi/dsp/Resampler.h>
+#include <audioapi/utils/SpscAudioRing.h>
 
 #ifndef AUDIO_API_TEST_SUITE
 extern "C" {
@@ -43,6 +45,37 @@ class StreamerNode : public AudioScheduledSourceNode {
   bool initialize(const std::string& inputUrl);
   void stop(double when) override;
 
+  /**
+   * @brief Move playback to the given position of the stream, in seconds from its start
+   * @note Asynchronous, the streaming thread seeks to the nearest seek point before the position and decodes up to it.
+   * Audio buffered so far is dropped and playback rebuffers the low watermark from the new position,
+   * nothing around the target is kept or prefetched.
+   * @note HTTP sources have to support range requests, otherwise the seek is ignored
+   */
+  void seek(double position);
+
+  /**
+   * @brief Decoding pauses once this many seconds are buffered
+   * @note Clamped to the capacity of the buffer
+   */
+  [[nodiscard]] float getHighWatermark() const;
+  void setHighWatermark(float seconds);
+
+  /**
+   * @brief Decoding resumes once the buffer drains below this many seconds, playback starts with at least this much buffered
+   * @note After every underrun playback waits for a larger prebuffer, up to the high watermark
+   */
+  [[nodiscard]] float getLowWatermark() const;
+  void setLowWatermark(float seconds);
+
+  void clearOnBufferEventCallbacks();
+  /** @brief Invoked from the audio thread with the total number of underruns whenever the buffer runs empty while playing */
+  void setOnBufferUnderrunCallbackId(uint64_t callbackId);
+  /** @brief Invoked from the audio thread with the number of buffered seconds every interval */
+  void setOnBufferLevelChangedCallbackId(uint64_t callbackId);
+  void setOnBufferLevelChangedInterval(int interval);
+  [[nodiscard]] int getOnBufferLevelChangedInterval() const;
+
  protected:
   std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus>& processingBus, int framesToProcess) override;
 
@@ -54,18 +87,39 @@ class StreamerNode : public AudioScheduledSourceNode {
   AVCodecParameters* codecpar_;
   AVPacket* pkt_;
   AVFrame* frame_; // Frame that is currently being processed
-  AVFrame* pendingFrame_; // Frame that is saved if bufferedBus is full
-  std::shared_ptr<AudioBus> bufferedBus_; // audio bus for buffering hls frames
-  size_t bufferedBusIndex_; // index in the buffered bus where we write the next frame
-  size_t maxBufferSize_; // maximum size of the buffered bus
+  AVFrame* pendingFrame_; // Frame that is saved if bufferedAudio is full
+  std::unique_ptr<SpscAudioRing> bufferedAudio_; // decoded frames, written by the streaming thread and read by the audio thread
   int audio_stream_index_; // index of the audio stream channel in the input
   SwrContext* swrCtx_;
   uint8_t** resampledData_; // weird ffmpeg way of using raw byte pointers for resampled data
   int maxResampledSamples_;
-  std::mutex mutex_;
+  int convertedSamples_; // number of samples in resampledData_
+  std::unique_ptr<dsp::Resampler> resampler_; // converts to the context sample rate, null if the rates match
+  std::shared_ptr<AudioBus> resamplerBus_; // output of the resampler before it is copied to the buffered bus
   std::thread streamingThread_;
   std::atomic<bool> streamFlag; // Flag to control the streaming thread
+  std::atomic<uint32_t> streamEpoch_; // bumped to wake the streaming thread up, it sleeps while the buffer is full
+  std::atomic<bool> isStreamingThreadWaiting_;
+  std::atomic<bool> isStreamFinished_; // set once every frame of the stream is buffered
+  std::atomic<double> seekTarget_; // requested position in seconds, NO_SEEK if there is none
+  std::atomic<uint32_t> seekGeneration_; // bumped by the streaming thread after every seek
+  uint32_t seenSeekGeneration_; // last seek the audio thread has rebuffered for
+  int64_t seekTimestamp_; // frames before it are dropped after a seek, AV_NOPTS_VALUE when done
+  int framesToSkip_; // samples of the next converted frame that are before the seek target
+  int convertedOffset_; // first sample of resampledData_ that is kept
+  std::atomic<float> lowWatermark_;
+  std::atomic<float> highWatermark_;
+  size_t prebufferFrames_; // frames playback waits for after start and underruns
+  bool isPrebuffering_;
+  int underrunCount_;
+  std::atomic<uint64_t> onBufferUnderrunCallbackId_; // 0 means no callback
+  std::atomic<uint64_t> onBufferLevelChangedCallbackId_; // 0 means no callback
+  int onBufferLevelChangedInterval_;
+  int onBufferLevelChangedTime_;
   static constexpr float BUFFER_LENGTH_SECONDS = 5.0f; // Length of the buffer in seconds
+  static constexpr double NO_SEEK = -1.0;
+  static constexpr float DEFAULT_LOW_WATERMARK_SECONDS = 0.5f;
+  static constexpr float DEFAULT_HIGH_WATERMARK_SECONDS = 3.0f;
   static constexpr int INITIAL_MAX_RESAMPLED_SAMPLES = 8192; // Initial size for resampled data
 
   /**
@@ -75,8 +129,9 @@ class StreamerNode : public AudioScheduledSourceNode {
   bool setupResampler();
 
   /**
-   * @brief Resample the audio frame, change its sample format and channel layout
+   * @brief Resample the audio frame, change its sample format and sample rate
    * @param frame The AVFrame to resample
+   * @note swr only converts the sample format, the rate is converted by dsp::Resampler
    * @return true if successful, false otherwise
    */
   bool processFrameWithResampler(AVFrame* frame);
@@ -84,11 +139,40 @@ class StreamerNode : public AudioScheduledSourceNode {
   /**
    * @brief Thread function to continuously read and process audio frames
    * @details This function runs in a separate thread to avoid blocking the main audio processing thread
-   * @note It will read frames from the input stream, resample them, and store them in the buffered bus
-   * @note The thread will stop when streamFlag is set to false
+   * @note It will read frames from the input stream, resample them, and store them in the buffered audio ring
+   * @note Every packet is drained of all of its frames. Once the high watermark is reached the thread sleeps
+   * until the audio thread drains the buffer below the low watermark
+   * @note The thread will stop when streamFlag is set to false or the stream ends
    */
   void streamAudio();
 
+  /**
+   * @brief Decode the next frame into frame_
+   * @return 0 on success, AVERROR_EOF at the end of the stream, other negative value on error
+   */
+  int decodeNextFrame();
+
+  /**
+   * @brief Seek the input, flush the decoder and drop the buffered audio
+   * @param position Target position in seconds from the start of the stream
+   */
+  void seekTo(double position);
+
+  /**
+   * @brief Drop the part of frame_ that is before the seek target
+   * @return false if the whole frame is before the target
+   */
+  bool trimFrameToSeekTarget();
+
+  /** @brief Wake the streaming thread up, safe to call from the audio thread */
+  void wakeUpStreamingThread();
+
+  /** @brief Frames corresponding to a watermark, clamped to the capacity of the buffer */
+  [[nodiscard]] size_t getWatermarkFrames(float seconds) const;
+
+  void sendOnBufferUnderrunEvent();
+  void sendOnBufferLevelChangedEvent(size_t bufferedFrames);
+
   /** @brief Clean up resources */
   void cleanup();
 
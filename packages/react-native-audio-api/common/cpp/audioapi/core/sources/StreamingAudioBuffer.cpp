@@ -0,0 +1,183 @@
+#include <audioapi/core/sources/StreamingAudioBuffer.h>
+#include <audioapi/core/utils/AudioStreamDecoder.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace audioapi {
+
+StreamingAudioBuffer::StreamingAudioBuffer(
+    std::unique_ptr<AudioStreamDecoder> decoder)
+    : decoder_(std::move(decoder)),
+      numberOfChannels_(decoder_->getNumberOfChannels()),
+      sampleRate_(decoder_->getSampleRate()),
+      ringSize_(
+          STREAMING_AUDIO_BUFFER_CHUNK_SIZE *
+          STREAMING_AUDIO_BUFFER_NUMBER_OF_CHUNKS),
+      ring_(std::make_unique<AudioBus>(
+          ringSize_,
+          numberOfChannels_,
+          sampleRate_)),
+      ringChannels_(numberOfChannels_),
+      endFrame_(
+          decoder_->getLength() > 0 ? decoder_->getLength() : UNKNOWN_END) {
+  // starts decoding from the beginning right away
+  decodingThread_ =
+      std::thread(&StreamingAudioBuffer::decodingThreadFunc, this);
+}
+
+StreamingAudioBuffer::~StreamingAudioBuffer() {
+  isRunning_.store(false, std::memory_order_release);
+  wakeUpDecodingThread();
+  decodingThread_.join();
+}
+
+size_t StreamingAudioBuffer::getLength() const {
+  auto endFrame = endFrame_.load(std::memory_order_acquire);
+  return endFrame == UNKNOWN_END ? 0 : endFrame;
+}
+
+float StreamingAudioBuffer::getSampleRate() const {
+  return sampleRate_;
+}
+
+double StreamingAudioBuffer::getDuration() const {
+  return static_cast<double>(getLength()) / sampleRate_;
+}
+
+int StreamingAudioBuffer::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+size_t StreamingAudioBuffer::getSizeInBytes() const {
+  return ringSize_ * numberOfChannels_ * sizeof(float);
+}
+
+size_t StreamingAudioBuffer::read(
+    AudioBus *destination,
+    size_t frame,
+    size_t destinationStart,
+    size_t frames) {
+  if (seekTarget_.load(std::memory_order_acquire) != NO_SEEK ||
+      isEnded(frame)) {
+    return 0;
+  }
+
+  auto windowStart = windowStart_.load(std::memory_order_acquire);
+  auto writtenEnd = writtenEnd_.load(std::memory_order_acquire);
+  auto readPosition = readPosition_.load(std::memory_order_relaxed);
+
+  // Frames behind the read position may be overwritten already, and it is
+  // quicker to seek than to decode through more than a chunk.
+  if (frame < readPosition || frame < windowStart ||
+      frame > writtenEnd + STREAMING_AUDIO_BUFFER_CHUNK_SIZE) {
+    requestSeek(frame);
+    return 0;
+  }
+
+  readPosition_.store(frame, std::memory_order_release);
+  if (frame / STREAMING_AUDIO_BUFFER_CHUNK_SIZE !=
+      readPosition / STREAMING_AUDIO_BUFFER_CHUNK_SIZE) {
+    wakeUpDecodingThread();
+  }
+
+  if (writtenEnd <= frame) {
+    return 0;
+  }
+
+  auto framesToCopy = std::min(frames, writtenEnd - frame);
+  auto position = frame % ringSize_;
+  auto firstPart = std::min(framesToCopy, ringSize_ - position);
+
+  destination->copy(ring_.get(), position, destinationStart, firstPart);
+  if (framesToCopy > firstPart) {
+    destination->copy(
+        ring_.get(), 0, destinationStart + firstPart, framesToCopy - firstPart);
+  }
+
+  return framesToCopy;
+}
+
+bool StreamingAudioBuffer::isEnded(size_t frame) const {
+  return frame >= endFrame_.load(std::memory_order_acquire);
+}
+
+void StreamingAudioBuffer::requestSeek(size_t frame) {
+  readPosition_.store(frame, std::memory_order_relaxed);
+  seekTarget_.store(frame, std::memory_order_release);
+  wakeUpDecodingThread();
+}
+
+void StreamingAudioBuffer::wakeUpDecodingThread() {
+  epoch_.fetch_add(1, std::memory_order_release);
+  epoch_.notify_one();
+}
+
+void StreamingAudioBuffer::decodingThreadFunc() {
+  while (true) {
+    auto seenEpoch = epoch_.load(std::memory_order_acquire);
+
+    if (!isRunning_.load(std::memory_order_acquire)) {
+      break;
+    }
+
+    auto seekTarget = seekTarget_.load(std::memory_order_acquire);
+    if (seekTarget != NO_SEEK) {
+      // a frame the decoder can not get to is treated as the end
+      if (!decoder_->seek(seekTarget)) {
+        endFrame_.store(
+            std::min(endFrame_.load(std::memory_order_relaxed), seekTarget),
+            std::memory_order_release);
+      }
+
+      windowStart_.store(seekTarget, std::memory_order_relaxed);
+      writtenEnd_.store(seekTarget, std::memory_order_relaxed);
+
+      // If the reader asked for another frame in the meantime, the request
+      // stays pending and the window is moved again.
+      seekTarget_.compare_exchange_strong(
+          seekTarget, NO_SEEK, std::memory_order_acq_rel);
+      continue;
+    }
+
+    if (!decodeChunk()) {
+      epoch_.wait(seenEpoch, std::memory_order_acquire);
+    }
+  }
+}
+
+bool StreamingAudioBuffer::decodeChunk() {
+  auto writtenEnd = writtenEnd_.load(std::memory_order_relaxed);
+  auto endFrame = endFrame_.load(std::memory_order_relaxed);
+  auto readPosition = readPosition_.load(std::memory_order_acquire);
+
+  // waits for the reader to free a whole chunk
+  if (writtenEnd >= endFrame ||
+      writtenEnd + STREAMING_AUDIO_BUFFER_CHUNK_SIZE >
+          readPosition + ringSize_) {
+    return false;
+  }
+
+  auto position = writtenEnd % ringSize_;
+  auto framesToDecode = std::min(
+      {STREAMING_AUDIO_BUFFER_CHUNK_SIZE,
+       ringSize_ - position,
+       endFrame - writtenEnd});
+
+  for (int ch = 0; ch < numberOfChannels_; ++ch) {
+    ringChannels_[ch] = ring_->getChannel(ch)->getData() + position;
+  }
+
+  auto framesDecoded = decoder_->read(ringChannels_.data(), framesToDecode);
+  if (framesDecoded < framesToDecode) {
+    endFrame_.store(writtenEnd + framesDecoded, std::memory_order_release);
+  }
+  writtenEnd_.store(writtenEnd + framesDecoded, std::memory_order_release);
+
+  return true;
+}
+
+} // namespace audioapi
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace audioapi {
+
+class AudioBus;
+class AudioStreamDecoder;
+
+/// @brief Audio buffer backed by an incremental decoder, only a window of frames around the read position is kept in memory.
+/// @note A background thread decodes ahead of the read position into a ring of
+/// STREAMING_AUDIO_BUFFER_NUMBER_OF_CHUNKS chunks, so memory stays constant regardless of the length of the file.
+/// Reading a frame outside of the decoded window seeks the decoder and decodes from there, nothing else is reset.
+/// @note There is a single read position, the buffer should be played by one source node at a time.
+/// Reads come from the audio thread, everything else is safe to call from any thread.
+class StreamingAudioBuffer {
+ public:
+  explicit StreamingAudioBuffer(std::unique_ptr<AudioStreamDecoder> decoder);
+  ~StreamingAudioBuffer();
+
+  StreamingAudioBuffer(const StreamingAudioBuffer &) = delete;
+  StreamingAudioBuffer &operator=(const StreamingAudioBuffer &) = delete;
+
+  /// @brief Length in frames, 0 until the end of the stream is found if the format does not tell it upfront.
+  [[nodiscard]] size_t getLength() const;
+  [[nodiscard]] float getSampleRate() const;
+  [[nodiscard]] double getDuration() const;
+  [[nodiscard]] int getNumberOfChannels() const;
+  /// @brief Memory held by the decoded window.
+  [[nodiscard]] size_t getSizeInBytes() const;
+
+  /// @brief Copies frames [frame, frame + frames) to the bus starting at destinationStart, as many of them as are decoded already.
+  /// @return Number of copied frames, 0 while the decoder is moving to the frame.
+  /// @note Reading backwards or far ahead of the previous read seeks the decoder.
+  size_t read(AudioBus *destination, size_t frame, size_t destinationStart, size_t frames);
+
+  /// @brief Whether the frame is past the end of the stream.
+  /// @note For formats without a known length the end is found only once decoding gets there.
+  [[nodiscard]] bool isEnded(size_t frame) const;
+
+ private:
+  static constexpr size_t NO_SEEK = std::numeric_limits<size_t>::max();
+  static constexpr size_t UNKNOWN_END = std::numeric_limits<size_t>::max();
+
+  std::unique_ptr<AudioStreamDecoder> decoder_;
+  int numberOfChannels_;
+  float sampleRate_;
+
+  // decoded frames, frame f is kept at f % ringSize_
+  size_t ringSize_;
+  std::unique_ptr<AudioBus> ring_;
+  std::vector<float *> ringChannels_;
+
+  // Written by the decoding thread. Frames [windowStart_, writtenEnd_) are
+  // decoded, the ones more than a ring behind the read position are
+  // overwritten.
+  std::atomic<size_t> windowStart_{0};
+  std::atomic<size_t> writtenEnd_{0};
+  // length of the stream, UNKNOWN_END until it is known
+  std::atomic<size_t> endFrame_;
+
+  // Written by the reading thread. Nothing at or after readPosition_ is
+  // overwritten, a pending seek is cleared once the window starts at it.
+  std::atomic<size_t> readPosition_{0};
+  std::atomic<size_t> seekTarget_{NO_SEEK};
+
+  std::thread decodingThread_;
+  std::atomic<uint32_t> epoch_{0};
+  std::atomic<bool> isRunning_{true};
+
+  void requestSeek(size_t frame);
+  void wakeUpDecodingThread();
+  void decodingThreadFunc();
+  bool decodeChunk();
+};
+
+} // namespace audioapi
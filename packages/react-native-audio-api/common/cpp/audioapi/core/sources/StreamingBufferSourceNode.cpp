@@ -0,0 +1,203 @@
+#include <audioapi/core/BaseAudioContext.h>
+#include <audioapi/core/sources/StreamingBufferSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/Locker.h>
+#include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace audioapi {
+
+StreamingBufferSourceNode::StreamingBufferSourceNode(
+    BaseAudioContext *context,
+    bool pitchCorrection)
+    : AudioBufferBaseSourceNode(context, pitchCorrection) {
+  isInitialized_ = true;
+}
+
+StreamingBufferSourceNode::~StreamingBufferSourceNode() {
+  Locker locker(getBufferLock());
+
+  buffer_.reset();
+  interpolationBus_.reset();
+}
+
+std::shared_ptr<StreamingAudioBuffer> StreamingBufferSourceNode::getBuffer()
+    const {
+  return buffer_;
+}
+
+void StreamingBufferSourceNode::setBuffer(
+    const std::shared_ptr<StreamingAudioBuffer> &buffer) {
+  Locker locker(getBufferLock());
+
+  if (!buffer) {
+    buffer_ = nullptr;
+    interpolationBus_ = nullptr;
+    return;
+  }
+
+  buffer_ = buffer;
+  channelCount_ = buffer_->getNumberOfChannels();
+
+  audioBus_ = std::make_shared<AudioBus>(
+      RENDER_QUANTUM_SIZE, channelCount_, context_->getSampleRate());
+  playbackRateBus_ = std::make_shared<AudioBus>(
+      RENDER_QUANTUM_SIZE * 3, channelCount_, context_->getSampleRate());
+  interpolationBus_ = std::make_shared<AudioBus>(
+      RENDER_QUANTUM_SIZE * 2 + 1, channelCount_, context_->getSampleRate());
+
+  stretch_->presetDefault(channelCount_, buffer_->getSampleRate());
+}
+
+void StreamingBufferSourceNode::start(
+    double when,
+    double offset,
+    double duration) {
+  AudioScheduledSourceNode::start(when);
+
+  if (duration > 0) {
+    AudioScheduledSourceNode::stop(when + duration);
+  }
+
+  if (!buffer_) {
+    return;
+  }
+
+  // The decoder is moved to the offset by the first read, so the buffer is
+  // never touched from two threads.
+  vReadIndex_ = offset * buffer_->getSampleRate();
+}
+
+std::shared_ptr<AudioBus> StreamingBufferSourceNode::processNode(
+    const std::shared_ptr<AudioBus> &processingBus,
+    int framesToProcess) {
+  if (auto locker = Locker::tryLock(getBufferLock())) {
+    // No audio data to fill, zero the output and return.
+    if (!buffer_) {
+      processingBus->zero();
+      return processingBus;
+    }
+
+    if (!pitchCorrection_) {
+      processWithoutPitchCorrection(processingBus, framesToProcess);
+    } else {
+      processWithPitchCorrection(processingBus, framesToProcess);
+    }
+
+    handleStopScheduled();
+  } else {
+    processingBus->zero();
+  }
+
+  return processingBus;
+}
+
+double StreamingBufferSourceNode::getCurrentPosition() const {
+  return vReadIndex_ / buffer_->getSampleRate();
+}
+
+void StreamingBufferSourceNode::processWithoutInterpolation(
+    const std::shared_ptr<AudioBus> &processingBus,
+    size_t startOffset,
+    size_t offsetLength,
+    float playbackRate) {
+  if (playbackRate < 0.0f) {
+    processingBus->zero(startOffset, offsetLength);
+    return;
+  }
+
+  auto readIndex = static_cast<size_t>(vReadIndex_);
+  auto framesRead = buffer_->read(
+      processingBus.get(), readIndex, startOffset, offsetLength);
+  vReadIndex_ = static_cast<double>(readIndex + framesRead);
+
+  finishIfEnded(
+      processingBus, startOffset + framesRead, offsetLength - framesRead);
+}
+
+void StreamingBufferSourceNode::processWithInterpolation(
+    const std::shared_ptr<AudioBus> &processingBus,
+    size_t startOffset,
+    size_t offsetLength,
+    float playbackRate) {
+  if (playbackRate < 0.0f) {
+    processingBus->zero(startOffset, offsetLength);
+    return;
+  }
+
+  auto numberOfChannels = std::min(
+      processingBus->getNumberOfChannels(),
+      interpolationBus_->getNumberOfChannels());
+  auto capacity = interpolationBus_->getSize();
+  size_t writeIndex = startOffset;
+  size_t framesLeft = offsetLength;
+
+  // High rates need more frames than fit in the interpolation bus, then the
+  // frames are read in several parts.
+  while (framesLeft > 0) {
+    auto readIndex = static_cast<size_t>(vReadIndex_);
+    auto position = vReadIndex_ - static_cast<double>(readIndex);
+    auto framesNeeded = std::min(
+        static_cast<size_t>(std::ceil(position + playbackRate * framesLeft)) +
+            1,
+        capacity);
+
+    auto framesRead = buffer_->read(
+        interpolationBus_.get(), readIndex, 0, framesNeeded);
+    auto framesAvailable = framesRead;
+
+    // the last frame of the stream is interpolated with silence
+    if (buffer_->isEnded(readIndex + framesRead) && framesRead < capacity) {
+      interpolationBus_->zero(framesRead, 1);
+      framesAvailable += 1;
+    }
+
+    size_t framesWritten = 0;
+    while (framesWritten < framesLeft) {
+      auto index = static_cast<size_t>(position);
+      if (index + 1 >= framesAvailable) {
+        break;
+      }
+
+      auto factor = static_cast<float>(position - static_cast<double>(index));
+      for (int i = 0; i < numberOfChannels; i += 1) {
+        float *destination = processingBus->getChannel(i)->getData();
+        const float *source = interpolationBus_->getChannel(i)->getData();
+
+        destination[writeIndex + framesWritten] =
+            dsp::linearInterpolate(source, index, index + 1, factor);
+      }
+
+      position += playbackRate;
+      framesWritten += 1;
+    }
+
+    vReadIndex_ = static_cast<double>(readIndex) + position;
+    writeIndex += framesWritten;
+    framesLeft -= framesWritten;
+
+    // not decoded yet or the end of the stream
+    if (framesWritten == 0) {
+      break;
+    }
+  }
+
+  finishIfEnded(processingBus, writeIndex, framesLeft);
+}
+
+void StreamingBufferSourceNode::finishIfEnded(
+    const std::shared_ptr<AudioBus> &processingBus,
+    size_t writeIndex,
+    size_t framesLeft) {
+  processingBus->zero(writeIndex, framesLeft);
+
+  if (buffer_->isEnded(static_cast<size_t>(vReadIndex_))) {
+    playbackState_ = PlaybackState::STOP_SCHEDULED;
+  }
+}
+
+} // namespace audioapi
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <audioapi/core/sources/AudioBufferBaseSourceNode.h>
+#include <audioapi/core/sources/StreamingAudioBuffer.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief Plays a StreamingAudioBuffer, which decodes the file while it is being played.
+/// @note When the decoder falls behind, e.g. right after a seek, the node outputs silence and holds its position
+/// until the frames are decoded, rather than skipping them.
+/// @note Playback goes forward only, negative playback rates output silence. There is no looping.
+class StreamingBufferSourceNode : public AudioBufferBaseSourceNode {
+ public:
+  explicit StreamingBufferSourceNode(BaseAudioContext *context, bool pitchCorrection);
+  ~StreamingBufferSourceNode() override;
+
+  [[nodiscard]] std::shared_ptr<StreamingAudioBuffer> getBuffer() const;
+  void setBuffer(const std::shared_ptr<StreamingAudioBuffer> &buffer);
+
+  void start(double when, double offset, double duration = -1);
+
+ protected:
+  std::shared_ptr<AudioBus> processNode(const std::shared_ptr<AudioBus>& processingBus, int framesToProcess) override;
+  double getCurrentPosition() const override;
+
+ private:
+  std::shared_ptr<StreamingAudioBuffer> buffer_;
+  // frames read from the buffer for interpolation
+  std::shared_ptr<AudioBus> interpolationBus_;
+
+  void processWithoutInterpolation(
+      const std::shared_ptr<AudioBus>& processingBus,
+      size_t startOffset,
+      size_t offsetLength,
+      float playbackRate) override;
+
+  void processWithInterpolation(
+      const std::shared_ptr<AudioBus>& processingBus,
+      size_t startOffset,
+      size_t offsetLength,
+      float playbackRate) override;
+
+  void finishIfEnded(const std::shared_ptr<AudioBus>& processingBus, size_t writeIndex, size_t framesLeft);
+};
+
+} // namespace audioapi
@@ -11,6 +11,7 @@ WorkletSourceNode::WorkletSourceNode(
       workletRunner_(runtime),
       shareableWorklet_(worklet) {
   isInitialized_ = true;
+  requiresSerialRender_ = true;
 
   // Prepare buffers for audio processing
   size_t outputChannelCount = this->getChannelCount();
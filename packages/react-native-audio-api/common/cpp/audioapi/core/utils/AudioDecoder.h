@@ -1,7 +1,9 @@
 #pragma once
 
 #include <audioapi/libs/audio-stretch/stretch.h>
+#include <audioapi/core/utils/AudioStreamDecoder.h>
 #include <audioapi/libs/miniaudio/miniaudio.h>
+#include <audioapi/utils/AudioBus.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,8 +24,6 @@ enum class AudioFormat {
   MOV
 };
 
-class AudioBus;
-
 static constexpr int CHUNK_SIZE = 4096;
 
 class AudioDecoder {
@@ -38,20 +38,34 @@ class AudioDecoder {
   [[nodiscard]] std::shared_ptr<AudioBus> decodeWithPCMInBase64(
       const std::string &data,
       float playbackSpeed) const;
+  // Opens the file for incremental decoding, formats decoded with FFmpeg are
+  // not supported and return nullptr.
+  [[nodiscard]] std::unique_ptr<AudioStreamDecoder> openFileStream(
+      const std::string &path) const;
 
  private:
   float sampleRate_;
   int numChannels_ = 2;
 
-  static std::vector<int16_t> readAllPcmFrames(
+  // Decodes as f32 and de-interleaves every chunk straight into the bus,
+  // returns nullptr when nothing was decoded.
+  static std::shared_ptr<AudioBus> readAllPcmFrames(
       ma_decoder &decoder,
       int numChannels,
-      ma_uint64 &outFramesRead);
-  static std::shared_ptr<AudioBus> makeAudioBusFromInt16Buffer(
-      const std::vector<int16_t> &buffer,
-      int numChannels,
       float sampleRate);
 
+  // Returns a bus of the given size holding the first framesToKeep frames of
+  // audioBus. Decoded length is only an estimate, if it is known at all.
+  [[nodiscard]] static std::shared_ptr<AudioBus> resizeAudioBus(
+      const std::shared_ptr<AudioBus> &audioBus,
+      size_t size,
+      size_t framesToKeep) {
+    auto resizedBus = std::make_shared<AudioBus>(
+        size, audioBus->getNumberOfChannels(), audioBus->getSampleRate());
+    resizedBus->copy(audioBus.get(), 0, 0, std::min(framesToKeep, size));
+    return resizedBus;
+  }
+
   void changePlaybackSpeedIfNeeded(
       std::vector<int16_t> &buffer,
       size_t framesDecoded,
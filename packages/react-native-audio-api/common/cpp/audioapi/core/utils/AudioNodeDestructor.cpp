@@ -7,7 +7,7 @@ namespace audioapi {
 AudioNodeDestructor::AudioNodeDestructor() {
   isExiting_.store(false, std::memory_order_release);
   auto [sender, receiver] = channels::spsc::channel<
-      std::shared_ptr<AudioNode>,
+      std::shared_ptr<void>,
       channels::spsc::OverflowStrategy::WAIT_ON_FULL,
       channels::spsc::WaitStrategy::ATOMIC_WAIT>(kChannelCapacity);
   sender_ = std::move(sender);
@@ -27,13 +27,12 @@ AudioNodeDestructor::~AudioNodeDestructor() {
 
 bool AudioNodeDestructor::tryAddNodeForDeconstruction(
     std::shared_ptr<AudioNode> &&node) {
-  return sender_.try_send(std::move(node)) ==
-      channels::spsc::ResponseStatus::SUCCESS;
+  return tryAddForDeconstruction(std::move(node));
 }
 
 void AudioNodeDestructor::process(
     channels::spsc::Receiver<
-        std::shared_ptr<AudioNode>,
+        std::shared_ptr<void>,
         channels::spsc::OverflowStrategy::WAIT_ON_FULL,
         channels::spsc::WaitStrategy::ATOMIC_WAIT> &&receiver) {
   auto rcv = std::move(receiver);
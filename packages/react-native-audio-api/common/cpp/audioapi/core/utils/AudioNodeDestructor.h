@@ -11,7 +11,7 @@ namespace audioapi {
 class AudioNode;
 
 #define AUDIO_NODE_DESTRUCTOR_SPSC_OPTIONS \
-  std::shared_ptr<AudioNode>, \
+  std::shared_ptr<void>, \
   channels::spsc::OverflowStrategy::WAIT_ON_FULL, \
   channels::spsc::WaitStrategy::ATOMIC_WAIT
 
@@ -26,6 +26,16 @@ class AudioNodeDestructor {
   /// @note node does NOT get moved out if it is not successfully added.
   bool tryAddNodeForDeconstruction(std::shared_ptr<AudioNode> &&node);
 
+  /// @brief Adds any object to the deconstruction queue, e.g. storage swapped out by the audio thread.
+  /// @param object The object to be released off the audio thread.
+  /// @return True if the object was successfully added, false otherwise.
+  /// @note object does NOT get moved out if it is not successfully added.
+  template <typename T>
+  bool tryAddForDeconstruction(std::shared_ptr<T> &&object) {
+    return sender_.try_send(std::move(object)) ==
+        channels::spsc::ResponseStatus::SUCCESS;
+  }
+
  private:
   static constexpr size_t kChannelCapacity = 1024;
 
@@ -1,11 +1,71 @@
 #include <audioapi/core/AudioNode.h>
 #include <audioapi/core/AudioParam.h>
+#include <audioapi/core/effects/DelayNode.h>
 #include <audioapi/core/sources/AudioScheduledSourceNode.h>
 #include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/Constants.h>
 #include <audioapi/core/utils/Locker.h>
 
 namespace audioapi {
 
+struct AudioNodeManager::Storage {
+  std::vector<std::shared_ptr<AudioScheduledSourceNode>> sourceNodes;
+  std::vector<std::shared_ptr<AudioNode>> processingNodes;
+  std::vector<std::shared_ptr<AudioParam>> audioParams;
+  std::vector<AudioNode *> renderList;
+  std::vector<std::pair<AudioNode *, size_t>> renderListStack;
+  std::vector<DelayNode *> cycleBreakingDelays;
+  std::vector<AudioNode *> serialRenderList;
+  std::vector<AudioNode *> renderGroupNodes;
+  std::vector<size_t> renderGroupOffsets;
+  std::vector<size_t> renderGroupParents;
+  std::vector<size_t> renderGroupIds;
+  std::vector<size_t> renderGroupCursors;
+  // see AudioNodeManager::retireStorage
+  std::shared_ptr<void> retiredStorage;
+
+  Storage(size_t capacity, size_t audioParamCapacity) {
+    sourceNodes.reserve(capacity);
+    processingNodes.reserve(capacity);
+    audioParams.reserve(audioParamCapacity);
+    // the render lists hold the destination too
+    renderList.reserve(capacity + 1);
+    renderListStack.reserve(capacity + 1);
+    cycleBreakingDelays.reserve(capacity);
+    serialRenderList.reserve(capacity);
+    renderGroupNodes.reserve(capacity);
+    renderGroupOffsets.reserve(capacity + 1);
+    renderGroupParents.reserve(capacity + 1);
+    renderGroupIds.reserve(capacity + 1);
+    renderGroupCursors.reserve(capacity + 1);
+  }
+};
+
+struct AudioNodeManager::ConnectionStorage {
+  // The lists of either of them are swapped. Kept alive by the connect event
+  // queued after this one.
+  AudioNode *node = nullptr;
+  AudioParam *param = nullptr;
+  std::vector<AudioNode *> inputNodes;
+  std::vector<AudioBus *> inputBuses;
+  std::vector<std::shared_ptr<AudioNode>> outputNodes;
+  std::vector<std::shared_ptr<AudioParam>> outputParams;
+  // see AudioNodeManager::retireStorage
+  std::shared_ptr<void> retiredStorage;
+
+  ConnectionStorage(AudioNode *node, size_t capacity) : node(node) {
+    inputNodes.reserve(capacity);
+    inputBuses.reserve(capacity);
+    outputNodes.reserve(capacity);
+    outputParams.reserve(capacity);
+  }
+
+  ConnectionStorage(AudioParam *param, size_t capacity) : param(param) {
+    inputNodes.reserve(capacity);
+    inputBuses.reserve(capacity);
+  }
+};
+
 AudioNodeManager::Event::Event(Event &&other) {
   *this = std::move(other);
 }
@@ -36,6 +96,13 @@ AudioNodeManager::Event &AudioNodeManager::Event::operator=(Event &&other) {
       case EventPayloadType::NODE:
         payload.node = std::move(other.payload.node);
         break;
+      case EventPayloadType::STORAGE:
+        payload.storage = std::move(other.payload.storage);
+        break;
+      case EventPayloadType::CONNECTION_STORAGE:
+        payload.connectionStorage =
+            std::move(other.payload.connectionStorage);
+        break;
 
       default:
         break;
@@ -63,6 +130,12 @@ AudioNodeManager::Event::~Event() {
     case EventPayloadType::NODE:
       payload.node.~shared_ptr();
       break;
+    case EventPayloadType::STORAGE:
+      payload.storage.~shared_ptr();
+      break;
+    case EventPayloadType::CONNECTION_STORAGE:
+      payload.connectionStorage.~shared_ptr();
+      break;
   }
 }
 
@@ -71,6 +144,17 @@ AudioNodeManager::AudioNodeManager() {
   processingNodes_.reserve(kInitialCapacity);
   audioParams_.reserve(kInitialCapacity);
 
+  Storage storage(kInitialCapacity, kInitialCapacity);
+  renderList_.swap(storage.renderList);
+  renderListStack_.swap(storage.renderListStack);
+  cycleBreakingDelays_.swap(storage.cycleBreakingDelays);
+  serialRenderList_.swap(storage.serialRenderList);
+  renderGroupNodes_.swap(storage.renderGroupNodes);
+  renderGroupOffsets_.swap(storage.renderGroupOffsets);
+  renderGroupParents_.swap(storage.renderGroupParents);
+  renderGroupIds_.swap(storage.renderGroupIds);
+  renderGroupCursors_.swap(storage.renderGroupCursors);
+
   auto channel_pair = channels::spsc::channel<
       std::unique_ptr<Event>,
       channels::spsc::OverflowStrategy::WAIT_ON_FULL,
@@ -88,6 +172,11 @@ void AudioNodeManager::addPendingNodeConnection(
     const std::shared_ptr<AudioNode> &from,
     const std::shared_ptr<AudioNode> &to,
     ConnectionType type) {
+  if (type == ConnectionType::CONNECT) {
+    reserveConnection(from);
+    reserveConnection(to);
+  }
+
   auto event = std::make_unique<Event>();
   event->type = type;
   event->payloadType = EventPayloadType::NODES;
@@ -101,6 +190,11 @@ void AudioNodeManager::addPendingParamConnection(
     const std::shared_ptr<AudioNode> &from,
     const std::shared_ptr<AudioParam> &to,
     ConnectionType type) {
+  if (type == ConnectionType::CONNECT) {
+    reserveConnection(from);
+    reserveConnection(to);
+  }
+
   auto event = std::make_unique<Event>();
   event->type = type;
   event->payloadType = EventPayloadType::PARAMS;
@@ -114,10 +208,51 @@ void AudioNodeManager::preProcessGraph() {
   settlePendingConnections();
   prepareNodesForDestruction(sourceNodes_);
   prepareNodesForDestruction(processingNodes_);
+
+  if (retiredStorage_ != nullptr) {
+    nodeDeconstructor_.tryAddForDeconstruction(std::move(retiredStorage_));
+  }
+}
+
+const std::vector<AudioNode *> &AudioNodeManager::getRenderList(
+    AudioNode *destination) {
+  if (isRenderListDirty_) {
+    rebuildRenderList(destination);
+    isRenderListDirty_ = false;
+  }
+
+  return renderList_;
+}
+
+const std::vector<AudioNode *> &AudioNodeManager::getSerialRenderList() const {
+  return serialRenderList_;
+}
+
+const std::vector<DelayNode *> &AudioNodeManager::getCycleBreakingDelays()
+    const {
+  return cycleBreakingDelays_;
+}
+
+size_t AudioNodeManager::getNumberOfRenderGroups() const {
+  return renderGroupOffsets_.empty() ? 0 : renderGroupOffsets_.size() - 1;
+}
+
+size_t AudioNodeManager::getNumberOfLargeRenderGroups() const {
+  return numberOfLargeRenderGroups_;
+}
+
+std::span<AudioNode *const> AudioNodeManager::getRenderGroup(
+    size_t group) const {
+  assert(group + 1 < renderGroupOffsets_.size());
+  return {
+      renderGroupNodes_.data() + renderGroupOffsets_[group],
+      renderGroupOffsets_[group + 1] - renderGroupOffsets_[group]};
 }
 
 void AudioNodeManager::addProcessingNode(
     const std::shared_ptr<AudioNode> &node) {
+  reserveStorageForNode();
+
   auto event = std::make_unique<Event>();
   event->type = ConnectionType::ADD;
   event->payloadType = EventPayloadType::NODE;
@@ -128,6 +263,8 @@ void AudioNodeManager::addProcessingNode(
 
 void AudioNodeManager::addSourceNode(
     const std::shared_ptr<AudioScheduledSourceNode> &node) {
+  reserveStorageForNode();
+
   auto event = std::make_unique<Event>();
   event->type = ConnectionType::ADD;
   event->payloadType = EventPayloadType::SOURCE_NODE;
@@ -137,6 +274,8 @@ void AudioNodeManager::addSourceNode(
 }
 
 void AudioNodeManager::addAudioParam(const std::shared_ptr<AudioParam> &param) {
+  reserveStorageForAudioParam();
+
   auto event = std::make_unique<Event>();
   event->type = ConnectionType::ADD;
   event->payloadType = EventPayloadType::AUDIO_PARAM;
@@ -145,6 +284,88 @@ void AudioNodeManager::addAudioParam(const std::shared_ptr<AudioParam> &param) {
   sender_.send(std::move(event));
 }
 
+size_t AudioNodeManager::getNumberOfNodes() const {
+  return numberOfNodes_.load(std::memory_order_relaxed);
+}
+
+void AudioNodeManager::reserveStorageForNode() {
+  auto numberOfNodes =
+      numberOfNodes_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  if (numberOfNodes <= storageCapacity_) {
+    return;
+  }
+
+  // The lists are reserved here and swapped in by the audio thread before the
+  // node is added, so neither adding it nor rebuilding the render list
+  // reallocates on the audio thread.
+  storageCapacity_ = numberOfNodes * 2;
+  reserveStorage();
+}
+
+void AudioNodeManager::reserveStorageForAudioParam() {
+  numberOfAudioParams_ += 1;
+
+  if (numberOfAudioParams_ <= audioParamCapacity_) {
+    return;
+  }
+
+  audioParamCapacity_ = numberOfAudioParams_ * 2;
+  reserveStorage();
+}
+
+void AudioNodeManager::reserveStorage() {
+  auto event = std::make_unique<Event>();
+  event->type = ConnectionType::RESERVE;
+  event->payloadType = EventPayloadType::STORAGE;
+  event->payload.storage =
+      std::make_shared<Storage>(storageCapacity_, audioParamCapacity_);
+
+  sender_.send(std::move(event));
+}
+
+void AudioNodeManager::reserveConnection(
+    const std::shared_ptr<AudioNode> &node) {
+  auto numberOfConnections =
+      node->numberOfConnections_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  if (numberOfConnections <= node->connectionCapacity_) {
+    return;
+  }
+
+  // Like the node lists, the connection lists are swapped in by the audio
+  // thread before the connect event reaches it.
+  node->connectionCapacity_ = numberOfConnections * 2;
+
+  auto event = std::make_unique<Event>();
+  event->type = ConnectionType::RESERVE;
+  event->payloadType = EventPayloadType::CONNECTION_STORAGE;
+  event->payload.connectionStorage = std::make_shared<ConnectionStorage>(
+      node.get(), node->connectionCapacity_);
+
+  sender_.send(std::move(event));
+}
+
+void AudioNodeManager::reserveConnection(
+    const std::shared_ptr<AudioParam> &param) {
+  auto numberOfConnections =
+      param->numberOfConnections_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  if (numberOfConnections <= param->connectionCapacity_) {
+    return;
+  }
+
+  param->connectionCapacity_ = numberOfConnections * 2;
+
+  auto event = std::make_unique<Event>();
+  event->type = ConnectionType::RESERVE;
+  event->payloadType = EventPayloadType::CONNECTION_STORAGE;
+  event->payload.connectionStorage = std::make_shared<ConnectionStorage>(
+      param.get(), param->connectionCapacity_);
+
+  sender_.send(std::move(event));
+}
+
 void AudioNodeManager::settlePendingConnections() {
   std::unique_ptr<Event> value;
   while (receiver_.try_receive(value) !=
@@ -162,11 +383,20 @@ void AudioNodeManager::settlePendingConnections() {
       case ConnectionType::ADD:
         handleAddToDeconstructionEvent(std::move(value));
         break;
+      case ConnectionType::RESERVE:
+        if (value->payloadType == EventPayloadType::CONNECTION_STORAGE) {
+          handleReserveConnectionsEvent(std::move(value));
+        } else {
+          handleReserveEvent(std::move(value));
+        }
+        break;
     }
   }
 }
 
 void AudioNodeManager::handleConnectEvent(std::unique_ptr<Event> event) {
+  isRenderListDirty_ = true;
+
   if (event->payloadType == EventPayloadType::NODES) {
     event->payload.nodes.from->connectNode(event->payload.nodes.to);
   } else if (event->payloadType == EventPayloadType::PARAMS) {
@@ -177,6 +407,8 @@ void AudioNodeManager::handleConnectEvent(std::unique_ptr<Event> event) {
 }
 
 void AudioNodeManager::handleDisconnectEvent(std::unique_ptr<Event> event) {
+  isRenderListDirty_ = true;
+
   if (event->payloadType == EventPayloadType::NODES) {
     event->payload.nodes.from->disconnectNode(event->payload.nodes.to);
   } else if (event->payloadType == EventPayloadType::PARAMS) {
@@ -188,11 +420,13 @@ void AudioNodeManager::handleDisconnectEvent(std::unique_ptr<Event> event) {
 
 void AudioNodeManager::handleDisconnectAllEvent(std::unique_ptr<Event> event) {
   assert(event->payloadType == EventPayloadType::NODES);
-  for (auto it = event->payload.nodes.from->outputNodes_.begin();
-       it != event->payload.nodes.from->outputNodes_.end();) {
-    auto next = std::next(it);
-    event->payload.nodes.from->disconnectNode(*it);
-    it = next;
+  isRenderListDirty_ = true;
+
+  auto &from = event->payload.nodes.from;
+  while (!from->outputNodes_.empty()) {
+    // copied, as disconnecting removes it from the list
+    auto node = from->outputNodes_.back();
+    from->disconnectNode(node);
   }
 }
 
@@ -213,6 +447,303 @@ void AudioNodeManager::handleAddToDeconstructionEvent(
   }
 }
 
+void AudioNodeManager::handleReserveEvent(std::unique_ptr<Event> event) {
+  assert(event->payloadType == EventPayloadType::STORAGE);
+  auto &storage = *event->payload.storage;
+
+  for (auto &node : sourceNodes_) {
+    storage.sourceNodes.push_back(std::move(node));
+  }
+
+  for (auto &node : processingNodes_) {
+    storage.processingNodes.push_back(std::move(node));
+  }
+
+  for (auto &param : audioParams_) {
+    storage.audioParams.push_back(std::move(param));
+  }
+
+  // The render lists are rebuilt in the new storage, the old one is released
+  // by the node destructor.
+  sourceNodes_.swap(storage.sourceNodes);
+  processingNodes_.swap(storage.processingNodes);
+  audioParams_.swap(storage.audioParams);
+  renderList_.swap(storage.renderList);
+  renderListStack_.swap(storage.renderListStack);
+  cycleBreakingDelays_.swap(storage.cycleBreakingDelays);
+  serialRenderList_.swap(storage.serialRenderList);
+  renderGroupNodes_.swap(storage.renderGroupNodes);
+  renderGroupOffsets_.swap(storage.renderGroupOffsets);
+  renderGroupParents_.swap(storage.renderGroupParents);
+  renderGroupIds_.swap(storage.renderGroupIds);
+  renderGroupCursors_.swap(storage.renderGroupCursors);
+
+  isRenderListDirty_ = true;
+  retireStorage(std::move(event->payload.storage));
+}
+
+void AudioNodeManager::handleReserveConnectionsEvent(
+    std::unique_ptr<Event> event) {
+  assert(event->payloadType == EventPayloadType::CONNECTION_STORAGE);
+  auto &storage = *event->payload.connectionStorage;
+
+  if (auto *node = storage.node) {
+    storage.inputNodes.assign(node->inputNodes_.begin(), node->inputNodes_.end());
+
+    for (auto &outputNode : node->outputNodes_) {
+      storage.outputNodes.push_back(std::move(outputNode));
+    }
+
+    for (auto &outputParam : node->outputParams_) {
+      storage.outputParams.push_back(std::move(outputParam));
+    }
+
+    node->inputNodes_.swap(storage.inputNodes);
+    node->inputBuses_.swap(storage.inputBuses);
+    node->outputNodes_.swap(storage.outputNodes);
+    node->outputParams_.swap(storage.outputParams);
+  } else {
+    auto *param = storage.param;
+    storage.inputNodes.assign(
+        param->inputNodes_.begin(), param->inputNodes_.end());
+
+    param->inputNodes_.swap(storage.inputNodes);
+    param->inputBuses_.swap(storage.inputBuses);
+  }
+
+  retireStorage(std::move(event->payload.connectionStorage));
+}
+
+void AudioNodeManager::rebuildRenderList(AudioNode *destination) {
+  renderList_.clear();
+  cycleBreakingDelays_.clear();
+
+  renderListMark_ += 1;
+  appendInPostOrder(destination, renderList_);
+
+  // A delay node on a cycle breaks it, as in the Web Audio API. It is rendered
+  // from what it has already buffered, before the rest of the cycle, and takes
+  // its inputs after the quantum. The list is built again with such nodes
+  // treated as if they had no inputs, then their inputs are appended.
+  // Cycles without a delay node fall back to the previous quantum output, see
+  // AudioNode::processAudio.
+  bool hasDelayNodes = false;
+  for (auto *node : renderList_) {
+    node->isBreakingCycle_ = false;
+    hasDelayNodes = hasDelayNodes || node->canBreakCycle_;
+  }
+
+  if (hasDelayNodes) {
+    for (auto *node : renderList_) {
+      if (node->canBreakCycle_ && isOnCycle(node)) {
+        node->isBreakingCycle_ = true;
+        cycleBreakingDelays_.push_back(static_cast<DelayNode *>(node));
+      }
+    }
+
+    renderList_.clear();
+    renderListMark_ += 1;
+    appendInPostOrder(destination, renderList_);
+  }
+
+  // The destination is always emitted last and renders itself.
+  renderList_.pop_back();
+
+  for (auto *delayNode : cycleBreakingDelays_) {
+    for (auto *inputNode : delayNode->inputNodes_) {
+      appendInPostOrder(inputNode, renderList_);
+    }
+  }
+
+  rebuildRenderGroups();
+}
+
+void AudioNodeManager::rebuildRenderGroups() {
+  serialRenderList_.clear();
+  renderGroupNodes_.clear();
+  renderGroupOffsets_.clear();
+
+  // Nodes feeding AudioParams are pulled by the param owner, which may be
+  // rendered in any group, and nodes calling into a JS runtime have to stay on
+  // the audio thread. Both are rendered up front, together with their inputs,
+  // so the groups only read their output. They get a newer mark than the
+  // remaining nodes of the render list.
+  auto parallelMark = renderListMark_;
+  renderListMark_ += 1;
+
+  for (const auto &node : sourceNodes_) {
+    if (!node->outputParams_.empty()) {
+      appendInPostOrder(node.get(), serialRenderList_);
+    }
+  }
+
+  for (const auto &node : processingNodes_) {
+    if (!node->outputParams_.empty()) {
+      appendInPostOrder(node.get(), serialRenderList_);
+    }
+  }
+
+  for (auto *node : renderList_) {
+    if (node->requiresSerialRender_) {
+      appendInPostOrder(node, serialRenderList_);
+    }
+  }
+
+  // Union-find over the remaining nodes, nodes connected by an edge land in
+  // the same group.
+  auto numberOfNodes = renderList_.size();
+  renderGroupParents_.resize(numberOfNodes);
+  renderGroupIds_.assign(numberOfNodes, SIZE_MAX);
+
+  for (size_t i = 0; i < numberOfNodes; i += 1) {
+    renderList_[i]->renderListIndex_ = i;
+    renderGroupParents_[i] = i;
+  }
+
+  auto findRoot = [this](size_t index) {
+    while (renderGroupParents_[index] != index) {
+      renderGroupParents_[index] =
+          renderGroupParents_[renderGroupParents_[index]];
+      index = renderGroupParents_[index];
+    }
+    return index;
+  };
+
+  for (auto *node : renderList_) {
+    if (node->renderListMark_ != parallelMark) {
+      continue;
+    }
+
+    for (auto *inputNode : node->inputNodes_) {
+      if (inputNode->renderListMark_ == parallelMark) {
+        renderGroupParents_[findRoot(inputNode->renderListIndex_)] =
+            findRoot(node->renderListIndex_);
+      }
+    }
+  }
+
+  // Counting sort of the nodes by group, stable so every group keeps the
+  // render list order.
+  size_t numberOfGroups = 0;
+  renderGroupOffsets_.push_back(0);
+
+  for (size_t i = 0; i < numberOfNodes; i += 1) {
+    if (renderList_[i]->renderListMark_ != parallelMark) {
+      continue;
+    }
+
+    auto root = findRoot(i);
+
+    if (renderGroupIds_[root] == SIZE_MAX) {
+      renderGroupIds_[root] = numberOfGroups;
+      numberOfGroups += 1;
+      renderGroupOffsets_.push_back(0);
+    }
+
+    renderGroupOffsets_[renderGroupIds_[root] + 1] += 1;
+  }
+
+  numberOfLargeRenderGroups_ = 0;
+  for (size_t group = 0; group < numberOfGroups; group += 1) {
+    if (renderGroupOffsets_[group + 1] >=
+        RENDER_WORKER_POOL_MIN_GROUP_NODE_COUNT) {
+      numberOfLargeRenderGroups_ += 1;
+    }
+    renderGroupOffsets_[group + 1] += renderGroupOffsets_[group];
+  }
+
+  renderGroupNodes_.resize(renderGroupOffsets_.back());
+  renderGroupCursors_.assign(
+      renderGroupOffsets_.begin(), renderGroupOffsets_.end() - 1);
+
+  for (auto *node : renderList_) {
+    if (node->renderListMark_ != parallelMark) {
+      continue;
+    }
+
+    auto group = renderGroupIds_[findRoot(node->renderListIndex_)];
+    renderGroupNodes_[renderGroupCursors_[group]] = node;
+    renderGroupCursors_[group] += 1;
+  }
+}
+
+void AudioNodeManager::appendInPostOrder(
+    AudioNode *root,
+    std::vector<AudioNode *> &list) {
+  if (root->renderListMark_ == renderListMark_) {
+    return;
+  }
+
+  // Iterative depth-first search over the inputs, nodes are emitted in
+  // post-order, so every node lands after all of its inputs. Marks are bumped
+  // per rebuild to avoid clearing a visited set. Nodes that are still on the
+  // stack when reached again close a cycle and are not re-entered.
+  root->renderListMark_ = renderListMark_;
+  renderListStack_.emplace_back(root, 0);
+
+  while (!renderListStack_.empty()) {
+    auto &[node, inputIndex] = renderListStack_.back();
+
+    if (inputIndex < node->inputNodes_.size() && !node->isBreakingCycle_) {
+      auto *inputNode = node->inputNodes_[inputIndex];
+      inputIndex += 1;
+
+      if (inputNode->renderListMark_ != renderListMark_) {
+        inputNode->renderListMark_ = renderListMark_;
+        renderListStack_.emplace_back(inputNode, 0);
+      }
+
+      continue;
+    }
+
+    list.push_back(node);
+    renderListStack_.pop_back();
+  }
+}
+
+bool AudioNodeManager::isOnCycle(AudioNode *node) {
+  // Depth-first search over the inputs, looking for the node itself.
+  renderListMark_ += 1;
+  renderListStack_.clear();
+
+  for (auto *inputNode : node->inputNodes_) {
+    if (inputNode->renderListMark_ != renderListMark_) {
+      inputNode->renderListMark_ = renderListMark_;
+      renderListStack_.emplace_back(inputNode, 0);
+    }
+  }
+
+  while (!renderListStack_.empty()) {
+    auto *current = renderListStack_.back().first;
+    renderListStack_.pop_back();
+
+    if (current == node) {
+      renderListStack_.clear();
+      return true;
+    }
+
+    for (auto *inputNode : current->inputNodes_) {
+      if (inputNode->renderListMark_ != renderListMark_) {
+        inputNode->renderListMark_ = renderListMark_;
+        renderListStack_.emplace_back(inputNode, 0);
+      }
+    }
+  }
+
+  return false;
+}
+
+template <typename S>
+void AudioNodeManager::retireStorage(std::shared_ptr<S> &&storage) {
+  // Storage the node destructor had no room for goes along with this one.
+  storage->retiredStorage = std::move(retiredStorage_);
+
+  // storage is not moved out if it is not added
+  if (!nodeDeconstructor_.tryAddForDeconstruction(std::move(storage))) {
+    retiredStorage_ = std::move(storage);
+  }
+}
+
 template <typename U>
 inline bool AudioNodeManager::nodeCanBeDestructed(
     std::shared_ptr<U> const &node) {
@@ -253,16 +784,21 @@ void AudioNodeManager::prepareNodesForDestruction(
     while (begin < end && AudioNodeManager::nodeCanBeDestructed(vec[end])) {
       end--;
     }
+    // the node swapped in is checked again, as it is vec[begin] itself once
+    // begin reaches end
     if (AudioNodeManager::nodeCanBeDestructed(vec[begin])) {
       std::swap(vec[begin], vec[end]);
       end--;
+    } else {
+      begin++;
     }
-    begin++;
   }
 
   for (int i = begin; i < vec.size(); i++) {
-    if (vec[i])
+    if (vec[i]) {
       vec[i]->cleanup();
+      isRenderListDirty_ = true;
+    }
 
     /// If we fail to add we can't safely remove the node from the vector
     /// so we swap it and advance begin cursor
@@ -270,6 +806,8 @@ void AudioNodeManager::prepareNodesForDestruction(
     if (!nodeDeconstructor_.tryAddNodeForDeconstruction(std::move(vec[i]))) {
       std::swap(vec[i], vec[begin]);
       begin++;
+    } else {
+      numberOfNodes_.fetch_sub(1, std::memory_order_relaxed);
     }
   }
   if (begin < vec.size()) {
@@ -293,6 +831,8 @@ void AudioNodeManager::cleanup() {
   sourceNodes_.clear();
   processingNodes_.clear();
   audioParams_.clear();
+  renderList_.clear();
+  isRenderListDirty_ = true;
 }
 
 } // namespace audioapi
@@ -2,9 +2,12 @@
 
 #include <audioapi/core/utils/AudioNodeDestructor.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <audioapi/utils/SpscChannel.hpp>
@@ -14,6 +17,7 @@ namespace audioapi {
 class AudioNode;
 class AudioScheduledSourceNode;
 class AudioParam;
+class DelayNode;
 
 #define AUDIO_NODE_MANAGER_SPSC_OPTIONS \
   std::unique_ptr<Event>, \
@@ -22,9 +26,13 @@ class AudioParam;
 
 class AudioNodeManager {
  public:
-  enum class ConnectionType { CONNECT, DISCONNECT, DISCONNECT_ALL, ADD };
+  enum class ConnectionType { CONNECT, DISCONNECT, DISCONNECT_ALL, ADD, RESERVE };
   typedef ConnectionType EventType; // for backwards compatibility
-  enum class EventPayloadType { NODES, PARAMS, SOURCE_NODE, AUDIO_PARAM, NODE };
+  enum class EventPayloadType { NODES, PARAMS, SOURCE_NODE, AUDIO_PARAM, NODE, STORAGE, CONNECTION_STORAGE };
+  /// @brief Node lists reserved on the JavaScript thread, swapped in by the audio thread.
+  struct Storage;
+  /// @brief Connection lists of a node or a param reserved on the JavaScript thread, swapped in by the audio thread.
+  struct ConnectionStorage;
   union EventPayload {
     struct {
       std::shared_ptr<AudioNode> from;
@@ -37,6 +45,8 @@ class AudioNodeManager {
     std::shared_ptr<AudioScheduledSourceNode> sourceNode;
     std::shared_ptr<AudioParam> audioParam;
     std::shared_ptr<AudioNode> node;
+    std::shared_ptr<Storage> storage;
+    std::shared_ptr<ConnectionStorage> connectionStorage;
 
     // Default constructor that initializes the first member
     EventPayload() : nodes{} {}
@@ -60,6 +70,39 @@ class AudioNodeManager {
 
   void preProcessGraph();
 
+  /// @brief Returns the nodes feeding the destination in processing order.
+  /// @param destination The node the render list is built for.
+  /// @return Nodes topologically sorted, every node appears after all of its inputs.
+  /// @note The list is rebuilt only if the graph topology has changed since the last call.
+  /// @note Nodes connected only to AudioParams are not included, they are pulled by the params.
+  /// @note Should be only used from Audio thread
+  const std::vector<AudioNode *> &getRenderList(AudioNode *destination);
+
+  /// @brief Returns the nodes that have to be rendered before the render groups, on the calling thread.
+  /// @note Contains nodes feeding AudioParams, nodes that require serial rendering and all of their inputs.
+  /// @note Valid after getRenderList, should be only used from Audio thread
+  [[nodiscard]] const std::vector<AudioNode *> &getSerialRenderList() const;
+
+  /// @brief Returns the number of independent subgraphs of the render list.
+  /// @note Render groups share no nodes and meet only at the destination, so they can be rendered concurrently.
+  /// @note Valid after getRenderList, should be only used from Audio thread
+  [[nodiscard]] size_t getNumberOfRenderGroups() const;
+
+  /// @brief Returns the number of render groups with at least RENDER_WORKER_POOL_MIN_GROUP_NODE_COUNT nodes.
+  /// @note Rendering in parallel pays off only with two or more of them, otherwise the groups are rendered inline.
+  /// @note Valid after getRenderList, should be only used from Audio thread
+  [[nodiscard]] size_t getNumberOfLargeRenderGroups() const;
+
+  /// @brief Returns the nodes of a render group in processing order.
+  /// @param group Index of the group, less than getNumberOfRenderGroups().
+  [[nodiscard]] std::span<AudioNode *const> getRenderGroup(size_t group) const;
+
+  /// @brief Returns the delay nodes that break a cycle of the graph.
+  /// @note Such a delay node is rendered before the rest of its cycle, its inputs have to be written with
+  /// DelayNode::processCycleInputs once all nodes of the quantum are rendered.
+  /// @note Valid after getRenderList, should be only used from Audio thread
+  [[nodiscard]] const std::vector<DelayNode *> &getCycleBreakingDelays() const;
+
   /// @brief Adds a pending connection between two audio nodes.
   /// @param from The source audio node.
   /// @param to The destination audio node.
@@ -95,6 +138,9 @@ class AudioNodeManager {
   /// @note Should be only used from JavaScript/HostObjects thread
   void addAudioParam(const std::shared_ptr<AudioParam> &param);
 
+  /// @brief Returns the number of source and processing nodes alive.
+  [[nodiscard]] size_t getNumberOfNodes() const;
+
   void cleanup();
 
  private:
@@ -104,6 +150,19 @@ class AudioNodeManager {
   /// @note Higher capacity decreases number of reallocations at runtime (can be easily adjusted to 128 if needed)
   static constexpr size_t kInitialCapacity = 32;
 
+  /// @brief Number of source and processing nodes the lists have room for.
+  /// @note JavaScript/HostObjects thread only, grows before a node is added, so the audio thread never reallocates.
+  size_t storageCapacity_ = kInitialCapacity;
+  /// @brief Number of source and processing nodes alive, decremented by the audio thread.
+  std::atomic<size_t> numberOfNodes_ = 0;
+  /// @brief Number of audio params the list has room for, JavaScript/HostObjects thread only.
+  size_t audioParamCapacity_ = kInitialCapacity;
+  /// @brief Number of audio params added, JavaScript/HostObjects thread only.
+  size_t numberOfAudioParams_ = 0;
+  /// @brief Swapped out storage the node destructor had no room for, retried every render quantum.
+  /// @note Audio thread only.
+  std::shared_ptr<void> retiredStorage_;
+
   /// @brief Initial capacity for event passing channel
   /// @note High value reduces wait time for sender (JavaScript/HostObjects thread here)
   static constexpr size_t kChannelCapacity = 1024;
@@ -112,6 +171,22 @@ class AudioNodeManager {
   std::vector<std::shared_ptr<AudioNode>> processingNodes_;
   std::vector<std::shared_ptr<AudioParam>> audioParams_;
 
+  std::vector<AudioNode *> renderList_;
+  std::vector<std::pair<AudioNode *, size_t>> renderListStack_;
+  std::size_t renderListMark_ = 0;
+  bool isRenderListDirty_ = true;
+  std::vector<DelayNode *> cycleBreakingDelays_;
+
+  std::vector<AudioNode *> serialRenderList_;
+  // Nodes of all render groups, group i spans
+  // [renderGroupOffsets_[i], renderGroupOffsets_[i + 1]).
+  std::vector<AudioNode *> renderGroupNodes_;
+  std::vector<size_t> renderGroupOffsets_;
+  std::vector<size_t> renderGroupParents_;
+  std::vector<size_t> renderGroupIds_;
+  std::vector<size_t> renderGroupCursors_;
+  size_t numberOfLargeRenderGroups_ = 0;
+
   channels::spsc::Receiver<
     AUDIO_NODE_MANAGER_SPSC_OPTIONS> receiver_;
 
@@ -123,10 +198,25 @@ class AudioNodeManager {
   void handleDisconnectEvent(std::unique_ptr<Event> event);
   void handleDisconnectAllEvent(std::unique_ptr<Event> event);
   void handleAddToDeconstructionEvent(std::unique_ptr<Event> event);
+  void handleReserveEvent(std::unique_ptr<Event> event);
+  void handleReserveConnectionsEvent(std::unique_ptr<Event> event);
+  void reserveStorageForNode();
+  void reserveStorageForAudioParam();
+  void reserveStorage();
+  void reserveConnection(const std::shared_ptr<AudioNode> &node);
+  void reserveConnection(const std::shared_ptr<AudioParam> &param);
+  void rebuildRenderList(AudioNode *destination);
+  void rebuildRenderGroups();
+  void appendInPostOrder(AudioNode *root, std::vector<AudioNode *> &list);
+  bool isOnCycle(AudioNode *node);
 
   template <typename U>
   void prepareNodesForDestruction(std::vector<std::shared_ptr<U>> &vec);
 
+  /// @brief Hands storage swapped out by the audio thread to the node destructor, so it is not freed on the audio thread.
+  template <typename S>
+  void retireStorage(std::shared_ptr<S> &&storage);
+
   template <typename U>
   inline static bool nodeCanBeDestructed(std::shared_ptr<U> const& node);
 };
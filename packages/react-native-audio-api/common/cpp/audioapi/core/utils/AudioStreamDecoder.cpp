@@ -0,0 +1,71 @@
+#include <audioapi/core/utils/AudioStreamDecoder.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/VectorMath.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace audioapi {
+
+MiniaudioStreamDecoder::MiniaudioStreamDecoder(
+    std::unique_ptr<ma_decoder> decoder)
+    : decoder_(std::move(decoder)),
+      interleaved_(
+          STREAMING_AUDIO_BUFFER_CHUNK_SIZE * decoder_->outputChannels),
+      channels_(decoder_->outputChannels) {
+  ma_uint64 length = 0;
+  ma_decoder_get_length_in_pcm_frames(decoder_.get(), &length);
+  length_ = static_cast<size_t>(length);
+}
+
+MiniaudioStreamDecoder::~MiniaudioStreamDecoder() {
+  ma_decoder_uninit(decoder_.get());
+}
+
+int MiniaudioStreamDecoder::getNumberOfChannels() const {
+  return static_cast<int>(decoder_->outputChannels);
+}
+
+float MiniaudioStreamDecoder::getSampleRate() const {
+  return static_cast<float>(decoder_->outputSampleRate);
+}
+
+size_t MiniaudioStreamDecoder::getLength() const {
+  return length_;
+}
+
+size_t MiniaudioStreamDecoder::read(float *const *channels, size_t frames) {
+  auto numChannels = getNumberOfChannels();
+  auto maxFrames = interleaved_.size() / numChannels;
+  size_t framesRead = 0;
+
+  while (framesRead < frames) {
+    ma_uint64 framesDecoded = 0;
+    ma_decoder_read_pcm_frames(
+        decoder_.get(),
+        interleaved_.data(),
+        std::min(frames - framesRead, maxFrames),
+        &framesDecoded);
+    if (framesDecoded == 0) {
+      break;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch) {
+      channels_[ch] = channels[ch] + framesRead;
+    }
+    dsp::deinterleave(
+        interleaved_.data(),
+        channels_.data(),
+        numChannels,
+        static_cast<size_t>(framesDecoded));
+    framesRead += static_cast<size_t>(framesDecoded);
+  }
+
+  return framesRead;
+}
+
+bool MiniaudioStreamDecoder::seek(size_t frame) {
+  return ma_decoder_seek_to_pcm_frame(decoder_.get(), frame) == MA_SUCCESS;
+}
+
+} // namespace audioapi
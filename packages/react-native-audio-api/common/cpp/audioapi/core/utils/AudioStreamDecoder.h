@@ -0,0 +1,58 @@
+#pragma once
+
+#include <audioapi/libs/miniaudio/miniaudio.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Incremental decoder of an audio file, frames are produced in order starting from the current position.
+/// @note Used by a single thread at a time.
+class AudioStreamDecoder {
+ public:
+  virtual ~AudioStreamDecoder() = default;
+
+  [[nodiscard]] virtual int getNumberOfChannels() const = 0;
+  [[nodiscard]] virtual float getSampleRate() const = 0;
+
+  /// @brief Length of the stream in frames.
+  /// @note 0 when the format does not tell it without decoding the whole stream, e.g. Vorbis.
+  [[nodiscard]] virtual size_t getLength() const = 0;
+
+  /// @brief Decodes the next frames, de-interleaved into channels.
+  /// @return Number of decoded frames, less than requested only at the end of the stream.
+  virtual size_t read(float *const *channels, size_t frames) = 0;
+
+  /// @brief Moves the position of the next read.
+  /// @return false if the decoder can not seek to the frame.
+  virtual bool seek(size_t frame) = 0;
+};
+
+/// @brief AudioStreamDecoder reading from an initialized miniaudio decoder, which it takes ownership of.
+/// @note The decoder has to output f32, converted to the sample rate of the context.
+class MiniaudioStreamDecoder : public AudioStreamDecoder {
+ public:
+  explicit MiniaudioStreamDecoder(std::unique_ptr<ma_decoder> decoder);
+  ~MiniaudioStreamDecoder() override;
+
+  MiniaudioStreamDecoder(const MiniaudioStreamDecoder &) = delete;
+  MiniaudioStreamDecoder &operator=(const MiniaudioStreamDecoder &) = delete;
+
+  [[nodiscard]] int getNumberOfChannels() const override;
+  [[nodiscard]] float getSampleRate() const override;
+  [[nodiscard]] size_t getLength() const override;
+
+  size_t read(float *const *channels, size_t frames) override;
+  bool seek(size_t frame) override;
+
+ private:
+  std::unique_ptr<ma_decoder> decoder_;
+  size_t length_ = 0;
+  // interleaved output of the decoder
+  std::vector<float> interleaved_;
+  std::vector<float *> channels_;
+};
+
+} // namespace audioapi
@@ -9,6 +9,43 @@ namespace audioapi {
 // audio
 static constexpr int RENDER_QUANTUM_SIZE = 128;
 static constexpr size_t MAX_FFT_SIZE = 32768;
+static constexpr int MAX_CHANNEL_COUNT = 32;
+
+// parametric equalizer, default bands are spread logarithmically between the lowest and highest frequency
+static constexpr int PARAMETRIC_EQ_MAX_NUMBER_OF_BANDS = 32;
+static constexpr float PARAMETRIC_EQ_LOWEST_BAND_FREQUENCY = 32.0f;
+static constexpr float PARAMETRIC_EQ_HIGHEST_BAND_FREQUENCY = 16000.0f;
+
+// convolver, partitions of at least the background size are processed off the audio thread
+static constexpr size_t CONVOLVER_HEAD_PARTITION_SIZE = RENDER_QUANTUM_SIZE;
+static constexpr size_t CONVOLVER_BACKGROUND_PARTITION_SIZE = 1024;
+static constexpr size_t CONVOLVER_MAX_PARTITION_SIZE = 8192;
+
+// streaming audio buffer, frames decoded at once and the number of such chunks kept ahead of playback
+static constexpr size_t STREAMING_AUDIO_BUFFER_CHUNK_SIZE = 8192;
+static constexpr size_t STREAMING_AUDIO_BUFFER_NUMBER_OF_CHUNKS = 8;
+
+// resampler, ratios with more phases interpolate between this many filters
+static constexpr size_t RESAMPLER_MAX_NUMBER_OF_PHASES = 1024;
+
+// buffer queue source, buffers waiting in the queue at once, slots are allocated up front
+static constexpr size_t AUDIO_BUFFER_QUEUE_CAPACITY = 64;
+
+// audio meter, metered channels, log-spaced bands and their lowest and highest center frequency
+static constexpr int AUDIO_METER_MAX_CHANNEL_COUNT = 6;
+static constexpr int AUDIO_METER_MAX_NUMBER_OF_BANDS = 32;
+static constexpr float AUDIO_METER_LOWEST_BAND_FREQUENCY = 32.0f;
+static constexpr float AUDIO_METER_HIGHEST_BAND_FREQUENCY = 16000.0f;
+// seconds, window of rms, peaks and band energies, then of momentary and short-term loudness (ITU-R BS.1770)
+static constexpr float AUDIO_METER_LEVEL_WINDOW = 0.3f;
+static constexpr float AUDIO_METER_MOMENTARY_LOUDNESS_WINDOW = 0.4f;
+static constexpr float AUDIO_METER_SHORT_TERM_LOUDNESS_WINDOW = 3.0f;
+
+// analyser, milliseconds between analyses of the background thread, about one per 60 fps frame
+static constexpr int ANALYSER_DEFAULT_ANALYSIS_INTERVAL = 16;
+
+// events, audio thread events waiting for the dispatch thread, more of them are dropped
+static constexpr size_t AUDIO_EVENT_QUEUE_CAPACITY = 1024;
 
 // general
 static constexpr float MOST_POSITIVE_SINGLE_FLOAT = static_cast<float>(std::numeric_limits<float>::max());
@@ -21,4 +58,13 @@ static constexpr float PI = static_cast<float>(M_PI);
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_WORKER_COUNT = 4;
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_LOAD_BALANCER_QUEUE_SIZE = 32;
 static constexpr size_t PROMISE_VENDOR_THREAD_POOL_WORKER_QUEUE_SIZE = 32;
+
+// parallel rendering, worker threads in addition to the audio thread
+static constexpr size_t RENDER_WORKER_POOL_MAX_THREAD_COUNT = 3;
+// smallest render group worth handing to a worker, smaller ones are rendered
+// inline instead of paying a wake-up and a join every quantum
+static constexpr size_t RENDER_WORKER_POOL_MIN_GROUP_NODE_COUNT = 4;
+
+// decoding, worker threads of a context when the count is not given
+static constexpr size_t DECODE_EXECUTOR_DEFAULT_MAX_THREAD_COUNT = 4;
 } // namespace audioapi
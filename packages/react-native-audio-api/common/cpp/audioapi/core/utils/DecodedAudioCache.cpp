@@ -0,0 +1,244 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace audioapi {
+
+namespace {
+
+constexpr char ENTRY_MAGIC[8] = {'R', 'N', 'A', 'A', 'P', 'C', 'M', '\0'};
+// bump on every change of the layout, old entries are then decoded again
+constexpr uint32_t ENTRY_VERSION = 1;
+
+// Entry layout: header, source path, padding, then every channel padded to
+// a multiple of AudioArray::ALIGNMENT, so mapped channels are aligned too.
+struct EntryHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t numberOfChannels;
+  uint64_t length;
+  float sampleRate;
+  uint32_t sourcePathLength;
+  int64_t sourceModificationTime;
+  uint64_t sourceSize;
+  uint64_t dataOffset;
+  uint64_t channelStride;
+};
+
+struct SourceInfo {
+  int64_t modificationTime;
+  uint64_t size;
+};
+
+bool getSourceInfo(const std::string &path, SourceInfo &info) {
+  struct stat status {};
+  if (stat(path.c_str(), &status) != 0) {
+    return false;
+  }
+
+#if defined(__APPLE__)
+  const auto &modificationTime = status.st_mtimespec;
+#else
+  const auto &modificationTime = status.st_mtim;
+#endif
+  info.modificationTime =
+      static_cast<int64_t>(modificationTime.tv_sec) * 1'000'000'000 +
+      modificationTime.tv_nsec;
+  info.size = static_cast<uint64_t>(status.st_size);
+  return true;
+}
+
+size_t alignUp(size_t value) {
+  return (value + AudioArray::ALIGNMENT - 1) / AudioArray::ALIGNMENT *
+      AudioArray::ALIGNMENT;
+}
+
+bool writeAll(int fd, const void *data, size_t size) {
+  const auto *bytes = static_cast<const char *>(data);
+  while (size > 0) {
+    auto written = write(fd, bytes, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    bytes += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool writePadding(int fd, size_t size) {
+  static constexpr char zeros[AudioArray::ALIGNMENT] = {};
+  return writeAll(fd, zeros, size);
+}
+
+} // namespace
+
+DecodedAudioCache::DecodedAudioCache(std::string directory)
+    : directory_(std::move(directory)) {}
+
+const std::string &DecodedAudioCache::getDirectory() const {
+  return directory_;
+}
+
+std::shared_ptr<AudioBus> DecodedAudioCache::load(
+    const std::string &sourcePath,
+    float sampleRate) const {
+  SourceInfo source{};
+  if (!getSourceInfo(sourcePath, source)) {
+    return nullptr;
+  }
+
+  auto entryPath = getEntryPath(sourcePath, sampleRate);
+  int fd = open(entryPath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat status {};
+  if (fstat(fd, &status) != 0 ||
+      static_cast<size_t>(status.st_size) < sizeof(EntryHeader)) {
+    close(fd);
+    return nullptr;
+  }
+
+  // Private writable mapping, writes to the samples copy the touched pages
+  // instead of changing the entry.
+  auto fileSize = static_cast<size_t>(status.st_size);
+  auto *address =
+      mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    return nullptr;
+  }
+
+  std::shared_ptr<void> mapping(
+      address, [fileSize](void *address) { munmap(address, fileSize); });
+  auto *bytes = static_cast<char *>(address);
+
+  EntryHeader header{};
+  std::memcpy(&header, bytes, sizeof(header));
+
+  bool isValid =
+      std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 &&
+      header.version == ENTRY_VERSION && header.sampleRate == sampleRate &&
+      header.sourceModificationTime == source.modificationTime &&
+      header.sourceSize == source.size &&
+      header.sourcePathLength == sourcePath.size() &&
+      sizeof(header) + sourcePath.size() <= header.dataOffset &&
+      header.numberOfChannels > 0 &&
+      header.numberOfChannels <= static_cast<uint32_t>(MAX_CHANNEL_COUNT) &&
+      header.length > 0 &&
+      header.dataOffset % AudioArray::ALIGNMENT == 0 &&
+      header.channelStride % AudioArray::ALIGNMENT == 0 &&
+      header.channelStride / sizeof(float) >= header.length &&
+      header.dataOffset <= fileSize &&
+      header.channelStride <=
+          (fileSize - header.dataOffset) / header.numberOfChannels;
+
+  if (!isValid ||
+      std::memcmp(
+          bytes + sizeof(header), sourcePath.data(), sourcePath.size()) != 0) {
+    return nullptr;
+  }
+
+  std::vector<std::shared_ptr<AudioArray>> channels;
+  channels.reserve(header.numberOfChannels);
+  for (uint32_t i = 0; i < header.numberOfChannels; ++i) {
+    auto *data = reinterpret_cast<float *>(
+        bytes + header.dataOffset + i * header.channelStride);
+    channels.push_back(
+        std::make_shared<AudioArray>(data, header.length, mapping));
+  }
+
+  return std::make_shared<AudioBus>(std::move(channels), sampleRate);
+}
+
+bool DecodedAudioCache::store(
+    const std::string &sourcePath,
+    const AudioBus &audioBus) const {
+  SourceInfo source{};
+  if (!getSourceInfo(sourcePath, source)) {
+    return false;
+  }
+
+  EntryHeader header{};
+  std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+  header.version = ENTRY_VERSION;
+  header.numberOfChannels = audioBus.getNumberOfChannels();
+  header.length = audioBus.getSize();
+  header.sampleRate = audioBus.getSampleRate();
+  header.sourcePathLength = static_cast<uint32_t>(sourcePath.size());
+  header.sourceModificationTime = source.modificationTime;
+  header.sourceSize = source.size;
+  header.dataOffset = alignUp(sizeof(header) + sourcePath.size());
+  header.channelStride = alignUp(audioBus.getSize() * sizeof(float));
+
+  mkdir(directory_.c_str(), 0700);
+
+  auto entryPath = getEntryPath(sourcePath, audioBus.getSampleRate());
+  auto temporaryPath = entryPath + ".XXXXXX";
+  int fd = mkstemp(temporaryPath.data());
+  if (fd < 0) {
+    return false;
+  }
+
+  auto channelBytes = audioBus.getSize() * sizeof(float);
+  bool isWritten = writeAll(fd, &header, sizeof(header)) &&
+      writeAll(fd, sourcePath.data(), sourcePath.size()) &&
+      writePadding(fd, header.dataOffset - sizeof(header) - sourcePath.size());
+  for (int i = 0; isWritten && i < audioBus.getNumberOfChannels(); ++i) {
+    isWritten = writeAll(fd, audioBus.getChannel(i)->getData(), channelBytes) &&
+        writePadding(fd, header.channelStride - channelBytes);
+  }
+
+  isWritten = close(fd) == 0 && isWritten;
+  if (!isWritten || rename(temporaryPath.c_str(), entryPath.c_str()) != 0) {
+    unlink(temporaryPath.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+std::string DecodedAudioCache::getEntryPath(
+    const std::string &sourcePath,
+    float sampleRate) const {
+  // FNV-1a, the entry itself stores the full path in case of a collision
+  uint64_t hash = 14695981039346656037ULL;
+  auto mix = [&hash](uint8_t byte) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  };
+
+  for (auto character : sourcePath) {
+    mix(static_cast<uint8_t>(character));
+  }
+  auto sampleRateBits = std::bit_cast<uint32_t>(sampleRate);
+  for (int i = 0; i < 4; ++i) {
+    mix(static_cast<uint8_t>(sampleRateBits >> (8 * i)));
+  }
+
+  char name[24];
+  std::snprintf(
+      name, sizeof(name), "%016llx.pcm", static_cast<unsigned long long>(hash));
+  return directory_ + "/" + name;
+}
+
+} // namespace audioapi
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief On-disk cache of decoded audio files, one entry per source file and sample rate.
+/// @note An entry stores planar float32 samples and the modification time and size of its source,
+/// a changed source is decoded again and replaces the entry.
+/// @note Loaded buses are memory mapped, their channels point into the mapping, so loading costs
+/// almost no CPU and the OS decides which pages stay resident. The mapping is private,
+/// writes to the samples are never written back to the entry.
+/// @note Thread-safe, entries are written to a temporary file which is renamed over the old one.
+class DecodedAudioCache {
+ public:
+  explicit DecodedAudioCache(std::string directory);
+
+  [[nodiscard]] const std::string &getDirectory() const;
+
+  /// @brief Maps the entry of the source file decoded at the sample rate.
+  /// @return nullptr if there is no valid entry.
+  [[nodiscard]] std::shared_ptr<AudioBus> load(const std::string &sourcePath, float sampleRate) const;
+
+  /// @brief Stores the bus decoded from the source file.
+  /// @return false if the entry could not be written, e.g. the directory is not writable.
+  bool store(const std::string &sourcePath, const AudioBus &audioBus) const;
+
+ private:
+  std::string directory_;
+
+  [[nodiscard]] std::string getEntryPath(const std::string &sourcePath, float sampleRate) const;
+};
+
+} // namespace audioapi
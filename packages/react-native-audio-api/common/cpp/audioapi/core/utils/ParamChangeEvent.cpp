@@ -1,4 +1,9 @@
 #include <audioapi/core/utils/ParamChangeEvent.h>
+#include <audioapi/dsp/AudioUtils.h>
+#include <audioapi/dsp/VectorMath.h>
+
+#include <algorithm>
+#include <cmath>
 
 namespace audioapi {
 
@@ -7,13 +12,193 @@ ParamChangeEvent::ParamChangeEvent(
     double endTime,
     float startValue,
     float endValue,
-    std::function<float(double, double, float, float, double)> &&calculateValue,
     ParamChangeEventType type)
     : startTime_(startTime),
       endTime_(endTime),
-      calculateValue_(std::move(calculateValue)),
       startValue_(startValue),
       endValue_(endValue),
       type_(type) {}
 
+float ParamChangeEvent::getValueAtTime(double time) const {
+  if (time < startTime_) {
+    return startValue_;
+  }
+
+  switch (type_) {
+    case ParamChangeEventType::SET_VALUE:
+      return endValue_;
+
+    case ParamChangeEventType::LINEAR_RAMP:
+      if (time < endTime_) {
+        return static_cast<float>(
+            startValue_ +
+            (endValue_ - startValue_) * (time - startTime_) /
+                (endTime_ - startTime_));
+      }
+      return endValue_;
+
+    case ParamChangeEventType::EXPONENTIAL_RAMP:
+      if (time < endTime_) {
+        return static_cast<float>(
+            startValue_ *
+            pow(endValue_ / startValue_,
+                (time - startTime_) / (endTime_ - startTime_)));
+      }
+      return endValue_;
+
+    case ParamChangeEventType::SET_TARGET:
+      // SetTarget events have infinite duration conceptually
+      return static_cast<float>(
+          target_ +
+          (startValue_ - target_) * exp(-(time - startTime_) / timeConstant_));
+
+    case ParamChangeEventType::SET_VALUE_CURVE:
+      if (time < endTime_) {
+        return getCurveValueAtTime(time);
+      }
+      return endValue_;
+  }
+
+  return endValue_;
+}
+
+void ParamChangeEvent::getValuesAtTime(
+    double time,
+    double timeStep,
+    float *values,
+    size_t length) const {
+  // Frames before the event start hold the start value.
+  auto startFrame = getFirstFrameAtOrAfter(startTime_, time, timeStep, length);
+  dsp::fill(startValue_, values, startFrame);
+
+  if (startFrame == length) {
+    return;
+  }
+
+  // SetTarget never ends, other events hold the end value after the end time.
+  auto endFrame = type_ == ParamChangeEventType::SET_TARGET
+      ? length
+      : std::max(
+            startFrame,
+            getFirstFrameAtOrAfter(endTime_, time, timeStep, length));
+  auto firstTime = time + static_cast<double>(startFrame) * timeStep;
+  auto count = endFrame - startFrame;
+
+  switch (type_) {
+    case ParamChangeEventType::SET_VALUE:
+      break;
+
+    case ParamChangeEventType::LINEAR_RAMP: {
+      auto slope = (endValue_ - startValue_) / (endTime_ - startTime_);
+      dsp::linearRamp(
+          static_cast<float>(startValue_ + slope * (firstTime - startTime_)),
+          static_cast<float>(slope * timeStep),
+          values + startFrame,
+          count);
+      break;
+    }
+
+    case ParamChangeEventType::EXPONENTIAL_RAMP: {
+      // v(t + timeStep) = v(t) * ratio^(timeStep / duration), so every frame
+      // is a single multiplication, kept in double to avoid drift.
+      auto duration = endTime_ - startTime_;
+      auto ratio = static_cast<double>(endValue_) / startValue_;
+      auto value =
+          startValue_ * std::pow(ratio, (firstTime - startTime_) / duration);
+      auto multiplier = std::pow(ratio, timeStep / duration);
+
+      for (size_t i = startFrame; i < endFrame; i += 1) {
+        values[i] = static_cast<float>(value);
+        value *= multiplier;
+      }
+      break;
+    }
+
+    case ParamChangeEventType::SET_TARGET: {
+      // The distance to the target decays by a constant factor per frame.
+      auto distance = (startValue_ - target_) *
+          std::exp(-(firstTime - startTime_) / timeConstant_);
+      auto decay = std::exp(-timeStep / timeConstant_);
+
+      for (size_t i = startFrame; i < endFrame; i += 1) {
+        values[i] = static_cast<float>(target_ + distance);
+        distance *= decay;
+      }
+      break;
+    }
+
+    case ParamChangeEventType::SET_VALUE_CURVE:
+      for (size_t i = startFrame; i < endFrame; i += 1) {
+        values[i] = getCurveValueAtTime(
+            time + static_cast<double>(i) * timeStep);
+      }
+      break;
+  }
+
+  dsp::fill(endValue_, values + endFrame, length - endFrame);
+}
+
+bool ParamChangeEvent::isConstantBetween(double startTime, double endTime)
+    const {
+  // The whole range is before the event, so it holds the start value.
+  if (endTime < startTime_) {
+    return true;
+  }
+
+  switch (type_) {
+    case ParamChangeEventType::SET_VALUE:
+      return startTime >= startTime_;
+
+    case ParamChangeEventType::SET_TARGET:
+      return startValue_ == target_;
+
+    case ParamChangeEventType::LINEAR_RAMP:
+    case ParamChangeEventType::EXPONENTIAL_RAMP:
+    case ParamChangeEventType::SET_VALUE_CURVE:
+      return startTime >= endTime_;
+  }
+
+  return false;
+}
+
+size_t ParamChangeEvent::getFirstFrameAtOrAfter(
+    double boundary,
+    double time,
+    double timeStep,
+    size_t length) {
+  if (time >= boundary) {
+    return 0;
+  }
+
+  auto estimate = std::ceil((boundary - time) / timeStep);
+  auto frame = static_cast<size_t>(
+      std::min(estimate, static_cast<double>(length)));
+
+  while (frame > 0 &&
+         time + static_cast<double>(frame - 1) * timeStep >= boundary) {
+    frame -= 1;
+  }
+
+  while (frame < length &&
+         time + static_cast<double>(frame) * timeStep < boundary) {
+    frame += 1;
+  }
+
+  return frame;
+}
+
+float ParamChangeEvent::getCurveValueAtTime(double time) const {
+  // Calculate position in the array based on time progress
+  auto k = static_cast<size_t>(std::floor(
+      static_cast<double>(curveLength_ - 1) / (endTime_ - startTime_) *
+      (time - startTime_)));
+  // Calculate interpolation factor between adjacent array elements
+  auto factor = static_cast<float>(
+      (time - startTime_) * static_cast<double>(curveLength_ - 1) /
+          (endTime_ - startTime_) -
+      static_cast<double>(k));
+  return dsp::linearInterpolate(
+      curve_->data(), k, std::min(k + 1, curveLength_ - 1), factor);
+}
+
 } // namespace audioapi
@@ -2,9 +2,10 @@
 
 #include <audioapi/core/types/ParamChangeEventType.h>
 
-#include <functional>
+#include <cstddef>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace audioapi {
 
@@ -16,7 +17,6 @@ class ParamChangeEvent {
       double endTime,
       float startValue,
       float endValue,
-      std::function<float(double, double, float, float, double)> &&calculateValue,
       ParamChangeEventType type);
 
   ParamChangeEvent(const ParamChangeEvent &other) = delete;
@@ -25,18 +25,24 @@ class ParamChangeEvent {
   explicit ParamChangeEvent(ParamChangeEvent &&other) noexcept
     : startTime_(other.startTime_),
       endTime_(other.endTime_),
-      calculateValue_(std::move(other.calculateValue_)),
       startValue_(other.startValue_),
       endValue_(other.endValue_),
-      type_(other.type_) {}
+      type_(other.type_),
+      target_(other.target_),
+      timeConstant_(other.timeConstant_),
+      curve_(std::move(other.curve_)),
+      curveLength_(other.curveLength_) {}
   ParamChangeEvent& operator=(ParamChangeEvent &&other) noexcept {
     if (this != &other) {
       startTime_ = other.startTime_;
       endTime_ = other.endTime_;
-      calculateValue_ = std::move(other.calculateValue_);
       startValue_ = other.startValue_;
       endValue_ = other.endValue_;
       type_ = other.type_;
+      target_ = other.target_;
+      timeConstant_ = other.timeConstant_;
+      curve_ = std::move(other.curve_);
+      curveLength_ = other.curveLength_;
     }
     return *this;
   }
@@ -53,10 +59,6 @@ class ParamChangeEvent {
   [[nodiscard]] inline float getStartValue() const noexcept {
     return startValue_;
   }
-  [[nodiscard]] inline const std::function<float(double, double, float, float, double)>&
-  getCalculateValue() const noexcept {
-    return calculateValue_;
-  }
   [[nodiscard]] inline ParamChangeEventType getType() const noexcept {
     return type_;
   }
@@ -71,13 +73,52 @@ class ParamChangeEvent {
     endValue_ = endValue;
   }
 
+  /// @brief Sets the target and time constant of a SET_TARGET event.
+  inline void setTarget(float target, double timeConstant) noexcept {
+    target_ = target;
+    timeConstant_ = timeConstant;
+  }
+
+  /// @brief Sets the values of a SET_VALUE_CURVE event.
+  inline void setCurve(std::shared_ptr<std::vector<float>> curve, size_t length) noexcept {
+    curve_ = std::move(curve);
+    curveLength_ = length;
+  }
+
+  /// @brief Computes the automation value at the given time.
+  [[nodiscard]] float getValueAtTime(double time) const;
+
+  /// @brief Computes automation values of consecutive frames.
+  /// @param time Time of the first frame.
+  /// @param timeStep Time between two frames.
+  /// @param values Output, value of frame i is the value at time + i * timeStep.
+  /// @param length Number of frames to compute.
+  /// @note The whole range is computed in closed form by a kernel selected by the event type.
+  void getValuesAtTime(double time, double timeStep, float *values, size_t length) const;
+
+  /// @brief Checks if the event yields a single value for every time in [startTime, endTime].
+  [[nodiscard]] bool isConstantBetween(double startTime, double endTime) const;
+
+  /// @brief Returns the index of the first frame at or after the boundary.
+  /// @note Rounding is corrected, so the index is exact for time + index * timeStep.
+  static size_t getFirstFrameAtOrAfter(double boundary, double time, double timeStep, size_t length);
+
  private:
   double startTime_;
   double endTime_;
-  std::function<float(double, double, float, float, double)> calculateValue_;
   float startValue_;
   float endValue_;
   ParamChangeEventType type_;
+
+  // SET_TARGET only
+  float target_ = 0.0f;
+  double timeConstant_ = 0.0;
+
+  // SET_VALUE_CURVE only
+  std::shared_ptr<std::vector<float>> curve_;
+  size_t curveLength_ = 0;
+
+  [[nodiscard]] float getCurveValueAtTime(double time) const;
 };
 
 } // namespace audioapi
@@ -0,0 +1,515 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/Biquad.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#if defined(HAVE_X86_SSE2)
+#include <emmintrin.h>
+#elif defined(HAVE_ARM_NEON_INTRINSICS) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BIQUAD_NEON 1
+#endif
+
+// Transposed direct form II:
+//   y[n]  = b0 * x[n] + s1[n-1]
+//   s1[n] = b1 * x[n] - a1 * y[n] + s2[n-1]
+//   s2[n] = b2 * x[n] - a2 * y[n]
+
+namespace audioapi::dsp {
+
+namespace {
+
+#if defined(HAVE_X86_SSE2) || defined(BIQUAD_NEON)
+constexpr int LANES = 4;
+#else
+constexpr int LANES = 1;
+#endif
+
+#if defined(HAVE_X86_SSE2)
+using Vector = __m128;
+
+inline Vector load(const float *data) {
+  return _mm_loadu_ps(data);
+}
+inline void store(float *data, Vector v) {
+  _mm_storeu_ps(data, v);
+}
+inline Vector broadcast(float value) {
+  return _mm_set1_ps(value);
+}
+inline Vector zero() {
+  return _mm_setzero_ps();
+}
+inline Vector add(Vector a, Vector b) {
+  return _mm_add_ps(a, b);
+}
+inline Vector subtract(Vector a, Vector b) {
+  return _mm_sub_ps(a, b);
+}
+inline Vector multiply(Vector a, Vector b) {
+  return _mm_mul_ps(a, b);
+}
+inline void transpose(Vector &r0, Vector &r1, Vector &r2, Vector &r3) {
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+#elif defined(BIQUAD_NEON)
+using Vector = float32x4_t;
+
+inline Vector load(const float *data) {
+  return vld1q_f32(data);
+}
+inline void store(float *data, Vector v) {
+  vst1q_f32(data, v);
+}
+inline Vector broadcast(float value) {
+  return vdupq_n_f32(value);
+}
+inline Vector zero() {
+  return vdupq_n_f32(0.0f);
+}
+inline Vector add(Vector a, Vector b) {
+  return vaddq_f32(a, b);
+}
+inline Vector subtract(Vector a, Vector b) {
+  return vsubq_f32(a, b);
+}
+inline Vector multiply(Vector a, Vector b) {
+  return vmulq_f32(a, b);
+}
+inline void transpose(Vector &r0, Vector &r1, Vector &r2, Vector &r3) {
+  float32x4x2_t t01 = vtrnq_f32(r0, r1);
+  float32x4x2_t t23 = vtrnq_f32(r2, r3);
+  r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+  r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+  r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+  r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+#endif
+
+// https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html - math
+// formulas for filters
+
+BiquadCoefficients
+normalize(float b0, float b1, float b2, float a0, float a1, float a2) {
+  auto a0Inverted = 1.0f / a0;
+  return {
+      b0 * a0Inverted,
+      b1 * a0Inverted,
+      b2 * a0Inverted,
+      a1 * a0Inverted,
+      a2 * a0Inverted};
+}
+
+BiquadCoefficients getLowpassCoefficients(float frequency, float Q) {
+  // Limit frequency to [0, 1] range
+  if (frequency >= 1.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  if (frequency <= 0.0) {
+    return normalize(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  Q = std::max(0.0f, Q);
+  float g = std::pow(10.0f, 0.05f * Q);
+
+  float theta = PI * frequency;
+  float alpha = std::sin(theta) / (2 * g);
+  float cosW = std::cos(theta);
+  float beta = (1 - cosW) / 2;
+
+  return normalize(beta, 2 * beta, beta, 1 + alpha, -2 * cosW, 1 - alpha);
+}
+
+BiquadCoefficients getHighpassCoefficients(float frequency, float Q) {
+  if (frequency >= 1.0) {
+    return normalize(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+  if (frequency <= 0.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  Q = std::max(0.0f, Q);
+  float g = std::pow(10.0f, 0.05f * Q);
+
+  float theta = PI * frequency;
+  float alpha = std::sin(theta) / (2 * g);
+  float cosW = std::cos(theta);
+  float beta = (1 + cosW) / 2;
+
+  return normalize(beta, -2 * beta, beta, 1 + alpha, -2 * cosW, 1 - alpha);
+}
+
+BiquadCoefficients getBandpassCoefficients(float frequency, float Q) {
+  // Limit frequency to [0, 1] range
+  if (frequency <= 0.0 || frequency >= 1.0) {
+    return normalize(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  // Limit Q to positive values
+  if (Q <= 0.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  float w0 = PI * frequency;
+  float alpha = std::sin(w0) / (2 * Q);
+  float cosW = std::cos(w0);
+
+  return normalize(alpha, 0.0f, -alpha, 1.0f + alpha, -2 * cosW, 1.0f - alpha);
+}
+
+BiquadCoefficients getLowshelfCoefficients(float frequency, float gain) {
+  float A = std::pow(10.0f, gain / 40.0f);
+
+  if (frequency >= 1.0) {
+    return normalize(A * A, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  if (frequency <= 0.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  float w0 = PI * frequency;
+  float alpha = 0.5f * std::sin(w0) * std::sqrt(2.0f);
+  float cosW = std::cos(w0);
+  float gamma = 2.0f * std::sqrt(A) * alpha;
+
+  return normalize(
+      A * (A + 1 - (A - 1) * cosW + gamma),
+      2.0f * A * (A - 1 - (A + 1) * cosW),
+      A * (A + 1 - (A - 1) * cosW - gamma),
+      A + 1 + (A - 1) * cosW + gamma,
+      -2.0f * (A - 1 + (A + 1) * cosW),
+      A + 1 + (A - 1) * cosW - gamma);
+}
+
+BiquadCoefficients getHighshelfCoefficients(float frequency, float gain) {
+  float A = std::pow(10.0f, gain / 40.0f);
+
+  if (frequency >= 1.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  if (frequency <= 0.0) {
+    return normalize(A * A, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  float w0 = PI * frequency;
+  // In the original formula: sqrt((A + 1/A) * (1/S - 1) + 2), but we assume
+  // the maximum value S = 1, so it becomes 0 + 2 under the square root
+  float alpha = 0.5f * std::sin(w0) * std::sqrt(2.0f);
+  float cosW = std::cos(w0);
+  float gamma = 2.0f * std::sqrt(A) * alpha;
+
+  return normalize(
+      A * (A + 1 + (A - 1) * cosW + gamma),
+      -2.0f * A * (A - 1 + (A + 1) * cosW),
+      A * (A + 1 + (A - 1) * cosW - gamma),
+      A + 1 - (A - 1) * cosW + gamma,
+      2.0f * (A - 1 - (A + 1) * cosW),
+      A + 1 - (A - 1) * cosW - gamma);
+}
+
+BiquadCoefficients
+getPeakingCoefficients(float frequency, float Q, float gain) {
+  float A = std::pow(10.0f, gain / 40.0f);
+
+  if (frequency <= 0.0 || frequency >= 1.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  if (Q <= 0.0) {
+    return normalize(A * A, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  float w0 = PI * frequency;
+  float alpha = std::sin(w0) / (2 * Q);
+  float cosW = std::cos(w0);
+
+  return normalize(
+      1 + alpha * A,
+      -2 * cosW,
+      1 - alpha * A,
+      1 + alpha / A,
+      -2 * cosW,
+      1 - alpha / A);
+}
+
+BiquadCoefficients getNotchCoefficients(float frequency, float Q) {
+  if (frequency <= 0.0 || frequency >= 1.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  if (Q <= 0.0) {
+    return normalize(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  float w0 = PI * frequency;
+  float alpha = std::sin(w0) / (2 * Q);
+  float cosW = std::cos(w0);
+
+  return normalize(1.0f, -2 * cosW, 1.0f, 1 + alpha, -2 * cosW, 1 - alpha);
+}
+
+BiquadCoefficients getAllpassCoefficients(float frequency, float Q) {
+  if (frequency <= 0.0 || frequency >= 1.0) {
+    return normalize(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  if (Q <= 0.0) {
+    return normalize(-1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+  }
+
+  float w0 = PI * frequency;
+  float alpha = std::sin(w0) / (2 * Q);
+  float cosW = std::cos(w0);
+
+  return normalize(
+      1 - alpha, -2 * cosW, 1 + alpha, 1 + alpha, -2 * cosW, 1 - alpha);
+}
+
+} // namespace
+
+BiquadCoefficients BiquadCoefficients::design(
+    BiquadFilterType type,
+    float frequency,
+    float Q,
+    float gain) {
+  switch (type) {
+    case BiquadFilterType::LOWPASS:
+      return getLowpassCoefficients(frequency, Q);
+    case BiquadFilterType::HIGHPASS:
+      return getHighpassCoefficients(frequency, Q);
+    case BiquadFilterType::BANDPASS:
+      return getBandpassCoefficients(frequency, Q);
+    case BiquadFilterType::LOWSHELF:
+      return getLowshelfCoefficients(frequency, gain);
+    case BiquadFilterType::HIGHSHELF:
+      return getHighshelfCoefficients(frequency, gain);
+    case BiquadFilterType::PEAKING:
+      return getPeakingCoefficients(frequency, Q, gain);
+    case BiquadFilterType::NOTCH:
+      return getNotchCoefficients(frequency, Q);
+    case BiquadFilterType::ALLPASS:
+      return getAllpassCoefficients(frequency, Q);
+    default:
+      return {};
+  }
+}
+
+// Compute Z-transform of the filter
+// https://www.dsprelated.com/freebooks/filters/Frequency_Response_Analysis.html
+//
+//         b0 + (b1 + b2 * z1) * z1
+//  H(z) = --------------------------
+//         (1 + (a1 + a2 * z1) * z1
+//
+// where z1 = 1/z and z = e^(j * pi * frequency)
+std::complex<float> BiquadCoefficients::getResponse(float frequency) const {
+  auto omega = -PI * frequency;
+  auto z = std::complex<float>(std::cos(omega), std::sin(omega));
+  return (b0 + (b1 + b2 * z) * z) /
+      (std::complex<float>(1, 0) + (a1 + a2 * z) * z);
+}
+
+Biquad::Biquad(int maxNumberOfChannels, int numberOfSections)
+    : coefficients_(numberOfSections),
+      maxNumberOfChannels_(maxNumberOfChannels),
+      stateStride_((maxNumberOfChannels + LANES - 1) / LANES * LANES),
+      s1_(static_cast<size_t>(stateStride_) * numberOfSections, 0.0f),
+      s2_(static_cast<size_t>(stateStride_) * numberOfSections, 0.0f) {}
+
+void Biquad::process(
+    float *const *channels,
+    int numberOfChannels,
+    size_t framesToProcess) {
+  assert(numberOfChannels <= maxNumberOfChannels_);
+  numberOfChannels = std::min(numberOfChannels, maxNumberOfChannels_);
+
+  int channel = 0;
+
+  // A single channel is a serial recurrence, so it is left to the scalar loop.
+  if (LANES > 1) {
+    for (; channel + 1 < numberOfChannels; channel += LANES) {
+      processChannelGroup(
+          channels,
+          channel,
+          std::min(LANES, numberOfChannels - channel),
+          framesToProcess);
+    }
+  }
+
+  for (; channel < numberOfChannels; ++channel) {
+    processChannel(channels[channel], channel, framesToProcess);
+  }
+}
+
+void Biquad::reset() {
+  std::fill(s1_.begin(), s1_.end(), 0.0f);
+  std::fill(s2_.begin(), s2_.end(), 0.0f);
+}
+
+void Biquad::processRamped(
+    float *const *channels,
+    int numberOfChannels,
+    size_t framesToProcess,
+    const BiquadCoefficients *targets) {
+  assert(numberOfChannels <= maxNumberOfChannels_);
+  numberOfChannels = std::min(numberOfChannels, maxNumberOfChannels_);
+
+  if (framesToProcess == 0) {
+    return;
+  }
+
+  auto step = 1.0f / static_cast<float>(framesToProcess);
+
+  for (int section = 0; section < getNumberOfSections(); ++section) {
+    const auto &from = coefficients_[section];
+    const auto &to = targets[section];
+    BiquadCoefficients delta = {
+        (to.b0 - from.b0) * step,
+        (to.b1 - from.b1) * step,
+        (to.b2 - from.b2) * step,
+        (to.a1 - from.a1) * step,
+        (to.a2 - from.a2) * step};
+
+    for (int channel = 0; channel < numberOfChannels; ++channel) {
+      float *data = channels[channel];
+      float &s1 = s1_[section * stateStride_ + channel];
+      float &s2 = s2_[section * stateStride_ + channel];
+
+      float z1 = s1;
+      float z2 = s2;
+
+      // The coefficients of frame i are computed from the start of the block
+      // rather than accumulated, so rounding errors do not build up.
+      for (size_t i = 0; i < framesToProcess; ++i) {
+        auto t = static_cast<float>(i + 1);
+        float b0 = from.b0 + delta.b0 * t;
+        float b1 = from.b1 + delta.b1 * t;
+        float b2 = from.b2 + delta.b2 * t;
+        float a1 = from.a1 + delta.a1 * t;
+        float a2 = from.a2 + delta.a2 * t;
+
+        float input = data[i];
+        float output = b0 * input + z1;
+
+        z1 = b1 * input - a1 * output + z2;
+        z2 = b2 * input - a2 * output;
+
+        data[i] = output;
+      }
+
+      s1 = z1;
+      s2 = z2;
+    }
+  }
+
+  for (int section = 0; section < getNumberOfSections(); ++section) {
+    coefficients_[section] = targets[section];
+  }
+}
+
+void Biquad::processChannel(float *data, int channel, size_t framesToProcess) {
+  // Section by section, the recurrence is serial anyway and the data stays in
+  // the cache between the sections.
+  for (int section = 0; section < getNumberOfSections(); ++section) {
+    // local copies for micro-optimization
+    auto [b0, b1, b2, a1, a2] = coefficients_[section];
+    float &s1 = s1_[section * stateStride_ + channel];
+    float &s2 = s2_[section * stateStride_ + channel];
+
+    float z1 = s1;
+    float z2 = s2;
+
+    for (size_t i = 0; i < framesToProcess; ++i) {
+      float input = data[i];
+      float output = b0 * input + z1;
+
+      z1 = b1 * input - a1 * output + z2;
+      z2 = b2 * input - a2 * output;
+
+      data[i] = output;
+    }
+
+    s1 = z1;
+    s2 = z2;
+  }
+}
+
+void Biquad::processChannelGroup(
+    float *const *channels,
+    int firstChannel,
+    int numberOfChannels,
+    size_t framesToProcess) {
+#if defined(HAVE_X86_SSE2) || defined(BIQUAD_NEON)
+  // Each lane holds one channel. Blocks of 4 frames are loaded per channel and
+  // transposed, so every vector holds the same frame of 4 channels. The block
+  // passes through all sections before it is written back.
+  // Missing channels of a partial group are filtered as silence.
+  float *const *group = channels + firstChannel;
+
+  size_t i = 0;
+  for (; i + LANES <= framesToProcess; i += LANES) {
+    Vector r0 = load(group[0] + i);
+    Vector r1 = load(group[1] + i);
+    Vector r2 = numberOfChannels > 2 ? load(group[2] + i) : zero();
+    Vector r3 = numberOfChannels > 3 ? load(group[3] + i) : zero();
+
+    transpose(r0, r1, r2, r3);
+
+    for (int section = 0; section < getNumberOfSections(); ++section) {
+      const auto &coefficients = coefficients_[section];
+      Vector b0 = broadcast(coefficients.b0);
+      Vector b1 = broadcast(coefficients.b1);
+      Vector b2 = broadcast(coefficients.b2);
+      Vector a1 = broadcast(coefficients.a1);
+      Vector a2 = broadcast(coefficients.a2);
+
+      float *s1 = &s1_[section * stateStride_ + firstChannel];
+      float *s2 = &s2_[section * stateStride_ + firstChannel];
+      Vector z1 = load(s1);
+      Vector z2 = load(s2);
+
+      auto tick = [&](Vector input) {
+        Vector output = add(multiply(b0, input), z1);
+        z1 = add(subtract(multiply(b1, input), multiply(a1, output)), z2);
+        z2 = subtract(multiply(b2, input), multiply(a2, output));
+        return output;
+      };
+
+      r0 = tick(r0);
+      r1 = tick(r1);
+      r2 = tick(r2);
+      r3 = tick(r3);
+
+      store(s1, z1);
+      store(s2, z2);
+    }
+
+    transpose(r0, r1, r2, r3);
+
+    store(group[0] + i, r0);
+    store(group[1] + i, r1);
+    if (numberOfChannels > 2) {
+      store(group[2] + i, r2);
+    }
+    if (numberOfChannels > 3) {
+      store(group[3] + i, r3);
+    }
+  }
+
+  for (int lane = 0; lane < numberOfChannels; ++lane) {
+    processChannel(group[lane] + i, firstChannel + lane, framesToProcess - i);
+  }
+#else
+  for (int lane = 0; lane < numberOfChannels; ++lane) {
+    processChannel(
+        channels[firstChannel + lane], firstChannel + lane, framesToProcess);
+  }
+#endif
+}
+
+} // namespace audioapi::dsp
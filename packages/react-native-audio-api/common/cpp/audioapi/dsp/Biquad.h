@@ -0,0 +1,76 @@
+#pragma once
+
+#include <audioapi/core/types/BiquadFilterType.h>
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace audioapi::dsp {
+
+// Normalized coefficients (a0 == 1) of a second order section.
+//          b0 + b1 * z^(-1) + b2 * z^(-2)
+//  H(z) = -------------------------------
+//           1 + a1 * z^(-1) + a2 * z^(-2)
+struct BiquadCoefficients {
+  float b0 = 1.0f;
+  float b1 = 0.0f;
+  float b2 = 0.0f;
+  float a1 = 0.0f;
+  float a2 = 0.0f;
+
+  // https://webaudio.github.io/Audio-EQ-Cookbook/audio-eq-cookbook.html
+  // frequency is normalized to the Nyquist frequency, Q and gain follow the BiquadFilterNode semantics.
+  static BiquadCoefficients design(BiquadFilterType type, float frequency, float Q, float gain);
+
+  // H(z) evaluated at z = e^(j * pi * frequency), frequency is normalized to the Nyquist frequency.
+  [[nodiscard]] std::complex<float> getResponse(float frequency) const;
+};
+
+// Cascade of second order IIR sections in transposed direct form II, shared by the filter nodes.
+// Every channel keeps its own two state variables per section, stored structure-of-arrays,
+// so groups of 4 channels are filtered at once with SSE2/NEON.
+// All sections are applied in a single pass, samples stay in registers between the sections.
+class Biquad {
+ public:
+  explicit Biquad(int maxNumberOfChannels, int numberOfSections = 1);
+
+  void setCoefficients(const BiquadCoefficients &coefficients, int section = 0) {
+    coefficients_[section] = coefficients;
+  }
+
+  [[nodiscard]] const BiquadCoefficients &getCoefficients(int section = 0) const {
+    return coefficients_[section];
+  }
+
+  [[nodiscard]] int getNumberOfSections() const {
+    return static_cast<int>(coefficients_.size());
+  }
+
+  // Filters every channel in place, numberOfChannels can not exceed maxNumberOfChannels.
+  void process(float *const *channels, int numberOfChannels, size_t framesToProcess);
+  // Like process, but the coefficients of every section move linearly from the current ones to targets[section]
+  // over the block and are left at the targets. Any point between two stable sections is stable too.
+  void processRamped(
+      float *const *channels,
+      int numberOfChannels,
+      size_t framesToProcess,
+      const BiquadCoefficients *targets);
+  // Clears the state of all channels.
+  void reset();
+
+ private:
+  std::vector<BiquadCoefficients> coefficients_;
+  int maxNumberOfChannels_;
+  // number of channels rounded up to a whole group of 4
+  int stateStride_;
+
+  // state of every channel, indexed by section * stateStride_ + channel
+  std::vector<float> s1_;
+  std::vector<float> s2_;
+
+  void processChannel(float *data, int channel, size_t framesToProcess);
+  void processChannelGroup(float *const *channels, int firstChannel, int numberOfChannels, size_t framesToProcess);
+};
+
+} // namespace audioapi::dsp
@@ -0,0 +1,390 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/Convolver.h>
+#include <audioapi/dsp/FFT.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/utils/AudioArray.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace audioapi::dsp {
+
+// Uniformly partitioned overlap-save convolution of one input with the part of
+// the impulse response starting at offset.
+// Every block of partitionSize input frames is transformed once and kept in a
+// frequency domain delay line, the output block is the sum of the delayed
+// spectra multiplied by the partition spectra.
+class Convolver::Stage {
+ public:
+  Stage(
+      const float *impulseResponse,
+      size_t impulseResponseLength,
+      float gain,
+      size_t offset,
+      size_t partitionSize,
+      size_t numberOfPartitions,
+      bool runsInBackground)
+      : partitionSize_(partitionSize),
+        numberOfPartitions_(numberOfPartitions),
+        runsInBackground_(runsInBackground),
+        fft_(static_cast<int>(2 * partitionSize)),
+        partitions_(numberOfPartitions * 2 * partitionSize),
+        inputSpectra_(numberOfPartitions * 2 * partitionSize),
+        timeBuffer_(2 * partitionSize),
+        accumulator_(2 * partitionSize),
+        outputRing_(std::bit_ceil(
+            offset + partitionSize + CONVOLVER_HEAD_PARTITION_SIZE)),
+        outputEnd_(offset + CONVOLVER_HEAD_PARTITION_SIZE) {
+    auto fftSize = 2 * partitionSize_;
+    // the inverse transform is not scaled, so the scale is folded into the
+    // partitions
+    auto scale = gain / static_cast<float>(fftSize);
+
+    for (size_t i = 0; i < numberOfPartitions_; ++i) {
+      auto start = offset + i * partitionSize_;
+      auto length = std::min(partitionSize_, impulseResponseLength - start);
+      auto *partition = partitions_.getData() + i * fftSize;
+
+      timeBuffer_.zero();
+      std::memcpy(
+          timeBuffer_.getData(),
+          impulseResponse + start,
+          length * sizeof(float));
+      fft_.doFFTUnordered(timeBuffer_.getData(), partition);
+      multiplyByScalar(partition, scale, partition, fftSize);
+    }
+
+    timeBuffer_.zero();
+  }
+
+  [[nodiscard]] size_t getPartitionSize() const {
+    return partitionSize_;
+  }
+
+  [[nodiscard]] bool runsInBackground() const {
+    return runsInBackground_;
+  }
+
+  // first input frame of the next block
+  [[nodiscard]] size_t getProcessedFrames() const {
+    return processedFrames_;
+  }
+
+  [[nodiscard]] bool isOutputReady(size_t frame, size_t frames) const {
+    return outputEnd_.load(std::memory_order_acquire) >= frame + frames;
+  }
+
+  // A background stage is processed by whichever thread holds it, the
+  // background thread or the audio thread catching up with a late block.
+  bool tryAcquire() {
+    return !isAcquired_.exchange(true, std::memory_order_acquire);
+  }
+
+  void release() {
+    isAcquired_.store(false, std::memory_order_release);
+  }
+
+  // Copies the next input block from the ring, the previous one is kept as
+  // the first half of the transformed frame.
+  void loadInput(const float *inputRing, size_t inputRingSize) {
+    auto *time = timeBuffer_.getData();
+    std::memcpy(time, time + partitionSize_, partitionSize_ * sizeof(float));
+    std::memcpy(
+        time + partitionSize_,
+        inputRing + (processedFrames_ & (inputRingSize - 1)),
+        partitionSize_ * sizeof(float));
+  }
+
+  // Replaces the loaded input block with silence.
+  void discardInput() {
+    timeBuffer_.zero(partitionSize_, partitionSize_);
+  }
+
+  void processBlock() {
+    auto fftSize = 2 * partitionSize_;
+    auto *accumulator = accumulator_.getData();
+    auto *newestSpectrum =
+        inputSpectra_.getData() + inputSpectraPosition_ * fftSize;
+
+    fft_.doFFTUnordered(timeBuffer_.getData(), newestSpectrum);
+
+    accumulator_.zero();
+    for (size_t i = 0; i < numberOfPartitions_; ++i) {
+      // i-th partition meets the input from i blocks ago
+      auto delayed = (inputSpectraPosition_ + numberOfPartitions_ - i) %
+          numberOfPartitions_;
+      fft_.convolveAccumulate(
+          inputSpectra_.getData() + delayed * fftSize,
+          partitions_.getData() + i * fftSize,
+          accumulator,
+          1.0f);
+    }
+
+    fft_.doInverseFFTUnordered(accumulator, accumulator);
+
+    // second half of the frame is free of circular aliasing
+    auto outputEnd = outputEnd_.load(std::memory_order_relaxed);
+    auto outputRingSize = outputRing_.getSize();
+    auto position = outputEnd & (outputRingSize - 1);
+    auto firstPart = std::min(partitionSize_, outputRingSize - position);
+    std::memcpy(
+        outputRing_.getData() + position,
+        accumulator + partitionSize_,
+        firstPart * sizeof(float));
+    std::memcpy(
+        outputRing_.getData(),
+        accumulator + partitionSize_ + firstPart,
+        (partitionSize_ - firstPart) * sizeof(float));
+
+    inputSpectraPosition_ = (inputSpectraPosition_ + 1) % numberOfPartitions_;
+    processedFrames_ += partitionSize_;
+    outputEnd_.store(outputEnd + partitionSize_, std::memory_order_release);
+  }
+
+  // Adds the output of frames [frame, frame + frames) if it is ready.
+  void addOutput(float *output, size_t frame, size_t frames) const {
+    if (!isOutputReady(frame, frames)) {
+      return;
+    }
+
+    add(output,
+        outputRing_.getData() + (frame & (outputRing_.getSize() - 1)),
+        output,
+        frames);
+  }
+
+ private:
+  size_t partitionSize_;
+  size_t numberOfPartitions_;
+  bool runsInBackground_;
+
+  FFT fft_;
+  // spectra of the impulse response partitions
+  AudioArray partitions_;
+  // spectra of the last numberOfPartitions input blocks
+  AudioArray inputSpectra_;
+  size_t inputSpectraPosition_ = 0;
+  // previous and current input block
+  AudioArray timeBuffer_;
+  AudioArray accumulator_;
+
+  size_t processedFrames_ = 0;
+  // output is written as whole blocks, outputEnd_ is the end of the last one
+  AudioArray outputRing_;
+  std::atomic<size_t> outputEnd_;
+
+  std::atomic<bool> isAcquired_{false};
+};
+
+Convolver::Convolver(
+    const std::vector<Path> &paths,
+    size_t impulseResponseLength,
+    float gain,
+    bool runTailInBackground)
+    : impulseResponseLength_(impulseResponseLength) {
+  size_t largestPartitionSize = CONVOLVER_HEAD_PARTITION_SIZE;
+
+  paths_.reserve(paths.size());
+  for (const auto &path : paths) {
+    PathState state{path.input, path.output, nullptr, {}};
+
+    // [0, 4 * head) is covered by the head partitions, then every stage covers
+    // two partitions twice as large as the previous one, up to the maximal
+    // partition size which covers the rest.
+    size_t offset = 0;
+    size_t partitionSize = CONVOLVER_HEAD_PARTITION_SIZE;
+    size_t numberOfPartitions = 4;
+
+    while (offset < impulseResponseLength_) {
+      auto remainingPartitions =
+          (impulseResponseLength_ - offset + partitionSize - 1) / partitionSize;
+      auto stagePartitions = partitionSize == CONVOLVER_MAX_PARTITION_SIZE
+          ? remainingPartitions
+          : std::min(numberOfPartitions, remainingPartitions);
+      auto runsInBackground = runTailInBackground &&
+          partitionSize >= CONVOLVER_BACKGROUND_PARTITION_SIZE;
+
+      state.stages.push_back(std::make_unique<Stage>(
+          path.impulseResponse,
+          impulseResponseLength_,
+          gain,
+          offset,
+          partitionSize,
+          stagePartitions,
+          runsInBackground));
+
+      if (runsInBackground && backgroundPartitionSize_ == 0) {
+        backgroundPartitionSize_ = partitionSize;
+      }
+      largestPartitionSize = std::max(largestPartitionSize, partitionSize);
+
+      offset += stagePartitions * partitionSize;
+      partitionSize = std::min(2 * partitionSize, CONVOLVER_MAX_PARTITION_SIZE);
+      numberOfPartitions = 2;
+    }
+
+    paths_.push_back(std::move(state));
+  }
+
+  // leaves the background thread a few partitions of headroom before the
+  // audio thread overwrites the input it has not read yet
+  inputRingSize_ = std::bit_ceil(4 * largestPartitionSize);
+  for (auto &path : paths_) {
+    path.inputRing = std::make_unique<AudioArray>(inputRingSize_);
+  }
+
+  if (backgroundPartitionSize_ != 0) {
+    backgroundThread_ = std::thread(&Convolver::backgroundThreadFunc, this);
+  }
+}
+
+Convolver::~Convolver() {
+  if (backgroundThread_.joinable()) {
+    isRunning_.store(false, std::memory_order_release);
+    epoch_.fetch_add(1, std::memory_order_release);
+    epoch_.notify_one();
+    backgroundThread_.join();
+  }
+}
+
+void Convolver::process(
+    const float *const *inputs,
+    float *const *outputs,
+    int numberOfOutputs,
+    size_t framesToProcess) {
+  size_t processedFrames = 0;
+
+  // Chunks never cross a head partition boundary, so every stage that has a
+  // full block by the end of a chunk is processed right away.
+  while (processedFrames < framesToProcess) {
+    auto framesToCopy = std::min(
+        framesToProcess - processedFrames,
+        CONVOLVER_HEAD_PARTITION_SIZE -
+            framesWritten_ % CONVOLVER_HEAD_PARTITION_SIZE);
+    auto position = framesWritten_ & (inputRingSize_ - 1);
+
+    for (auto &path : paths_) {
+      std::memcpy(
+          path.inputRing->getData() + position,
+          inputs[path.input] + processedFrames,
+          framesToCopy * sizeof(float));
+    }
+
+    for (int i = 0; i < numberOfOutputs; ++i) {
+      std::fill_n(outputs[i] + processedFrames, framesToCopy, 0.0f);
+    }
+
+    for (auto &path : paths_) {
+      for (auto &stage : path.stages) {
+        if (stage->runsInBackground() &&
+            !stage->isOutputReady(framesWritten_, framesToCopy)) {
+          catchUpStage(path, *stage);
+        }
+
+        stage->addOutput(
+            outputs[path.output] + processedFrames,
+            framesWritten_,
+            framesToCopy);
+      }
+    }
+
+    framesWritten_ += framesToCopy;
+    processedFrames += framesToCopy;
+
+    if (framesWritten_ % CONVOLVER_HEAD_PARTITION_SIZE != 0) {
+      continue;
+    }
+
+    processStages(framesWritten_, false);
+
+    if (backgroundPartitionSize_ != 0) {
+      publishedFramesWritten_.store(framesWritten_, std::memory_order_release);
+
+      // wake up only when there is a new block for the smallest background
+      // stage, larger ones can have new blocks only at the same moments
+      if (framesWritten_ % backgroundPartitionSize_ == 0) {
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_one();
+      }
+    }
+  }
+}
+
+void Convolver::catchUpStage(PathState &path, Stage &stage) {
+  // The background thread is in the middle of the block, its output is lost.
+  if (!stage.tryAcquire()) {
+    numberOfLateBlocks_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // Input of every block due by now is already in the ring, as a stage
+  // starts two partitions into the impulse response.
+  while (stage.getProcessedFrames() + stage.getPartitionSize() <=
+         framesWritten_) {
+    stage.loadInput(path.inputRing->getData(), inputRingSize_);
+    stage.processBlock();
+  }
+
+  stage.release();
+}
+
+void Convolver::processStages(size_t framesWritten, bool background) {
+  for (auto &path : paths_) {
+    for (auto &stage : path.stages) {
+      if (stage->runsInBackground() != background) {
+        continue;
+      }
+
+      if (background && !stage->tryAcquire()) {
+        // the audio thread is catching up with it
+        continue;
+      }
+
+      while (stage->getProcessedFrames() + stage->getPartitionSize() <=
+             framesWritten) {
+        stage->loadInput(path.inputRing->getData(), inputRingSize_);
+
+        // The audio thread overwrites the ring, a background stage that fell a
+        // whole ring behind gets silence instead of a torn block.
+        if (background &&
+            publishedFramesWritten_.load(std::memory_order_acquire) +
+                    CONVOLVER_HEAD_PARTITION_SIZE >
+                stage->getProcessedFrames() + inputRingSize_) {
+          stage->discardInput();
+        }
+
+        stage->processBlock();
+      }
+
+      if (background) {
+        stage->release();
+      }
+    }
+  }
+}
+
+void Convolver::backgroundThreadFunc() {
+#if defined(__APPLE__)
+  pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+#endif
+
+  uint32_t seenEpoch = 0;
+  while (true) {
+    epoch_.wait(seenEpoch, std::memory_order_acquire);
+    seenEpoch = epoch_.load(std::memory_order_acquire);
+
+    if (!isRunning_.load(std::memory_order_acquire)) [[unlikely]] {
+      break;
+    }
+
+    processStages(
+        publishedFramesWritten_.load(std::memory_order_acquire), true);
+  }
+}
+
+} // namespace audioapi::dsp
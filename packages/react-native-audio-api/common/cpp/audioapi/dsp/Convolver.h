@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace audioapi {
+class AudioArray;
+} // namespace audioapi
+
+namespace audioapi::dsp {
+
+// Non-uniformly partitioned FFT convolution (overlap-save) of several inputs with several impulse responses.
+// The impulse response is split into stages of growing partition size, each stage is uniformly partitioned:
+//   [0, 512) in partitions of 128, then [512, 1024) in partitions of 256, [1024, 2048) of 512 and so on,
+//   up to CONVOLVER_MAX_PARTITION_SIZE which covers the rest of the impulse response.
+// Spectra of all partitions are computed once, in the constructor.
+// Small stages are processed on the calling (audio) thread, stages with partitions of at least
+// CONVOLVER_BACKGROUND_PARTITION_SIZE frames on a background thread. A stage starts twice its partition size
+// into the impulse response, so the background thread has one partition worth of time to deliver a block.
+// A block that is late anyway is processed by process() itself, unless the background thread is working on it.
+// Output is delayed by CONVOLVER_HEAD_PARTITION_SIZE frames, which makes any block size valid for process().
+class Convolver {
+ public:
+  // input is convolved with impulseResponse and summed into output.
+  struct Path {
+    int input;
+    int output;
+    const float *impulseResponse;
+  };
+
+  // Impulse responses are copied, every one of them is impulseResponseLength frames long and scaled by gain.
+  // With runTailInBackground == false every stage is processed by process() itself, which keeps offline rendering deterministic.
+  Convolver(const std::vector<Path> &paths, size_t impulseResponseLength, float gain, bool runTailInBackground);
+  ~Convolver();
+
+  Convolver(const Convolver &) = delete;
+  Convolver &operator=(const Convolver &) = delete;
+
+  [[nodiscard]] size_t getImpulseResponseLength() const {
+    return impulseResponseLength_;
+  }
+
+  // Times process() found a background stage late while the background thread was still working on it,
+  // the output of the stage is missing for those frames.
+  [[nodiscard]] size_t getNumberOfLateBlocks() const {
+    return numberOfLateBlocks_.load(std::memory_order_relaxed);
+  }
+
+  // Inputs are consumed before anything is written to outputs, so they can point to the same channels.
+  // Every output is overwritten, also the ones without any path.
+  void process(const float *const *inputs, float *const *outputs, int numberOfOutputs, size_t framesToProcess);
+
+ private:
+  class Stage;
+
+  struct PathState {
+    int input;
+    int output;
+    std::unique_ptr<AudioArray> inputRing;
+    std::vector<std::unique_ptr<Stage>> stages;
+  };
+
+  size_t impulseResponseLength_;
+  // inputs are kept in a ring of this size, stages read their blocks from it
+  size_t inputRingSize_;
+  std::vector<PathState> paths_;
+
+  // frames written by the audio thread
+  size_t framesWritten_ = 0;
+  // smallest partition of the background stages, 0 if there are none
+  size_t backgroundPartitionSize_ = 0;
+
+  // background thread, only when runTailInBackground
+  std::thread backgroundThread_;
+  std::atomic<size_t> publishedFramesWritten_ {0};
+  std::atomic<uint32_t> epoch_ {0};
+  std::atomic<bool> isRunning_ {true};
+  std::atomic<size_t> numberOfLateBlocks_ {0};
+
+  void catchUpStage(PathState &path, Stage &stage);
+  void processStages(size_t framesWritten, bool background);
+  void backgroundThreadFunc();
+};
+
+} // namespace audioapi::dsp
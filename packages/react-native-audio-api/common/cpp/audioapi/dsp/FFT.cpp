@@ -38,4 +38,20 @@ void FFT::doInverseFFT(std::vector<std::complex<float>> &in, float *out) {
   dsp::multiplyByScalar(out, 1.0f / static_cast<float>(size_), out, size_);
 }
 
+void FFT::doFFTUnordered(const float *in, float *out) {
+  pffft_transform(pffftSetup_, in, out, work_, PFFFT_FORWARD);
+}
+
+void FFT::doInverseFFTUnordered(const float *in, float *out) {
+  pffft_transform(pffftSetup_, in, out, work_, PFFFT_BACKWARD);
+}
+
+void FFT::convolveAccumulate(
+    const float *a,
+    const float *b,
+    float *out,
+    float scale) {
+  pffft_zconvolve_accumulate(pffftSetup_, a, b, out, scale);
+}
+
 } // namespace audioapi::dsp
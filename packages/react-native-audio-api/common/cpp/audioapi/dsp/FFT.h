@@ -19,6 +19,18 @@ class FFT {
   void doFFT(float *in, std::vector<std::complex<float>> &out);
   void doInverseFFT(std::vector<std::complex<float>> &in, float *out);
 
+  // Transforms in the internal order of pffft, meant for frequency domain convolution.
+  // Neither transform is scaled, inverse(forward(x)) == size * x.
+  // Buffers have to be aligned to 16 bytes.
+  void doFFTUnordered(const float *in, float *out);
+  void doInverseFFTUnordered(const float *in, float *out);
+  // out += a * b * scale, a and b have to be spectra from doFFTUnordered.
+  void convolveAccumulate(const float *a, const float *b, float *out, float scale);
+
+  [[nodiscard]] int getSize() const {
+    return size_;
+  }
+
  private:
   int size_;
 
@@ -0,0 +1,283 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/dsp/Resampler.h>
+#include <audioapi/dsp/VectorMath.h>
+#include <audioapi/dsp/Windows.h>
+#include <audioapi/utils/AudioBus.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <numeric>
+
+namespace audioapi::dsp {
+
+namespace {
+
+struct QualitySettings {
+  // taps of every phase when upsampling
+  size_t numberOfTaps;
+  // passband edge, as a fraction of the lower of the two nyquist frequencies
+  double passband;
+  float beta;
+};
+
+QualitySettings getQualitySettings(Resampler::Quality quality) {
+  switch (quality) {
+    case Resampler::Quality::LOW:
+      return {16, 0.85, 5.0f};
+    case Resampler::Quality::MEDIUM:
+      return {32, 0.9, 7.0f};
+    case Resampler::Quality::HIGH:
+    default:
+      return {64, 0.95, 9.0f};
+  }
+}
+
+// frames converted at once by resample()
+constexpr size_t RESAMPLE_CHUNK_SIZE = 8192;
+
+} // namespace
+
+Resampler::Resampler(
+    int numberOfChannels,
+    float inputSampleRate,
+    float outputSampleRate,
+    Quality quality)
+    : numberOfChannels_(numberOfChannels),
+      coefficients_(0),
+      inputs_(numberOfChannels),
+      inputChannels_(numberOfChannels),
+      outputChannels_(numberOfChannels) {
+  auto inputRate =
+      std::max<uint64_t>(std::llround(std::abs(inputSampleRate)), 1);
+  auto outputRate =
+      std::max<uint64_t>(std::llround(std::abs(outputSampleRate)), 1);
+  auto divisor = std::gcd(inputRate, outputRate);
+  numberOfPhases_ = outputRate / divisor;
+  step_ = inputRate / divisor;
+  numberOfFilters_ = static_cast<size_t>(
+      std::min<uint64_t>(numberOfPhases_, RESAMPLER_MAX_NUMBER_OF_PHASES));
+
+  // When downsampling the cutoff moves down to the output nyquist frequency,
+  // the filter gets longer by the same ratio to keep the transition band.
+  auto settings = getQualitySettings(quality);
+  auto ratio = std::min(
+      1.0, static_cast<double>(numberOfPhases_) / static_cast<double>(step_));
+  numberOfTaps_ = static_cast<size_t>(
+      std::ceil(static_cast<double>(settings.numberOfTaps) / ratio));
+  // whole SIMD groups in the dot products
+  numberOfTaps_ = (numberOfTaps_ + 7) / 8 * 8;
+
+  // The filters sample one windowed sinc on a grid of 1 / numberOfFilters_
+  // frames, point n is n / numberOfFilters_ - numberOfTaps_ / 2 frames away
+  // from the output frame.
+  auto cutoff = 0.5 * ratio * settings.passband;
+  auto numberOfPoints = numberOfTaps_ * numberOfFilters_ + 1;
+  std::vector<float> window(numberOfPoints);
+  Kaiser(settings.beta).apply(window.data(), static_cast<int>(numberOfPoints));
+
+  coefficients_.resize((numberOfFilters_ + 1) * numberOfTaps_);
+  for (size_t filterIndex = 0; filterIndex <= numberOfFilters_;
+       ++filterIndex) {
+    auto *filter = coefficients_.getData() + filterIndex * numberOfTaps_;
+    double sum = 0.0;
+
+    for (size_t tap = 0; tap < numberOfTaps_; ++tap) {
+      auto n = filterIndex + tap * numberOfFilters_;
+      auto t =
+          static_cast<double>(n) / static_cast<double>(numberOfFilters_) -
+          static_cast<double>(numberOfTaps_ / 2);
+      auto x = std::numbers::pi * 2.0 * cutoff * t;
+      auto sinc = x == 0.0 ? 1.0 : std::sin(x) / x;
+      auto value = 2.0 * cutoff * sinc * window[n];
+
+      // tap k applies to the k-th newest frame, filters are stored oldest
+      // first to match the order of the input
+      filter[numberOfTaps_ - 1 - tap] = static_cast<float>(value);
+      sum += value;
+    }
+
+    // unity gain at DC for every filter
+    multiplyByScalar(
+        filter, static_cast<float>(1.0 / sum), filter, numberOfTaps_);
+  }
+
+  reset();
+}
+
+size_t Resampler::getMaxOutputFrames(size_t inputFrames) const {
+  return getOutputLength(inputFramesReceived_ + inputFrames) -
+      outputFramesProduced_;
+}
+
+size_t Resampler::process(
+    const float *const *input,
+    size_t inputFrames,
+    float *const *output,
+    size_t maxOutputFrames) {
+  append(input, inputFrames);
+  inputFramesReceived_ += inputFrames;
+  return produce(output, maxOutputFrames);
+}
+
+size_t Resampler::flush(float *const *output, size_t maxOutputFrames) {
+  if (!isFlushed_) {
+    // the last output frame is at most half of the filter before the end
+    append(nullptr, numberOfTaps_);
+    isFlushed_ = true;
+  }
+
+  return produce(output, maxOutputFrames);
+}
+
+size_t Resampler::process(
+    const AudioBus &input,
+    size_t inputStart,
+    size_t inputFrames,
+    AudioBus &output,
+    size_t outputStart) {
+  for (int c = 0; c < numberOfChannels_; ++c) {
+    inputChannels_[c] = input.getChannel(c)->getData() + inputStart;
+  }
+  setOutputChannels(output, outputStart);
+
+  return process(
+      inputChannels_.data(),
+      inputFrames,
+      outputChannels_.data(),
+      output.getSize() - outputStart);
+}
+
+size_t Resampler::flush(AudioBus &output, size_t outputStart) {
+  setOutputChannels(output, outputStart);
+  return flush(outputChannels_.data(), output.getSize() - outputStart);
+}
+
+void Resampler::reset() {
+  inputSize_ = 0;
+  append(nullptr, numberOfTaps_ - 1);
+
+  // the first output frame is aligned with the first input frame, which is
+  // half of the filter before the newest frame it needs
+  inputPosition_ = numberOfTaps_ - 1 + numberOfTaps_ / 2;
+  phase_ = 0;
+
+  inputFramesReceived_ = 0;
+  outputFramesProduced_ = 0;
+  isFlushed_ = false;
+}
+
+std::shared_ptr<AudioBus> Resampler::resample(
+    const AudioBus &audioBus,
+    float outputSampleRate,
+    Quality quality) {
+  auto numberOfChannels = audioBus.getNumberOfChannels();
+  Resampler resampler(
+      numberOfChannels, audioBus.getSampleRate(), outputSampleRate, quality);
+
+  if (resampler.numberOfPhases_ == resampler.step_) {
+    return std::make_shared<AudioBus>(audioBus);
+  }
+
+  auto length = audioBus.getSize();
+  auto result = std::make_shared<AudioBus>(
+      resampler.getMaxOutputFrames(length), numberOfChannels, outputSampleRate);
+  size_t framesWritten = 0;
+
+  for (size_t frame = 0; frame < length; frame += RESAMPLE_CHUNK_SIZE) {
+    auto frames = std::min(RESAMPLE_CHUNK_SIZE, length - frame);
+    framesWritten +=
+        resampler.process(audioBus, frame, frames, *result, framesWritten);
+  }
+  resampler.flush(*result, framesWritten);
+
+  return result;
+}
+
+void Resampler::setOutputChannels(AudioBus &output, size_t outputStart) {
+  for (int c = 0; c < numberOfChannels_; ++c) {
+    outputChannels_[c] = output.getChannel(c)->getData() + outputStart;
+  }
+}
+
+uint64_t Resampler::getOutputLength(uint64_t inputFrames) const {
+  return (inputFrames * numberOfPhases_ + step_ - 1) / step_;
+}
+
+void Resampler::append(const float *const *input, size_t inputFrames) {
+  auto size = inputSize_ + inputFrames;
+
+  for (int c = 0; c < numberOfChannels_; ++c) {
+    auto &channel = inputs_[c];
+    if (channel.size() < size) {
+      channel.resize(size);
+    }
+
+    if (input != nullptr) {
+      std::memcpy(
+          channel.data() + inputSize_, input[c], inputFrames * sizeof(float));
+    } else {
+      std::fill_n(channel.data() + inputSize_, inputFrames, 0.0f);
+    }
+  }
+
+  inputSize_ = size;
+}
+
+size_t Resampler::produce(float *const *output, size_t maxOutputFrames) {
+  auto framesToProduce = std::min<uint64_t>(
+      maxOutputFrames,
+      getOutputLength(inputFramesReceived_) - outputFramesProduced_);
+  size_t framesProduced = 0;
+
+  while (framesProduced < framesToProduce && inputPosition_ < inputSize_) {
+    auto oldestFrame = inputPosition_ + 1 - numberOfTaps_;
+
+    if (numberOfFilters_ == numberOfPhases_) {
+      const auto *filter = coefficients_.getData() + phase_ * numberOfTaps_;
+      for (int c = 0; c < numberOfChannels_; ++c) {
+        output[c][framesProduced] =
+            dotProduct(filter, inputs_[c].data() + oldestFrame, numberOfTaps_);
+      }
+    } else {
+      auto position = phase_ * numberOfFilters_;
+      const auto *filter = coefficients_.getData() +
+          position / numberOfPhases_ * numberOfTaps_;
+      auto factor = static_cast<float>(position % numberOfPhases_) /
+          static_cast<float>(numberOfPhases_);
+
+      for (int c = 0; c < numberOfChannels_; ++c) {
+        const auto *frames = inputs_[c].data() + oldestFrame;
+        auto current = dotProduct(filter, frames, numberOfTaps_);
+        auto next = dotProduct(filter + numberOfTaps_, frames, numberOfTaps_);
+        output[c][framesProduced] = current + factor * (next - current);
+      }
+    }
+
+    ++framesProduced;
+    phase_ += step_;
+    inputPosition_ += phase_ / numberOfPhases_;
+    phase_ %= numberOfPhases_;
+  }
+
+  outputFramesProduced_ += framesProduced;
+
+  // keep only the history of the next output frame
+  auto framesToDrop =
+      std::min(inputPosition_ + 1 - numberOfTaps_, inputSize_);
+  if (framesToDrop > 0) {
+    for (auto &channel : inputs_) {
+      std::memmove(
+          channel.data(),
+          channel.data() + framesToDrop,
+          (inputSize_ - framesToDrop) * sizeof(float));
+    }
+    inputSize_ -= framesToDrop;
+    inputPosition_ -= framesToDrop;
+  }
+
+  return framesProduced;
+}
+
+} // namespace audioapi::dsp
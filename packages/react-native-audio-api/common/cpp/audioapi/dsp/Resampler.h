@@ -0,0 +1,87 @@
+#pragma once
+
+#include <audioapi/utils/AudioArray.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace audioapi {
+class AudioBus;
+} // namespace audioapi
+
+namespace audioapi::dsp {
+
+// Windowed-sinc polyphase sample rate converter of a multichannel stream.
+// Rates are rounded to whole Hz and their ratio reduced to L / M, every one of the L phases has its own
+// precomputed filter, so an output frame costs one dot product per channel. Ratios that reduce to more than
+// RESAMPLER_MAX_NUMBER_OF_PHASES phases keep that many filters and interpolate between the two nearest ones.
+// The filter delay is compensated and flush() emits the tail, so a whole stream of n frames
+// becomes ceil(n * L / M) frames aligned with the input.
+class Resampler {
+ public:
+  // Filter length and stopband attenuation, roughly 50, 70 and 90 dB.
+  enum class Quality { LOW, MEDIUM, HIGH };
+
+  Resampler(int numberOfChannels, float inputSampleRate, float outputSampleRate, Quality quality);
+
+  [[nodiscard]] int getNumberOfChannels() const {
+    return numberOfChannels_;
+  }
+
+  // Upper bound of frames written by process() with inputFrames frames of input,
+  // and by flush() for 0.
+  [[nodiscard]] size_t getMaxOutputFrames(size_t inputFrames) const;
+
+  // Converts the next inputFrames frames of every channel. Returns the number of frames written to output,
+  // frames that did not fit into maxOutputFrames are written by the next call.
+  size_t process(const float *const *input, size_t inputFrames, float *const *output, size_t maxOutputFrames);
+
+  // Writes the rest of the stream, as if it was followed by silence.
+  size_t flush(float *const *output, size_t maxOutputFrames);
+
+  // Same as above on the channels of buses, frames are read from inputStart and written from outputStart
+  // up to the end of output.
+  size_t process(const AudioBus &input, size_t inputStart, size_t inputFrames, AudioBus &output, size_t outputStart);
+  size_t flush(AudioBus &output, size_t outputStart);
+
+  // Starts a new stream.
+  void reset();
+
+  // Converts a whole bus, returns a copy if the rates are the same.
+  static std::shared_ptr<AudioBus> resample(const AudioBus &audioBus, float outputSampleRate, Quality quality);
+
+ private:
+  int numberOfChannels_;
+  // L and M
+  uint64_t numberOfPhases_;
+  uint64_t step_;
+  size_t numberOfTaps_;
+  // numberOfFilters_ + 1 filters of numberOfTaps_ coefficients, the last coefficient applies to the newest
+  // input frame. Filter i is for the output i / numberOfFilters_ of a frame after that frame.
+  size_t numberOfFilters_;
+  AudioArray coefficients_;
+
+  // numberOfTaps_ - 1 frames of history followed by the input not consumed yet
+  std::vector<std::vector<float>> inputs_;
+  size_t inputSize_ = 0;
+  // newest input frame and phase of the next output frame
+  size_t inputPosition_ = 0;
+  uint64_t phase_ = 0;
+
+  uint64_t inputFramesReceived_ = 0;
+  uint64_t outputFramesProduced_ = 0;
+  bool isFlushed_ = false;
+
+  // channel pointers of the bus overloads
+  std::vector<const float *> inputChannels_;
+  std::vector<float *> outputChannels_;
+
+  [[nodiscard]] uint64_t getOutputLength(uint64_t inputFrames) const;
+  void append(const float *const *input, size_t inputFrames);
+  size_t produce(float *const *output, size_t maxOutputFrames);
+  void setOutputChannels(AudioBus &output, size_t outputStart);
+};
+
+} // namespace audioapi::dsp
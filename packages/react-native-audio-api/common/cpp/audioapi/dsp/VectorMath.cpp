@@ -26,6 +26,8 @@
 #include <audioapi/dsp/AudioUtils.h>
 #include <audioapi/dsp/VectorMath.h>
 
+#include <cstring>
+
 #if defined(HAVE_ACCELERATE)
 #include <Accelerate/Accelerate.h>
 #endif
@@ -113,6 +115,16 @@ float maximumMagnitude(
   return maximumValue;
 }
 
+float dotProduct(
+    const float *inputVector1,
+    const float *inputVector2,
+    size_t numberOfElementsToProcess) {
+  float result = 0;
+  vDSP_dotpr(
+      inputVector1, 1, inputVector2, 1, &result, numberOfElementsToProcess);
+  return result;
+}
+
 void multiplyByScalarThenAddToOutput(
     const float *inputVector,
     float scalar,
@@ -129,6 +141,62 @@ void multiplyByScalarThenAddToOutput(
       numberOfElementsToProcess);
 }
 
+void fill(float value, float *outputVector, size_t numberOfElementsToProcess) {
+  vDSP_vfill(&value, outputVector, 1, numberOfElementsToProcess);
+}
+
+void linearRamp(
+    float startValue,
+    float step,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  vDSP_vramp(&startValue, &step, outputVector, 1, numberOfElementsToProcess);
+}
+
+void clip(
+    const float *inputVector,
+    float lowThreshold,
+    float highThreshold,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  vDSP_vclip(
+      inputVector,
+      1,
+      &lowThreshold,
+      &highThreshold,
+      outputVector,
+      1,
+      numberOfElementsToProcess);
+}
+
+void deinterleave(
+    const float *inputVector,
+    float *const *outputVectors,
+    int numberOfChannels,
+    size_t numberOfFrames) {
+  if (numberOfChannels == 2) {
+    DSPSplitComplex output{outputVectors[0], outputVectors[1]};
+    vDSP_ctoz(
+        reinterpret_cast<const DSPComplex *>(inputVector),
+        2,
+        &output,
+        1,
+        numberOfFrames);
+    return;
+  }
+
+  float one = 1.0f;
+  for (int c = 0; c < numberOfChannels; ++c) {
+    vDSP_vsmul(
+        inputVector + c,
+        numberOfChannels,
+        &one,
+        outputVectors[c],
+        1,
+        numberOfFrames);
+  }
+}
+
 #else
 
 #if defined(HAVE_X86_SSE2)
@@ -552,6 +620,67 @@ void multiply(
   }
 }
 
+float dotProduct(
+    const float *inputVector1,
+    const float *inputVector2,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+  float result = 0;
+
+#if defined(HAVE_X86_SSE2)
+  // Two accumulators hide the latency of the additions, loads are unaligned
+  // as both vectors can start anywhere.
+  size_t tailFrames = n % 8;
+  const float *endP = inputVector1 + n - tailFrames;
+  __m128 sum1 = _mm_setzero_ps();
+  __m128 sum2 = _mm_setzero_ps();
+
+  while (inputVector1 < endP) {
+    sum1 = _mm_add_ps(
+        sum1,
+        _mm_mul_ps(_mm_loadu_ps(inputVector1), _mm_loadu_ps(inputVector2)));
+    sum2 = _mm_add_ps(
+        sum2,
+        _mm_mul_ps(
+            _mm_loadu_ps(inputVector1 + 4), _mm_loadu_ps(inputVector2 + 4)));
+    inputVector1 += 8;
+    inputVector2 += 8;
+  }
+
+  float groupSum[4];
+  _mm_storeu_ps(groupSum, _mm_add_ps(sum1, sum2));
+  result = (groupSum[0] + groupSum[1]) + (groupSum[2] + groupSum[3]);
+
+  n = tailFrames;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 8;
+  const float *endP = inputVector1 + n - tailFrames;
+  float32x4_t sum1 = vdupq_n_f32(0);
+  float32x4_t sum2 = vdupq_n_f32(0);
+
+  while (inputVector1 < endP) {
+    sum1 = vmlaq_f32(sum1, vld1q_f32(inputVector1), vld1q_f32(inputVector2));
+    sum2 = vmlaq_f32(
+        sum2, vld1q_f32(inputVector1 + 4), vld1q_f32(inputVector2 + 4));
+    inputVector1 += 8;
+    inputVector2 += 8;
+  }
+
+  float32x4_t fourSum = vaddq_f32(sum1, sum2);
+  float32x2_t twoSum = vadd_f32(vget_low_f32(fourSum), vget_high_f32(fourSum));
+  result = vget_lane_f32(vpadd_f32(twoSum, twoSum), 0);
+
+  n = tailFrames;
+#endif
+  while (n--) {
+    result += *inputVector1 * *inputVector2;
+    ++inputVector1;
+    ++inputVector2;
+  }
+
+  return result;
+}
+
 float maximumMagnitude(
     const float *inputVector,
     size_t numberOfElementsToProcess) {
@@ -688,6 +817,178 @@ void multiplyByScalarThenAddToOutput(
   }
 }
 
+void fill(float value, float *outputVector, size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+
+#if defined(HAVE_X86_SSE2)
+  size_t group = n / 4;
+  __m128 mValue = _mm_set_ps1(value);
+
+  while (group--) {
+    _mm_storeu_ps(outputVector, mValue);
+    outputVector += 4;
+  }
+
+  n %= 4;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 4;
+  const float *endP = outputVector + n - tailFrames;
+  float32x4_t valueVector = vdupq_n_f32(value);
+
+  while (outputVector < endP) {
+    vst1q_f32(outputVector, valueVector);
+    outputVector += 4;
+  }
+  n = tailFrames;
+#endif
+  while (n--) {
+    *outputVector = value;
+    ++outputVector;
+  }
+}
+
+void linearRamp(
+    float startValue,
+    float step,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+  size_t i = 0;
+
+  // Every element is computed from its index, so rounding errors do not
+  // accumulate along the ramp.
+#if defined(HAVE_X86_SSE2)
+  __m128 mStart = _mm_set_ps1(startValue);
+  __m128 mStep = _mm_set_ps1(step);
+  __m128 mIndex = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+  __m128 mFour = _mm_set_ps1(4.0f);
+
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(
+        outputVector + i, _mm_add_ps(mStart, _mm_mul_ps(mIndex, mStep)));
+    mIndex = _mm_add_ps(mIndex, mFour);
+  }
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  const float indices[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+  float32x4_t startVector = vdupq_n_f32(startValue);
+  float32x4_t indexVector = vld1q_f32(indices);
+  float32x4_t fourVector = vdupq_n_f32(4.0f);
+
+  for (; i + 4 <= n; i += 4) {
+    vst1q_f32(outputVector + i, vmlaq_n_f32(startVector, indexVector, step));
+    indexVector = vaddq_f32(indexVector, fourVector);
+  }
+#endif
+  for (; i < n; ++i) {
+    outputVector[i] = startValue + static_cast<float>(i) * step;
+  }
+}
+
+void clip(
+    const float *inputVector,
+    float lowThreshold,
+    float highThreshold,
+    float *outputVector,
+    size_t numberOfElementsToProcess) {
+  size_t n = numberOfElementsToProcess;
+
+#if defined(HAVE_X86_SSE2)
+  size_t group = n / 4;
+  __m128 mLow = _mm_set_ps1(lowThreshold);
+  __m128 mHigh = _mm_set_ps1(highThreshold);
+
+  while (group--) {
+    __m128 source = _mm_loadu_ps(inputVector);
+    _mm_storeu_ps(outputVector, _mm_max_ps(_mm_min_ps(source, mHigh), mLow));
+
+    inputVector += 4;
+    outputVector += 4;
+  }
+
+  n %= 4;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 4;
+  const float *endP = outputVector + n - tailFrames;
+  float32x4_t lowVector = vdupq_n_f32(lowThreshold);
+  float32x4_t highVector = vdupq_n_f32(highThreshold);
+
+  while (outputVector < endP) {
+    float32x4_t source = vld1q_f32(inputVector);
+    vst1q_f32(outputVector, vmaxq_f32(vminq_f32(source, highVector), lowVector));
+
+    inputVector += 4;
+    outputVector += 4;
+  }
+  n = tailFrames;
+#endif
+  while (n--) {
+    *outputVector = std::clamp(*inputVector, lowThreshold, highThreshold);
+    ++inputVector;
+    ++outputVector;
+  }
+}
+
+void deinterleave(
+    const float *inputVector,
+    float *const *outputVectors,
+    int numberOfChannels,
+    size_t numberOfFrames) {
+  if (numberOfChannels == 1) {
+    std::memcpy(outputVectors[0], inputVector, numberOfFrames * sizeof(float));
+    return;
+  }
+
+  if (numberOfChannels != 2) {
+    for (int c = 0; c < numberOfChannels; ++c) {
+      float *outputVector = outputVectors[c];
+      for (size_t i = 0; i < numberOfFrames; ++i) {
+        outputVector[i] = inputVector[i * numberOfChannels + c];
+      }
+    }
+    return;
+  }
+
+  float *left = outputVectors[0];
+  float *right = outputVectors[1];
+  size_t n = numberOfFrames;
+
+#if defined(HAVE_X86_SSE2)
+  size_t group = n / 4;
+
+  while (group--) {
+    __m128 first = _mm_loadu_ps(inputVector);
+    __m128 second = _mm_loadu_ps(inputVector + 4);
+    _mm_storeu_ps(left, _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(
+        right, _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+
+    inputVector += 8;
+    left += 4;
+    right += 4;
+  }
+
+  n %= 4;
+#elif defined(HAVE_ARM_NEON_INTRINSICS)
+  size_t tailFrames = n % 4;
+  const float *endP = left + n - tailFrames;
+
+  while (left < endP) {
+    float32x4x2_t source = vld2q_f32(inputVector);
+    vst1q_f32(left, source.val[0]);
+    vst1q_f32(right, source.val[1]);
+
+    inputVector += 8;
+    left += 4;
+    right += 4;
+  }
+  n = tailFrames;
+#endif
+  while (n--) {
+    *left++ = *inputVector++;
+    *right++ = *inputVector++;
+  }
+}
+
 #endif
 
 void linearToDecibels(
@@ -41,6 +41,17 @@ void addScalar(const float *inputVector, float scalar, float *outputVector, size
 void add(const float *inputVector1, const float *inputVector2, float *outputVector, size_t numberOfElementsToProcess);
 void subtract(const float *inputVector1, const float *inputVector2, float *outputVector, size_t numberOfElementsToProcess);
 void multiply(const float *inputVector1, const float *inputVector2, float *outputVector, size_t numberOfElementsToProcess);
+// Sum of inputVector1[i] * inputVector2[i].
+float dotProduct(const float *inputVector1, const float *inputVector2, size_t numberOfElementsToProcess);
+
+void fill(float value, float *outputVector, size_t numberOfElementsToProcess);
+// outputVector[i] = startValue + i * step
+void linearRamp(float startValue, float step, float *outputVector, size_t numberOfElementsToProcess);
+// Clamps every element to [lowThreshold, highThreshold].
+void clip(const float *inputVector, float lowThreshold, float highThreshold, float *outputVector, size_t numberOfElementsToProcess);
+
+// Splits numberOfChannels interleaved channels into separate outputVectors.
+void deinterleave(const float *inputVector, float *const *outputVectors, int numberOfChannels, size_t numberOfFrames);
 
 // Finds the maximum magnitude of a float vector.
 float maximumMagnitude(const float *inputVector, size_t numberOfElementsToProcess);
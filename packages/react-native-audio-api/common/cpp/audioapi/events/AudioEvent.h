@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace audioapi {
+
+enum class AudioEventType : uint8_t {
+  ENDED,
+  LOOP_ENDED,
+  POSITION_CHANGED,
+  BUFFER_UNDERRUN,
+  BUFFER_LEVEL_CHANGED,
+  BUFFER_CONSUMED,
+};
+
+/// @brief Event sent from the audio thread, delivered to JS in batches.
+/// @note It is a plain record, so it can be queued without allocating. Fields not used by the type are ignored.
+struct AudioEvent {
+  AudioEventType type;
+  uint64_t listenerId;
+  // positionChanged, position in seconds
+  // bufferLevelChanged, buffered audio in seconds
+  // bufferConsumed, duration of the buffers left in the queue
+  double value = 0.0;
+  // bufferUnderrun, underruns since the stream started
+  // bufferConsumed, number of the buffers left in the queue
+  int count = 0;
+  // ended of AudioBufferQueueSourceNode, the buffer that ended, -1 when the node was stopped
+  // bufferConsumed, the buffer that was played out
+  int64_t bufferId = -1;
+  bool isLast = false;
+};
+
+} // namespace audioapi
@@ -17,9 +17,24 @@ AudioEventHandlerRegistry::AudioEventHandlerRegistry(
   for (const auto &eventName : AUDIO_API_EVENT_NAMES) {
     eventHandlers_[std::string(eventName)] = {};
   }
+
+  auto queuedEventsCapacity =
+      eventQueue_.getCapacity() + valueEventQueue_.getCapacity();
+  pendingEvents_.reserve(queuedEventsCapacity);
+  drainedEvents_.reserve(queuedEventsCapacity);
+  drainedHandlers_.reserve(queuedEventsCapacity);
+  overflowEvents_.reserve(eventQueue_.getCapacity());
+
+  dispatchThread_ =
+      std::thread(&AudioEventHandlerRegistry::dispatchThreadFunc, this);
 }
 
 AudioEventHandlerRegistry::~AudioEventHandlerRegistry() {
+  isRunning_.store(false, std::memory_order_release);
+  dispatchEpoch_.fetch_add(1, std::memory_order_release);
+  dispatchEpoch_.notify_one();
+  dispatchThread_.join();
+
   eventHandlers_.clear();
 }
 
@@ -186,6 +201,264 @@ void AudioEventHandlerRegistry::invokeHandlerWithEventBody(
   });
 }
 
+void AudioEventHandlerRegistry::enqueueEvent(const AudioEvent &event) {
+  // callInvoker_ and runtime_ must be valid to invoke handlers
+  // this might happen when react-native is reloaded or the app is closed
+  if (callInvoker_ == nullptr || runtime_ == nullptr) {
+    return;
+  }
+
+  // The dispatch thread empties the queues as soon as it is woken up, they
+  // are full only when that thread has not run for a whole queue of events.
+  if (isLatestValueEvent(event.type)) {
+    // only the latest value is delivered, a later one replaces a lost one
+    valueEventQueue_.tryPush(event);
+  } else if (
+      hasOverflowEvents_.load(std::memory_order_acquire) ||
+      !eventQueue_.tryPush(event)) {
+    // Ended and the other one-shot events are never lost. Once one overflows
+    // the next ones follow it, so each listener keeps its order. The storage
+    // is reserved up front, it grows only past a second full queue.
+    std::lock_guard lock(overflowEventsLock_);
+    overflowEvents_.push_back(event);
+    hasOverflowEvents_.store(true, std::memory_order_release);
+  }
+
+  if (!isDispatchScheduled_.exchange(true, std::memory_order_acq_rel)) {
+    dispatchEpoch_.fetch_add(1, std::memory_order_release);
+    dispatchEpoch_.notify_one();
+  }
+}
+
+/**
+ * Helper functions
+ */
+
+void AudioEventHandlerRegistry::dispatchThreadFunc() {
+  uint32_t seenEpoch = 0;
+  while (true) {
+    dispatchEpoch_.wait(seenEpoch, std::memory_order_acquire);
+    seenEpoch = dispatchEpoch_.load(std::memory_order_acquire);
+
+    if (!isRunning_.load(std::memory_order_acquire)) [[unlikely]] {
+      break;
+    }
+
+    // Events pushed before the flag is cleared are popped below, the ones
+    // pushed after it wake the thread again.
+    isDispatchScheduled_.exchange(false, std::memory_order_acq_rel);
+
+    bool shouldScheduleDrain = false;
+    {
+      std::lock_guard lock(pendingEventsLock_);
+      shouldScheduleDrain = pendingEvents_.empty();
+
+      // Positions and levels go first, so a batch ends with the ended events
+      // of the nodes it reports on.
+      AudioEvent event{};
+      while (valueEventQueue_.tryPop(event)) {
+        pendingEvents_.push_back(event);
+      }
+      while (eventQueue_.tryPop(event)) {
+        pendingEvents_.push_back(event);
+      }
+
+      if (hasOverflowEvents_.load(std::memory_order_acquire)) {
+        std::lock_guard overflowLock(overflowEventsLock_);
+        pendingEvents_.insert(
+            pendingEvents_.end(),
+            overflowEvents_.begin(),
+            overflowEvents_.end());
+        overflowEvents_.clear();
+        hasOverflowEvents_.store(false, std::memory_order_release);
+      }
+
+      shouldScheduleDrain = shouldScheduleDrain && !pendingEvents_.empty();
+    }
+
+    // a scheduled drain takes every event appended until it runs
+    if (shouldScheduleDrain) {
+      callInvoker_->invokeAsync([this]() { drainEvents(); });
+    }
+  }
+}
+
+void AudioEventHandlerRegistry::drainEvents() {
+  drainedEvents_.clear();
+  {
+    std::lock_guard lock(pendingEventsLock_);
+    std::swap(drainedEvents_, pendingEvents_);
+  }
+
+  // only the latest position or level of each listener is worth delivering
+  latestValueListeners_.clear();
+  for (auto it = drainedEvents_.rbegin(); it != drainedEvents_.rend(); ++it) {
+    if (isLatestValueEvent(it->type) &&
+        !latestValueListeners_.insert(it->listenerId).second) {
+      it->listenerId = 0;
+    }
+  }
+
+  if (eventBatchDispatcher_ == nullptr) {
+    for (const auto &drainedEvent : drainedEvents_) {
+      if (drainedEvent.listenerId != 0) {
+        invokeHandler(drainedEvent);
+      }
+    }
+    return;
+  }
+
+  // The whole batch crosses into JS in a single call, the dispatcher calls
+  // every handler with its event.
+  drainedHandlers_.clear();
+  for (auto &drainedEvent : drainedEvents_) {
+    const jsi::Function *handler = nullptr;
+    if (drainedEvent.listenerId != 0) {
+      handler = findHandler(drainedEvent);
+    }
+
+    // The listener might have been removed after the event was queued
+    if (handler == nullptr) {
+      drainedEvent.listenerId = 0;
+      continue;
+    }
+    drainedHandlers_.push_back(handler);
+  }
+
+  if (drainedHandlers_.empty()) {
+    return;
+  }
+
+  try {
+    auto handlers = jsi::Array(*runtime_, drainedHandlers_.size());
+    auto events = jsi::Array(*runtime_, drainedHandlers_.size());
+    size_t index = 0;
+    for (const auto &drainedEvent : drainedEvents_) {
+      if (drainedEvent.listenerId == 0) {
+        continue;
+      }
+
+      handlers.setValueAtIndex(
+          *runtime_, index, jsi::Value(*runtime_, *drainedHandlers_[index]));
+      events.setValueAtIndex(
+          *runtime_, index, createEventObject(drainedEvent));
+      index += 1;
+    }
+
+    eventBatchDispatcher_->call(
+        *runtime_, std::move(handlers), std::move(events));
+  } catch (const std::exception &e) {
+    // re-throw the exception to be handled by the caller
+    // std::exception is safe to parse by the rn bridge
+    throw;
+  } catch (...) {
+    printf("Unknown exception occurred while dispatching audio events\n");
+  }
+}
+
+void AudioEventHandlerRegistry::setEventBatchDispatcher(
+    const std::shared_ptr<jsi::Function> &dispatcher) {
+  // drains run on the JS thread as well, so no synchronization is needed
+  eventBatchDispatcher_ = dispatcher;
+}
+
+void AudioEventHandlerRegistry::invokeHandler(const AudioEvent &event) {
+  auto *handler = findHandler(event);
+
+  if (handler == nullptr) {
+    // The listener might have been removed after the event was queued
+    return;
+  }
+
+  auto eventName = getEventName(event.type);
+  try {
+    handler->call(*runtime_, createEventObject(event));
+  } catch (const std::exception &e) {
+    // re-throw the exception to be handled by the caller
+    // std::exception is safe to parse by the rn bridge
+    throw;
+  } catch (...) {
+    printf(
+        "Unknown exception occurred while invoking handler for event: %s\n",
+        eventName);
+  }
+}
+
+const jsi::Function *AudioEventHandlerRegistry::findHandler(
+    const AudioEvent &event) const {
+  auto it = eventHandlers_.find(getEventName(event.type));
+
+  if (it == eventHandlers_.end()) {
+    // If the event name is not registered, we can skip invoking handlers
+    return nullptr;
+  }
+
+  auto handlerIt = it->second.find(event.listenerId);
+
+  if (handlerIt == it->second.end() || handlerIt->second == nullptr) {
+    return nullptr;
+  }
+
+  return handlerIt->second.get();
+}
+
+bool AudioEventHandlerRegistry::isLatestValueEvent(AudioEventType type) {
+  return type == AudioEventType::POSITION_CHANGED ||
+      type == AudioEventType::BUFFER_LEVEL_CHANGED;
+}
+
+const char *AudioEventHandlerRegistry::getEventName(AudioEventType type) {
+  switch (type) {
+    case AudioEventType::ENDED:
+      return "ended";
+    case AudioEventType::LOOP_ENDED:
+      return "loopEnded";
+    case AudioEventType::POSITION_CHANGED:
+      return "positionChanged";
+    case AudioEventType::BUFFER_UNDERRUN:
+      return "bufferUnderrun";
+    case AudioEventType::BUFFER_LEVEL_CHANGED:
+      return "bufferLevelChanged";
+    case AudioEventType::BUFFER_CONSUMED:
+      return "bufferConsumed";
+  }
+
+  return "";
+}
+
+jsi::Object AudioEventHandlerRegistry::createEventObject(
+    const AudioEvent &event) {
+  auto eventObject = jsi::Object(*runtime_);
+
+  switch (event.type) {
+    case AudioEventType::ENDED:
+      // a stopped node leaves both fields undefined
+      if (event.bufferId >= 0) {
+        eventObject.setProperty(
+            *runtime_, "bufferId", std::to_string(event.bufferId));
+        eventObject.setProperty(*runtime_, "isLast", event.isLast);
+      }
+      break;
+    case AudioEventType::LOOP_ENDED:
+      break;
+    case AudioEventType::POSITION_CHANGED:
+    case AudioEventType::BUFFER_LEVEL_CHANGED:
+      eventObject.setProperty(*runtime_, "value", event.value);
+      break;
+    case AudioEventType::BUFFER_UNDERRUN:
+      eventObject.setProperty(*runtime_, "value", event.count);
+      break;
+    case AudioEventType::BUFFER_CONSUMED:
+      eventObject.setProperty(
+          *runtime_, "bufferId", std::to_string(event.bufferId));
+      eventObject.setProperty(*runtime_, "queuedBuffers", event.count);
+      eventObject.setProperty(*runtime_, "queuedDuration", event.value);
+      break;
+  }
+
+  return eventObject;
+}
+
 jsi::Object AudioEventHandlerRegistry::createEventObject(
     const std::unordered_map<std::string, EventValue> &body) {
   auto eventObject = jsi::Object(*runtime_);
@@ -2,13 +2,20 @@
 
 #include <jsi/jsi.h>
 #include <ReactCommon/CallInvoker.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/events/AudioEvent.h>
 #include <audioapi/events/IAudioEventHandlerRegistry.h>
+#include <audioapi/utils/MpscQueue.hpp>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <array>
 #include <string>
 #include <variant>
 #include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace audioapi {
 using namespace facebook;
@@ -28,6 +35,13 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
   void invokeHandlerWithEventBody(const std::string &eventName, const std::unordered_map<std::string, EventValue> &body) override;
   void invokeHandlerWithEventBody(const std::string &eventName, uint64_t listenerId, const std::unordered_map<std::string, EventValue> &body) override;
 
+  void enqueueEvent(const AudioEvent &event) override;
+
+  /// @brief Sets the JS function every drained batch of queued events is delivered through.
+  /// @note It is called once per drain with an array of handlers and an array of their events.
+  /// Until it is set, every handler is called on its own.
+  void setEventBatchDispatcher(const std::shared_ptr<jsi::Function> &dispatcher);
+
  private:
     std::atomic<uint64_t> listenerIdCounter_{1}; // Atomic counter for listener IDs
 
@@ -35,6 +49,32 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
     jsi::Runtime *runtime_;
     std::unordered_map<std::string, std::unordered_map<uint64_t, std::shared_ptr<jsi::Function>>> eventHandlers_;
 
+    // Events from the audio thread wait here for the dispatch thread, which
+    // moves them to pendingEvents_ and schedules a CallInvoker job whenever
+    // pendingEvents_ stops being empty. The audio thread itself never calls
+    // the CallInvoker, every call allocates.
+    // Positions and levels have a queue of their own, they are dropped when it
+    // is full, a newer value follows anyway. Every other event is delivered,
+    // the ones that find eventQueue_ full wait in overflowEvents_.
+    MpscQueue<AudioEvent> eventQueue_{AUDIO_EVENT_QUEUE_CAPACITY};
+    MpscQueue<AudioEvent> valueEventQueue_{AUDIO_EVENT_QUEUE_CAPACITY};
+    std::mutex overflowEventsLock_;
+    std::vector<AudioEvent> overflowEvents_;
+    std::atomic<bool> hasOverflowEvents_{false};
+    std::atomic<bool> isDispatchScheduled_{false};
+    std::atomic<uint32_t> dispatchEpoch_{0};
+    std::atomic<bool> isRunning_{true};
+    std::thread dispatchThread_;
+
+    std::mutex pendingEventsLock_;
+    std::vector<AudioEvent> pendingEvents_;
+    // swapped with pendingEvents_ by every drain, JS thread only
+    std::vector<AudioEvent> drainedEvents_;
+    std::unordered_set<uint64_t> latestValueListeners_;
+    // handlers of the drained events, JS thread only
+    std::vector<const jsi::Function *> drainedHandlers_;
+    std::shared_ptr<jsi::Function> eventBatchDispatcher_;
+
     static constexpr std::array<std::string_view, 15> SYSTEM_EVENT_NAMES = {
         "remotePlay",
         "remotePause",
@@ -53,15 +93,27 @@ class AudioEventHandlerRegistry : public IAudioEventHandlerRegistry {
         "volumeChange",
     };
 
-    static constexpr std::array<std::string_view, 6> AUDIO_API_EVENT_NAMES = {
+    static constexpr std::array<std::string_view, 9> AUDIO_API_EVENT_NAMES = {
       "ended",
       "loopEnded",
+      "bufferConsumed",
       "audioReady",
       "positionChanged",
+      "bufferUnderrun",
+      "bufferLevelChanged",
       "audioError",
       "systemStateChanged"
     };
 
+    void dispatchThreadFunc();
+    void drainEvents();
+    void invokeHandler(const AudioEvent &event);
+    const jsi::Function *findHandler(const AudioEvent &event) const;
+
+    static bool isLatestValueEvent(AudioEventType type);
+
+    static const char *getEventName(AudioEventType type);
+    jsi::Object createEventObject(const AudioEvent &event);
     jsi::Object createEventObject(const std::unordered_map<std::string, EventValue> &body);
     jsi::Object createEventObject(const std::unordered_map<std::string, EventValue> &body, size_t memoryPressure);
 };
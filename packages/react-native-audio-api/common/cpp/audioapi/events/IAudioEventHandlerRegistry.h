@@ -2,6 +2,7 @@
 
 #include <jsi/jsi.h>
 #include <ReactCommon/CallInvoker.h>
+#include <audioapi/events/AudioEvent.h>
 #include <unordered_map>
 #include <variant>
 #include <string>
@@ -20,6 +21,10 @@ class IAudioEventHandlerRegistry {
 
   virtual void invokeHandlerWithEventBody(const std::string &eventName, const std::unordered_map<std::string, EventValue> &body) = 0;
   virtual void invokeHandlerWithEventBody(const std::string &eventName, uint64_t listenerId, const std::unordered_map<std::string, EventValue> &body) = 0;
+
+  /// @brief Queues the event, it is delivered to JS together with all the events queued before the next JS frame.
+  /// @note Safe to call from the audio thread and the render workers, it neither allocates nor calls the CallInvoker.
+  virtual void enqueueEvent(const AudioEvent &event) = 0;
 };
 
 } // namespace audioapi
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <memory>
+#include <utility>
 
 namespace audioapi {
 
@@ -9,14 +11,18 @@ using namespace facebook;
 class AudioArrayBuffer : public jsi::MutableBuffer {
  public:
   AudioArrayBuffer(uint8_t *data, size_t size): data_(data), size_(size) {}
+  // Borrows data owned by owner, which is kept alive as long as the buffer
+  // instead of data being deleted.
+  AudioArrayBuffer(std::shared_ptr<void> owner, uint8_t *data, size_t size)
+      : owner_(std::move(owner)), data_(data), size_(size) {}
   ~AudioArrayBuffer() override {
-    if (data_ == nullptr) {
+    if (data_ == nullptr || owner_ != nullptr) {
       return;
     }
     delete[] data_;
   }
   AudioArrayBuffer(AudioArrayBuffer &&other) noexcept
-      : data_(other.data_), size_(other.size_) {
+      : owner_(std::move(other.owner_)), data_(other.data_), size_(other.size_) {
     other.data_ = nullptr;
   }
 
@@ -28,6 +34,7 @@ class AudioArrayBuffer : public jsi::MutableBuffer {
   uint8_t *data() override;
 
  private:
+  std::shared_ptr<void> owner_;
   uint8_t *data_;
   const size_t size_;
 };
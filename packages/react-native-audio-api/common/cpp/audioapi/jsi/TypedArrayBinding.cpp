@@ -0,0 +1,60 @@
+#include <audioapi/jsi/TypedArrayBinding.h>
+
+#include <utility>
+
+namespace audioapi {
+
+TypedArrayBinding::View TypedArrayBinding::bind(
+    jsi::Runtime &runtime,
+    const jsi::Value &typedArray) {
+  auto object = typedArray.getObject(runtime);
+  auto &binding = bindings_.get(runtime);
+
+  if (isValid(runtime, binding, object)) {
+    return binding.view;
+  }
+
+  auto bufferObject = object.getPropertyAsObject(runtime, "buffer");
+  auto arrayBuffer = bufferObject.getArrayBuffer(runtime);
+  auto byteOffset =
+      static_cast<size_t>(object.getProperty(runtime, "byteOffset").asNumber());
+  auto byteLength =
+      static_cast<size_t>(object.getProperty(runtime, "byteLength").asNumber());
+
+  binding.bufferData = arrayBuffer.data(runtime);
+  binding.bufferSize = arrayBuffer.size(runtime);
+  binding.view = {binding.bufferData + byteOffset, byteLength};
+  binding.typedArray.emplace(runtime, object);
+  binding.arrayBuffer.emplace(runtime, bufferObject);
+  return binding.view;
+}
+
+bool TypedArrayBinding::isValid(
+    jsi::Runtime &runtime,
+    Binding &binding,
+    const jsi::Object &object) {
+  if (!binding.typedArray.has_value()) {
+    return false;
+  }
+
+  auto typedArray = binding.typedArray->lock(runtime);
+  if (!typedArray.isObject() ||
+      !jsi::Object::strictEquals(
+          runtime, typedArray.getObject(runtime), object)) {
+    return false;
+  }
+
+  // A detached buffer reports no data, a resized one a different size, the
+  // view of either has to be resolved again. The buffer is alive as long as
+  // the array is, lock only fails if the array was collected in between.
+  auto bufferObject = binding.arrayBuffer->lock(runtime);
+  if (!bufferObject.isObject()) {
+    return false;
+  }
+
+  auto arrayBuffer = bufferObject.getObject(runtime).getArrayBuffer(runtime);
+  return arrayBuffer.data(runtime) == binding.bufferData &&
+      arrayBuffer.size(runtime) == binding.bufferSize;
+}
+
+} // namespace audioapi
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <audioapi/jsi/RuntimeAwareCache.h>
+
+#include <jsi/jsi.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace audioapi {
+
+using namespace facebook;
+
+/**
+ * Resolves the memory behind typed arrays passed from JS to a host function.
+ * The last typed array is remembered with its data pointer, passing the same
+ * array again (the common case of a visualisation reusing its array every
+ * frame) costs an identity check and a look at its ArrayBuffer instead of
+ * looking up its buffer, byteOffset and byteLength. The binding is rebuilt when
+ * a different array is passed or the buffer has been detached or resized.
+ * Both the array and its buffer are held weakly, the binding never keeps them
+ * alive.
+ */
+class TypedArrayBinding {
+ public:
+  struct View {
+    uint8_t *data = nullptr;
+    size_t byteLength = 0;
+  };
+
+  View bind(jsi::Runtime &runtime, const jsi::Value &typedArray);
+
+ private:
+  struct Binding {
+    std::optional<jsi::WeakObject> typedArray;
+    std::optional<jsi::WeakObject> arrayBuffer;
+    // data and size of the ArrayBuffer when the view was resolved
+    uint8_t *bufferData = nullptr;
+    size_t bufferSize = 0;
+    View view;
+  };
+
+  // whether the binding still describes the memory of the given array
+  static bool isValid(
+      jsi::Runtime &runtime,
+      Binding &binding,
+      const jsi::Object &object);
+
+  RuntimeAwareCache<Binding> bindings_;
+};
+
+} // namespace audioapi
@@ -51,111 +51,182 @@ int64_t seek_packet(void *opaque, int64_t offset, int whence) {
   return ctx->pos;
 }
 
-std::vector<int16_t> readAllPcmFrames(
+namespace {
+
+// Returns a bus of the given size holding the first framesToKeep frames.
+std::shared_ptr<AudioBus> resizeAudioBus(
+    const std::shared_ptr<AudioBus> &audioBus,
+    size_t size,
+    size_t framesToKeep) {
+  auto resizedBus = std::make_shared<AudioBus>(
+      size, audioBus->getNumberOfChannels(), audioBus->getSampleRate());
+  resizedBus->copy(audioBus.get(), 0, 0, std::min(framesToKeep, size));
+  return resizedBus;
+}
+
+// Length of the stream at out_sample_rate, 0 if the container does not know.
+size_t estimateFrames(
+    AVFormatContext *fmt_ctx,
+    int audio_stream_index,
+    int out_sample_rate) {
+  AVStream *stream = fmt_ctx->streams[audio_stream_index];
+  if (stream->duration != AV_NOPTS_VALUE && stream->duration > 0) {
+    return static_cast<size_t>(av_rescale_q(
+        stream->duration, stream->time_base, AVRational{1, out_sample_rate}));
+  }
+  if (fmt_ctx->duration != AV_NOPTS_VALUE && fmt_ctx->duration > 0) {
+    return static_cast<size_t>(
+        av_rescale(fmt_ctx->duration, out_sample_rate, AV_TIME_BASE));
+  }
+  return 0;
+}
+
+// Grows the bus when frames more frames do not fit after framesRead.
+void reserveFrames(
+    std::shared_ptr<AudioBus> &audioBus,
+    size_t framesRead,
+    size_t frames) {
+  auto size = audioBus->getSize();
+  auto required = framesRead + frames;
+  if (required > size) {
+    audioBus = resizeAudioBus(
+        audioBus, std::max(required, size + size / 2), framesRead);
+  }
+}
+
+// Converts frame to planar float and appends it to the bus after framesRead.
+// Without a resampler swr writes straight into the bus, otherwise into chunk,
+// which dsp::Resampler converts into the bus. A null frame drains the samples
+// buffered in swr and in the resampler.
+bool convertFrame(
+    SwrContext *swr_ctx,
+    const AVFrame *frame,
+    dsp::Resampler *resampler,
+    std::shared_ptr<AudioBus> &chunk,
+    std::shared_ptr<AudioBus> &audioBus,
+    std::vector<uint8_t *> &out_data,
+    size_t &framesRead) {
+  int in_samples = frame != nullptr ? frame->nb_samples : 0;
+  int out_samples = swr_get_out_samples(swr_ctx, in_samples);
+  if (out_samples < 0) {
+    return false;
+  }
+
+  auto &target = resampler != nullptr ? chunk : audioBus;
+  auto targetStart = resampler != nullptr ? 0 : framesRead;
+  reserveFrames(target, targetStart, static_cast<size_t>(out_samples));
+
+  for (size_t ch = 0; ch < out_data.size(); ++ch) {
+    out_data[ch] = reinterpret_cast<uint8_t *>(
+        target->getChannel(static_cast<int>(ch))->getData() + targetStart);
+  }
+
+  int converted_samples = out_samples == 0
+      ? 0
+      : swr_convert(
+            swr_ctx,
+            out_data.data(),
+            out_samples,
+            frame != nullptr ? (const uint8_t **)frame->data : nullptr,
+            in_samples);
+  if (converted_samples < 0) {
+    return false;
+  }
+
+  if (resampler == nullptr) {
+    framesRead += converted_samples;
+    return true;
+  }
+
+  auto frames = static_cast<size_t>(converted_samples);
+  reserveFrames(audioBus, framesRead, resampler->getMaxOutputFrames(frames));
+  framesRead += resampler->process(*chunk, 0, frames, *audioBus, framesRead);
+
+  if (frame == nullptr) {
+    reserveFrames(audioBus, framesRead, resampler->getMaxOutputFrames(0));
+    framesRead += resampler->flush(*audioBus, framesRead);
+  }
+  return true;
+}
+
+} // namespace
+
+std::shared_ptr<AudioBus> readAllPcmFrames(
     AVFormatContext *fmt_ctx,
     AVCodecContext *codec_ctx,
     int out_sample_rate,
     int audio_stream_index,
-    int channels,
-    size_t &framesRead) {
-  std::vector<int16_t> buffer;
+    int channels) {
   SwrContext *swr_ctx = swr_alloc();
   if (swr_ctx == nullptr) {
-    return buffer;
+    return nullptr;
   }
 
   av_opt_set_chlayout(swr_ctx, "in_chlayout", &codec_ctx->ch_layout, 0);
   av_opt_set_int(swr_ctx, "in_sample_rate", codec_ctx->sample_rate, 0);
   av_opt_set_sample_fmt(swr_ctx, "in_sample_fmt", codec_ctx->sample_fmt, 0);
 
+  // Planar float output is written directly into the channels of the bus.
+  // swr keeps the rate of the stream, every decoded frame is converted by
+  // dsp::Resampler on its way to the bus.
+  int in_sample_rate = codec_ctx->sample_rate;
   AVChannelLayout out_ch_layout;
   av_channel_layout_default(&out_ch_layout, channels);
   av_opt_set_chlayout(swr_ctx, "out_chlayout", &out_ch_layout, 0);
-  av_opt_set_int(swr_ctx, "out_sample_rate", out_sample_rate, 0);
-  av_opt_set_sample_fmt(swr_ctx, "out_sample_fmt", AV_SAMPLE_FMT_S16, 0);
+  av_opt_set_int(swr_ctx, "out_sample_rate", in_sample_rate, 0);
+  av_opt_set_sample_fmt(swr_ctx, "out_sample_fmt", AV_SAMPLE_FMT_FLTP, 0);
 
   if (swr_init(swr_ctx) < 0) {
     swr_free(&swr_ctx);
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return nullptr;
   }
 
   AVPacket *packet = av_packet_alloc();
   AVFrame *frame = av_frame_alloc();
-  
+
   if (packet == nullptr || frame == nullptr) {
     if (packet != nullptr) av_packet_free(&packet);
     if (frame != nullptr) av_frame_free(&frame);
     swr_free(&swr_ctx);
     av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+    return nullptr;
   }
 
-  // Allocate buffer for resampled data
-  uint8_t **resampled_data = nullptr;
-  int max_resampled_samples = 4096; // Initial size
-  int ret = av_samples_alloc_array_and_samples(
-      &resampled_data,
-      nullptr,
-      channels,
-      max_resampled_samples,
-      AV_SAMPLE_FMT_S16,
-      0);
-
-  if (ret < 0) {
-    av_frame_free(&frame);
-    av_packet_free(&packet);
-    swr_free(&swr_ctx);
-    av_channel_layout_uninit(&out_ch_layout);
-    return buffer;
+  std::unique_ptr<dsp::Resampler> resampler;
+  std::shared_ptr<AudioBus> chunk;
+  if (in_sample_rate != out_sample_rate) {
+    resampler = std::make_unique<dsp::Resampler>(
+        channels,
+        static_cast<float>(in_sample_rate),
+        static_cast<float>(out_sample_rate),
+        dsp::Resampler::Quality::HIGH);
+    chunk = std::make_shared<AudioBus>(
+        4096, channels, static_cast<float>(in_sample_rate));
   }
 
-  framesRead = 0;
+  auto audioBus = std::make_shared<AudioBus>(
+      std::max(
+          estimateFrames(fmt_ctx, audio_stream_index, out_sample_rate),
+          static_cast<size_t>(4096)),
+      channels,
+      static_cast<float>(out_sample_rate));
+  std::vector<uint8_t *> out_data(channels);
+  size_t framesRead = 0;
+  bool ok = true;
 
-  while (av_read_frame(fmt_ctx, packet) >= 0) {
+  while (ok && av_read_frame(fmt_ctx, packet) >= 0) {
     if (packet->stream_index == audio_stream_index) {
       if (avcodec_send_packet(codec_ctx, packet) == 0) {
-        while (avcodec_receive_frame(codec_ctx, frame) == 0) {
-          // Check if we need more buffer space
-          int out_samples = swr_get_out_samples(swr_ctx, frame->nb_samples);
-          if (out_samples > max_resampled_samples) {
-            if (resampled_data != nullptr) {
-              av_freep(&resampled_data[0]);
-              av_freep(&resampled_data);
-            }
-
-            max_resampled_samples = out_samples;
-            ret = av_samples_alloc_array_and_samples(
-                &resampled_data,
-                nullptr,
-                channels,
-                max_resampled_samples,
-                AV_SAMPLE_FMT_S16,
-                0);
-            
-            if (ret < 0) {
-              break; // Exit on allocation failure
-            }
-          }
-
-          int converted_samples = swr_convert(
+        while (ok && avcodec_receive_frame(codec_ctx, frame) == 0) {
+          ok = convertFrame(
               swr_ctx,
-              resampled_data,
-              max_resampled_samples,
-              (const uint8_t **)frame->data,
-              frame->nb_samples);
-
-          if (converted_samples > 0) {
-            size_t current_size = buffer.size();
-            size_t new_samples = converted_samples * channels;
-            buffer.resize(current_size + new_samples);
-            memcpy(
-                buffer.data() + current_size,
-                resampled_data[0],
-                new_samples * sizeof(int16_t));
-            
-            framesRead += converted_samples;
-          }
+              frame,
+              resampler.get(),
+              chunk,
+              audioBus,
+              out_data,
+              framesRead);
         }
       }
     }
@@ -164,61 +235,46 @@ std::vector<int16_t> readAllPcmFrames(
 
   // Flush decoder
   avcodec_send_packet(codec_ctx, nullptr);
-  while (avcodec_receive_frame(codec_ctx, frame) == 0) {
-    int out_samples = swr_get_out_samples(swr_ctx, frame->nb_samples);
-    if (out_samples > max_resampled_samples) {
-      if (resampled_data != nullptr) {
-        av_freep(&resampled_data[0]);
-        av_freep(&resampled_data);
-      }
-
-      max_resampled_samples = out_samples;
-      ret = av_samples_alloc_array_and_samples(
-          &resampled_data,
-          nullptr,
-          channels,
-          max_resampled_samples,
-          AV_SAMPLE_FMT_S16,
-          0);
-      
-      if (ret < 0) {
-        break;
-      }
-    }
-
-    int converted_samples = swr_convert(
+  while (ok && avcodec_receive_frame(codec_ctx, frame) == 0) {
+    ok = convertFrame(
         swr_ctx,
-        resampled_data,
-        max_resampled_samples,
-        (const uint8_t **)frame->data,
-        frame->nb_samples);
-
-    if (converted_samples > 0) {
-      size_t current_size = buffer.size();
-      size_t new_samples = converted_samples * channels;
-      buffer.resize(current_size + new_samples);
-      memcpy(
-          buffer.data() + current_size,
-          resampled_data[0],
-          new_samples * sizeof(int16_t));
-      
-      framesRead += converted_samples;
-    }
+        frame,
+        resampler.get(),
+        chunk,
+        audioBus,
+        out_data,
+        framesRead);
   }
 
-  if (resampled_data != nullptr) {
-    av_freep(&resampled_data[0]);
-    av_freep(&resampled_data);
+  // Flush resampler
+  if (ok) {
+    convertFrame(
+        swr_ctx,
+        nullptr,
+        resampler.get(),
+        chunk,
+        audioBus,
+        out_data,
+        framesRead);
   }
+
   swr_free(&swr_ctx);
   av_channel_layout_uninit(&out_ch_layout);
   av_frame_free(&frame);
   av_packet_free(&packet);
 
-  return buffer;
+  if (framesRead == 0) {
+    return nullptr;
+  }
+
+  if (framesRead != audioBus->getSize()) {
+    audioBus = resizeAudioBus(audioBus, framesRead, framesRead);
+  }
+
+  return audioBus;
 }
 
-std::vector<int16_t> decodeWithMemoryBlock(const void *data, size_t size, const int channel_count, int sample_rate) {
+std::shared_ptr<AudioBus> decodeWithMemoryBlock(const void *data, size_t size, const int channel_count, int sample_rate) {
     if (data == nullptr || size == 0) {
         return {};
     }
@@ -323,23 +379,18 @@ std::vector<int16_t> decodeWithMemoryBlock(const void *data, size_t size, const
     }
 
     // Decode all frames
-    size_t framesRead = 0;
-    std::vector<int16_t> decoded_buffer = readAllPcmFrames(
-        fmt_ctx, codec_ctx, sample_rate, audio_stream_index, channel_count, framesRead);
+    auto audioBus = readAllPcmFrames(
+        fmt_ctx, codec_ctx, sample_rate, audio_stream_index, channel_count);
 
     // Cleanup - Note: avio_context_free will free the io_buffer
     avcodec_free_context(&codec_ctx);
     avformat_close_input(&fmt_ctx);
     avio_context_free(&avio_ctx);
 
-    if (framesRead == 0 || decoded_buffer.empty()) {
-      return {};
-    }
-
-    return decoded_buffer;
+    return audioBus;
 }
 
-std::vector<int16_t> decodeWithFilePath(const std::string &path, const int channel_count, int sample_rate) {
+std::shared_ptr<AudioBus> decodeWithFilePath(const std::string &path, const int channel_count, int sample_rate) {
   if (path.empty()) {
       return {};
   }
@@ -388,18 +439,13 @@ std::vector<int16_t> decodeWithFilePath(const std::string &path, const int chann
       return {};
   }
 
-  size_t framesRead = 0;
-  std::vector<int16_t> decoded_buffer = readAllPcmFrames(
-      fmt_ctx, codec_ctx, sample_rate, audio_stream_index, channel_count, framesRead);
+  auto audioBus = readAllPcmFrames(
+      fmt_ctx, codec_ctx, sample_rate, audio_stream_index, channel_count);
 
   avcodec_free_context(&codec_ctx);
   avformat_close_input(&fmt_ctx);
 
-  if (framesRead == 0 || decoded_buffer.empty()) {
-      return {};
-  }
-
-  return decoded_buffer;
+  return audioBus;
 }
 
 } // namespace audioapi::ffmpegdecoder
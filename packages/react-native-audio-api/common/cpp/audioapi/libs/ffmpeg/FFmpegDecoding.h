@@ -8,6 +8,8 @@
  * comply with the terms of the LGPL for FFmpeg itself.
  */
 
+#include <audioapi/dsp/Resampler.h>
+#include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 #include <iostream>
 #include <memory>
@@ -30,8 +32,9 @@ struct MemoryIOContext {
 
 int read_packet(void *opaque, uint8_t *buf, int buf_size);
 int64_t seek_packet(void *opaque, int64_t offset, int whence);
-std::vector<int16_t> readAllPcmFrames(AVFormatContext *fmt_ctx, AVCodecContext *codec_ctx, int out_sample_rate, int audio_stream_index, int channels, size_t &framesRead);
-std::vector<int16_t> decodeWithMemoryBlock(const void *data, size_t size, const int channel_count, int sample_rate);
-std::vector<int16_t> decodeWithFilePath(const std::string &path, const int channel_count, int sample_rate);
+// Decoded audio is resampled to planar float and written straight into the returned bus, nullptr on failure.
+std::shared_ptr<AudioBus> readAllPcmFrames(AVFormatContext *fmt_ctx, AVCodecContext *codec_ctx, int out_sample_rate, int audio_stream_index, int channels);
+std::shared_ptr<AudioBus> decodeWithMemoryBlock(const void *data, size_t size, const int channel_count, int sample_rate);
+std::shared_ptr<AudioBus> decodeWithFilePath(const std::string &path, const int channel_count, int sample_rate);
 
 } // namespace audioapi::ffmpegdecoder
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <audioapi/utils/AllocationGuard.h>
+
+#if RN_AUDIO_API_DEBUG_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local size_t threadAllocationCount = 0;
+
+void *countedAllocate(size_t size) {
+  threadAllocationCount += 1;
+
+  if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+
+  throw std::bad_alloc();
+}
+
+void *countedAlignedAllocate(size_t size, std::align_val_t alignment) {
+  threadAllocationCount += 1;
+
+  auto align = static_cast<size_t>(alignment);
+  size = (size + align - 1) / align * align;
+
+  if (void *ptr = std::aligned_alloc(align, size == 0 ? align : size)) {
+    return ptr;
+  }
+
+  throw std::bad_alloc();
+}
+} // namespace
+
+namespace audioapi {
+
+size_t getThreadAllocationCount() {
+  return threadAllocationCount;
+}
+
+} // namespace audioapi
+
+void *operator new(size_t size) {
+  return countedAllocate(size);
+}
+
+void *operator new[](size_t size) {
+  return countedAllocate(size);
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+  return countedAlignedAllocate(size, alignment);
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+  return countedAlignedAllocate(size, alignment);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cassert>
+
+/// Define RN_AUDIO_API_DEBUG_ALLOCATIONS=1 to count heap allocations per thread
+/// (global operator new is replaced) and assert that none happen while
+/// an AllocationGuard is alive. Intended for debug builds only.
+#ifndef RN_AUDIO_API_DEBUG_ALLOCATIONS
+  #define RN_AUDIO_API_DEBUG_ALLOCATIONS 0
+#endif
+
+namespace audioapi {
+
+#if RN_AUDIO_API_DEBUG_ALLOCATIONS
+/// @brief Returns the number of heap allocations made by the calling thread.
+size_t getThreadAllocationCount();
+
+/// @brief Asserts that the calling thread does not allocate during the guard lifetime.
+class AllocationGuard {
+ public:
+  AllocationGuard() : allocationCount_(getThreadAllocationCount()) {}
+  ~AllocationGuard() {
+    assert(getThreadAllocationCount() == allocationCount_ && "Heap allocation on the audio thread");
+  }
+
+  AllocationGuard(const AllocationGuard &) = delete;
+  AllocationGuard &operator=(const AllocationGuard &) = delete;
+
+ private:
+  size_t allocationCount_;
+};
+#else
+/// @brief No-op unless RN_AUDIO_API_DEBUG_ALLOCATIONS is enabled.
+class AllocationGuard {
+ public:
+  AllocationGuard() = default;
+  AllocationGuard(const AllocationGuard &) = delete;
+  AllocationGuard &operator=(const AllocationGuard &) = delete;
+};
+#endif
+
+} // namespace audioapi
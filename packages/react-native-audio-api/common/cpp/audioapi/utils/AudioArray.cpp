@@ -1,12 +1,21 @@
 #include <audioapi/dsp/VectorMath.h>
 #include <audioapi/utils/AudioArray.h>
 
+#include <new>
+#include <utility>
+
 namespace audioapi {
 
 AudioArray::AudioArray(size_t size) : data_(nullptr), size_(size) {
   resize(size);
 }
 
+AudioArray::AudioArray(
+    float *data,
+    size_t size,
+    std::shared_ptr<const void> storage)
+    : data_(data), size_(size), storage_(std::move(storage)) {}
+
 AudioArray::AudioArray(const AudioArray &other) : data_(nullptr), size_(0) {
   resize(other.size_);
 
@@ -14,8 +23,8 @@ AudioArray::AudioArray(const AudioArray &other) : data_(nullptr), size_(0) {
 }
 
 AudioArray::~AudioArray() {
-  if (data_) {
-    delete[] data_;
+  if (data_ && !storage_) {
+    deallocate(data_);
     data_ = nullptr;
   }
 }
@@ -47,18 +56,24 @@ void AudioArray::normalize() {
 }
 
 void AudioArray::resize(size_t size) {
+  if (storage_) {
+    storage_.reset();
+    data_ = nullptr;
+    size_ = 0;
+  }
+
   if (size == size_) {
     if (!data_) {
-      data_ = new float[size];
+      data_ = allocate(size);
     }
 
     zero(0, size);
     return;
   }
 
-  delete[] data_;
+  deallocate(data_);
   size_ = size;
-  data_ = new float[size_];
+  data_ = allocate(size_);
 
   zero(0, size_);
 }
@@ -118,4 +133,15 @@ void AudioArray::copy(
       length * sizeof(float));
 }
 
+float *AudioArray::allocate(size_t size) {
+  return static_cast<float *>(::operator new[](
+      size * sizeof(float), std::align_val_t{ALIGNMENT}));
+}
+
+void AudioArray::deallocate(float *data) {
+  if (data) {
+    ::operator delete[](data, std::align_val_t{ALIGNMENT});
+  }
+}
+
 } // namespace audioapi
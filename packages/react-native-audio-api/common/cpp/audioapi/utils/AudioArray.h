@@ -9,7 +9,14 @@ namespace audioapi {
 
 class AudioArray {
  public:
+  // Alignment of the samples, matches cache line size and widest SIMD registers.
+  static constexpr size_t ALIGNMENT = 64;
+
   explicit AudioArray(size_t size);
+  // Wraps size samples at data, which are kept alive by storage rather than
+  // owned by the array, e.g. a memory mapped file. data has to be aligned to
+  // ALIGNMENT. A resize replaces them with an owned allocation.
+  AudioArray(float *data, size_t size, std::shared_ptr<const void> storage);
   AudioArray(const AudioArray &other);
   ~AudioArray();
 
@@ -46,6 +53,11 @@ class AudioArray {
  protected:
   float *data_;
   size_t size_;
+  // set only for borrowed samples
+  std::shared_ptr<const void> storage_;
+
+  static float *allocate(size_t size);
+  static void deallocate(float *data);
 };
 
 } // namespace audioapi
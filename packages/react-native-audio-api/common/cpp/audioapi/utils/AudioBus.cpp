@@ -3,6 +3,8 @@
 #include <audioapi/utils/AudioArray.h>
 #include <audioapi/utils/AudioBus.h>
 
+#include <utility>
+
 // Implementation of channel summing/mixing is based on the WebKit approach,
 // source:
 // https://github.com/WebKit/WebKit/blob/main/Source/WebCore/platform/audio/AudioBus.cpp
@@ -22,6 +24,14 @@ AudioBus::AudioBus(size_t size, int numberOfChannels, float sampleRate)
   createChannels();
 }
 
+AudioBus::AudioBus(
+    std::vector<std::shared_ptr<AudioArray>> channels,
+    float sampleRate)
+    : channels_(std::move(channels)),
+      numberOfChannels_(static_cast<int>(channels_.size())),
+      sampleRate_(sampleRate),
+      size_(channels_.empty() ? 0 : channels_[0]->getSize()) {}
+
 AudioBus::AudioBus(const AudioBus &other) {
   numberOfChannels_ = other.numberOfChannels_;
   sampleRate_ = other.sampleRate_;
@@ -25,6 +25,8 @@ class AudioBus {
   };
 
   explicit AudioBus(size_t size, int numberOfChannels, float sampleRate);
+  // Takes channels of the same size, e.g. ones borrowing external memory.
+  AudioBus(std::vector<std::shared_ptr<AudioArray>> channels, float sampleRate);
   AudioBus(const AudioBus &other);
 
   ~AudioBus();
@@ -0,0 +1,111 @@
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/AudioBusArena.h>
+
+#include <algorithm>
+#include <new>
+#include <thread>
+
+namespace audioapi {
+
+// Channels are laid out back to back, each of them stays aligned.
+static_assert(RENDER_QUANTUM_SIZE * sizeof(float) % AudioArray::ALIGNMENT == 0);
+
+AudioBusArena::AudioBusArena(float sampleRate, size_t initialCapacity)
+    : sampleRate_(sampleRate),
+      buses_(MAX_NUMBER_OF_BUSES),
+      isAcquired_(MAX_NUMBER_OF_BUSES, false) {
+  reserve(initialCapacity);
+}
+
+void AudioBusArena::reserve(size_t numberOfNodes) {
+  std::lock_guard reserveLock(reserveMutex_);
+
+  numberOfNodes = std::min(numberOfNodes, MAX_NUMBER_OF_BUSES / 2);
+  if (numberOfNodes <= numberOfReservedNodes_) {
+    return;
+  }
+
+  // One slab for the mono and stereo bus of every new node, it is released
+  // once the last bus borrowing it is destroyed.
+  auto numberOfSamples =
+      (numberOfNodes - numberOfReservedNodes_) * 3 * RENDER_QUANTUM_SIZE;
+  auto *samples = static_cast<float *>(::operator new(
+      numberOfSamples * sizeof(float),
+      std::align_val_t{AudioArray::ALIGNMENT}));
+  std::shared_ptr<const void> slab(samples, [](const void *data) {
+    ::operator delete(
+        const_cast<void *>(data), std::align_val_t{AudioArray::ALIGNMENT});
+  });
+
+  auto createBus = [this, &samples, &slab](int numberOfChannels) {
+    std::vector<std::shared_ptr<AudioArray>> channels;
+    for (int i = 0; i < numberOfChannels; i += 1) {
+      channels.push_back(
+          std::make_shared<AudioArray>(samples, RENDER_QUANTUM_SIZE, slab));
+      samples += RENDER_QUANTUM_SIZE;
+    }
+
+    return std::make_unique<AudioBus>(std::move(channels), sampleRate_);
+  };
+
+  auto size = size_.load(std::memory_order_relaxed);
+
+  for (; numberOfReservedNodes_ < numberOfNodes; numberOfReservedNodes_ += 1) {
+    buses_[size] = createBus(1);
+    buses_[size + 1] = createBus(2);
+    size += 2;
+  }
+
+  size_.store(size, std::memory_order_release);
+}
+
+size_t AudioBusArena::acquire(int numberOfChannels) {
+  auto result = NO_BUS;
+  auto size = size_.load(std::memory_order_acquire);
+
+  lock();
+
+  for (size_t i = 0; i < size; i += 1) {
+    if (!isAcquired_[i] && buses_[i]->getNumberOfChannels() == numberOfChannels) {
+      isAcquired_[i] = true;
+      result = i;
+      break;
+    }
+  }
+
+  unlock();
+
+  if (result != NO_BUS) {
+    buses_[result]->zero();
+  }
+
+  return result;
+}
+
+void AudioBusArena::release(size_t index) {
+  lock();
+  isAcquired_[index] = false;
+  unlock();
+}
+
+AudioBus *AudioBusArena::getBus(size_t index) const {
+  return buses_[index].get();
+}
+
+size_t AudioBusArena::getCapacity() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+void AudioBusArena::lock() {
+  while (isAcquiring_.test_and_set(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+}
+
+void AudioBusArena::unlock() {
+  isAcquiring_.clear(std::memory_order_release);
+}
+
+} // namespace audioapi
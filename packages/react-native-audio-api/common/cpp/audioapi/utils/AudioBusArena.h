@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief Context-owned pool of render quantum sized buses.
+/// Nodes acquire a bus once and keep reusing it every render quantum,
+/// so no bus is created on the audio thread in steady state.
+/// Buses are handed out by index and stay owned by the arena, their samples live in
+/// slabs allocated by reserve, every channel aligned to AudioArray::ALIGNMENT.
+/// Nodes keep the arena alive until they hand their bus back, which keeps nodes outliving the context safe.
+/// @note A node holds at most one bus of the arena, so a mono and a stereo bus are reserved for every node
+/// when it is created. Mono and stereo layouts never run out, see acquire for other layouts.
+/// @note acquire should be only used from Audio thread or render workers (or when rendering is stopped),
+/// reserve from JavaScript/HostObjects thread.
+class AudioBusArena {
+ public:
+  static constexpr size_t NO_BUS = SIZE_MAX;
+
+  explicit AudioBusArena(float sampleRate, size_t initialCapacity = 32);
+
+  /// @brief Makes sure there is a mono and a stereo bus for every node.
+  /// @param numberOfNodes The number of nodes alive.
+  /// @note Buses are published to the audio thread without reallocating the storage it reads.
+  void reserve(size_t numberOfNodes);
+
+  /// @brief Acquires a zeroed bus with given number of channels.
+  /// @param numberOfChannels The number of channels of the bus.
+  /// @return Index of the bus, used by the caller until it is released, or NO_BUS if no bus is free.
+  /// @note It only happens for layouts other than mono and stereo or once MAX_NUMBER_OF_BUSES is reached,
+  /// the caller has to allocate a bus of its own then.
+  size_t acquire(int numberOfChannels);
+
+  /// @brief Hands an acquired bus back to the arena.
+  /// @param index Index returned by acquire.
+  void release(size_t index);
+
+  /// @brief Returns the acquired bus at index, owned by the arena.
+  [[nodiscard]] AudioBus *getBus(size_t index) const;
+
+  [[nodiscard]] size_t getCapacity() const;
+
+ private:
+  static constexpr size_t MAX_NUMBER_OF_BUSES = 4096;
+
+  float sampleRate_;
+  // sized once, only slots below size_ are read by the audio thread
+  std::vector<std::unique_ptr<AudioBus>> buses_;
+  std::vector<bool> isAcquired_;
+  std::atomic<size_t> size_ = 0;
+  // render workers may acquire concurrently, it happens only on layout changes
+  std::atomic_flag isAcquiring_ = ATOMIC_FLAG_INIT;
+
+  std::mutex reserveMutex_;
+  size_t numberOfReservedNodes_ = 0;
+
+  void lock();
+  void unlock();
+};
+
+} // namespace audioapi
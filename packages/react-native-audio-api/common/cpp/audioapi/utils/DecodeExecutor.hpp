@@ -0,0 +1,149 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace audioapi {
+
+/// @brief Runs the decoding tasks of a context on a fixed number of worker threads.
+/// @note Tasks wait in two lanes, a free worker always takes the oldest task of the high priority lane first.
+/// Low priority is meant for prefetching, which should not delay audio that is needed right away.
+/// @note A task that has not started yet can be cancelled, its onCancel callback is invoked instead of the task.
+/// Tasks still pending when the executor is destroyed are cancelled the same way, running ones are waited for.
+/// @note Unlike ThreadPool the executor is thread-safe, tasks can be scheduled and cancelled from any thread.
+class DecodeExecutor {
+ public:
+  enum class Priority { HIGH, LOW };
+
+  /// @brief Construct a new DecodeExecutor
+  /// @param numThreads The number of worker threads to create, at least one.
+  explicit DecodeExecutor(size_t numThreads) {
+    numThreads = std::max(numThreads, static_cast<size_t>(1));
+    workers_.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+      workers_.emplace_back(&DecodeExecutor::workerThreadFunc, this);
+    }
+  }
+
+  ~DecodeExecutor() {
+    std::vector<Task> pendingTasks;
+    {
+      std::lock_guard lock(mutex_);
+      isRunning_ = false;
+      for (auto &lane : lanes_) {
+        std::move(lane.begin(), lane.end(), std::back_inserter(pendingTasks));
+        lane.clear();
+      }
+      epoch_.fetch_add(1, std::memory_order_release);
+    }
+    epoch_.notify_all();
+
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+
+    for (auto &task : pendingTasks) {
+      task.onCancel();
+    }
+  }
+
+  DecodeExecutor(const DecodeExecutor &) = delete;
+  DecodeExecutor &operator=(const DecodeExecutor &) = delete;
+
+  [[nodiscard]] size_t getNumberOfThreads() const {
+    return workers_.size();
+  }
+
+  /// @brief Schedule a task to be executed by one of the workers
+  /// @param id Identifier of the task, used to cancel it. Chosen by the caller, it should be unique among pending tasks.
+  /// @param priority Lane of the task.
+  /// @param task The task to be executed, it should not throw exceptions.
+  /// @param onCancel Invoked instead of the task when it gets cancelled, on the cancelling thread.
+  void schedule(uint64_t id, Priority priority, std::function<void()> &&task, std::function<void()> &&onCancel) {
+    {
+      std::lock_guard lock(mutex_);
+      lanes_[static_cast<size_t>(priority)].push_back(Task{id, std::move(task), std::move(onCancel)});
+      epoch_.fetch_add(1, std::memory_order_release);
+    }
+    epoch_.notify_one();
+  }
+
+  /// @brief Cancels a task that has not started yet
+  /// @param id Identifier the task was scheduled with.
+  /// @return false if there is no such pending task, e.g. it is already running or done.
+  bool cancel(uint64_t id) {
+    Task cancelledTask;
+    {
+      std::lock_guard lock(mutex_);
+      bool found = false;
+      for (auto &lane : lanes_) {
+        auto it = std::find_if(lane.begin(), lane.end(), [id](const Task &task) { return task.id == id; });
+        if (it != lane.end()) {
+          cancelledTask = std::move(*it);
+          lane.erase(it);
+          found = true;
+          break;
+        }
+      }
+
+      if (!found) {
+        return false;
+      }
+    }
+
+    cancelledTask.onCancel();
+    return true;
+  }
+
+ private:
+  struct Task {
+    uint64_t id = 0;
+    std::function<void()> run;
+    std::function<void()> onCancel;
+  };
+
+  std::mutex mutex_;
+  // bumped under the mutex on every change a sleeping worker has to notice
+  std::atomic<uint32_t> epoch_{0};
+  // indexed by Priority
+  std::deque<Task> lanes_[2];
+  bool isRunning_ = true;
+  std::vector<std::thread> workers_;
+
+  void workerThreadFunc() {
+    while (true) {
+      Task task;
+      uint32_t seenEpoch = 0;
+      {
+        std::lock_guard lock(mutex_);
+        if (!isRunning_) {
+          return;
+        }
+
+        if (!lanes_[0].empty() || !lanes_[1].empty()) {
+          auto &lane = lanes_[0].empty() ? lanes_[1] : lanes_[0];
+          task = std::move(lane.front());
+          lane.pop_front();
+        } else {
+          seenEpoch = epoch_.load(std::memory_order_acquire);
+        }
+      }
+
+      if (!task.run) {
+        epoch_.wait(seenEpoch, std::memory_order_acquire);
+        continue;
+      }
+
+      task.run();
+    }
+  }
+};
+
+} // namespace audioapi
@@ -0,0 +1,94 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace audioapi {
+
+/// @brief Bounded queue of trivially copyable values, pushed from any number of threads and popped from one.
+/// @note Every slot carries a sequence number telling whether it is free for the next push or holds a value
+/// for the next pop. Producers claim a slot with a compare-exchange on the tail, so pushing never locks,
+/// never allocates and fails right away when the queue is full.
+/// @note Capacity is rounded up to a power of two, so the indices can grow forever and wrap with a mask.
+template <typename T>
+class MpscQueue {
+  static_assert(std::is_trivially_copyable_v<T>, "MpscQueue holds trivially copyable values only");
+
+ public:
+  explicit MpscQueue(size_t capacity) {
+    capacity_ = 1;
+    while (capacity_ < capacity) {
+      capacity_ <<= 1;
+    }
+
+    slots_ = std::make_unique<Slot[]>(capacity_);
+    for (size_t i = 0; i < capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+
+  [[nodiscard]] size_t getCapacity() const {
+    return capacity_;
+  }
+
+  /// @brief Appends a value, safe to call from any thread.
+  /// @return False when the queue is full, the value is not stored then.
+  bool tryPush(const T &value) {
+    auto tail = tail_.load(std::memory_order_relaxed);
+
+    while (true) {
+      auto &slot = slots_[tail & (capacity_ - 1)];
+      auto sequence = slot.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(tail);
+
+      if (difference == 0) {
+        // the slot is free, claim it unless another producer was faster
+        if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(tail + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        // the slot still holds a value from the previous lap
+        return false;
+      } else {
+        tail = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// @brief Takes the oldest value, called only from the consuming thread.
+  /// @return False when the queue is empty or the oldest value is still being written.
+  bool tryPop(T &value) {
+    auto &slot = slots_[head_ & (capacity_ - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+      return false;
+    }
+
+    value = slot.value;
+    // frees the slot for the push one lap ahead
+    slot.sequence.store(head_ + capacity_, std::memory_order_release);
+    head_ += 1;
+
+    return true;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  size_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+
+  // producers and the consumer live on separate cache lines
+  alignas(64) std::atomic<size_t> tail_{0};
+  alignas(64) size_t head_ = 0;
+};
+
+} // namespace audioapi
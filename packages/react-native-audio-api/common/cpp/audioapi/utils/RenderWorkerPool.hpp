@@ -0,0 +1,176 @@
+#pragma once
+#include <audioapi/utils/AllocationGuard.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace audioapi {
+
+/// @brief A fork-join pool used by the audio thread to render independent parts of the graph in parallel.
+/// @note Tasks of a batch are split into contiguous ranges, one per participant (worker threads and the calling thread).
+/// @note A participant that runs out of its own range steals tasks from the other ranges.
+/// Tasks are claimed with a compare-and-swap on the range cursor, so neither claiming nor stealing takes a lock.
+/// @note The calling thread renders every task no worker has claimed yet, so it never waits for a worker to wake up,
+/// only for tasks already running on a worker. Workers run with audio priority on every platform,
+/// so those are not preempted by ordinary threads.
+/// @note Unlike ThreadPool there is no load balancer thread and no per-task allocation, the task is type-erased into a function pointer.
+/// @note IMPORTANT: run() is not thread-safe and should be called from a single thread only (the audio thread).
+class RenderWorkerPool {
+  // batch, end and next task of a range packed into one word, so a worker
+  // late for a batch can not claim a task of the next one
+  struct alignas(64) TaskRange {
+    std::atomic<uint64_t> cursor {0};
+  };
+
+  static constexpr int INDEX_BITS = 20;
+  static constexpr uint64_t INDEX_MASK = (uint64_t{1} << INDEX_BITS) - 1;
+  static constexpr uint64_t BATCH_MASK = (uint64_t{1} << (64 - 2 * INDEX_BITS)) - 1;
+
+  static uint64_t packCursor(uint64_t batch, uint64_t end, uint64_t next) {
+    return ((batch & BATCH_MASK) << (2 * INDEX_BITS)) | (end << INDEX_BITS) | next;
+  }
+
+ public:
+  /// @brief Construct a new RenderWorkerPool
+  /// @param numThreads The number of worker threads to create, the calling thread is an additional participant.
+  explicit RenderWorkerPool(size_t numThreads) : ranges_(numThreads + 1) {
+    workers_.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+      workers_.emplace_back(&RenderWorkerPool::workerThreadFunc, this, i + 1);
+    }
+  }
+
+  ~RenderWorkerPool() {
+    isRunning_.store(false, std::memory_order_release);
+    epoch_.fetch_add(1, std::memory_order_release);
+    epoch_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  RenderWorkerPool(const RenderWorkerPool &) = delete;
+  RenderWorkerPool &operator=(const RenderWorkerPool &) = delete;
+
+  [[nodiscard]] size_t getNumberOfThreads() const {
+    return workers_.size();
+  }
+
+  /// @brief Runs task(index) for every index in [0, numTasks) and waits for all of them to finish.
+  /// @param numTasks The number of tasks in the batch, less than 2^20.
+  /// @param task Callable invoked with the task index, it has to be safe to call concurrently for different indices.
+  /// @note The calling thread takes part in the batch, so it never idles while the workers render.
+  template <typename F>
+  void run(size_t numTasks, F &task) {
+    task_ = &task;
+    invoke_ = [](void *task, size_t index) { (*static_cast<F *>(task))(index); };
+    pendingTasks_.store(numTasks, std::memory_order_relaxed);
+
+    auto batch = epoch_.load(std::memory_order_relaxed) + 1;
+    auto numParticipants = ranges_.size();
+    for (size_t i = 0; i < numParticipants; ++i) {
+      // release, a worker claiming a task of this batch sees the task above
+      ranges_[i].cursor.store(
+          packCursor(batch, numTasks * (i + 1) / numParticipants, numTasks * i / numParticipants),
+          std::memory_order_release);
+    }
+
+    epoch_.store(batch, std::memory_order_release);
+    epoch_.notify_all();
+
+    execute(0, batch);
+
+    // Every task is claimed by now. Only tasks already running on a worker are
+    // waited for, workers that have not woken up yet hold none.
+    while (pendingTasks_.load(std::memory_order_acquire) != 0) {
+      std::this_thread::yield();
+    }
+  }
+
+ private:
+  std::vector<std::thread> workers_;
+  std::vector<TaskRange> ranges_;
+
+  void *task_ = nullptr;
+  void (*invoke_)(void *, size_t) = nullptr;
+
+  std::atomic<uint32_t> epoch_ {0};
+  std::atomic<size_t> pendingTasks_ {0};
+  std::atomic<bool> isRunning_ {true};
+
+  bool claim(TaskRange &range, uint64_t batch, size_t &index) {
+    auto cursor = range.cursor.load(std::memory_order_acquire);
+    while (true) {
+      auto next = cursor & INDEX_MASK;
+      auto end = (cursor >> INDEX_BITS) & INDEX_MASK;
+      if ((cursor >> (2 * INDEX_BITS)) != (batch & BATCH_MASK) || next >= end) {
+        return false;
+      }
+      if (range.cursor.compare_exchange_weak(
+              cursor, cursor + 1, std::memory_order_acquire, std::memory_order_acquire)) {
+        index = next;
+        return true;
+      }
+    }
+  }
+
+  void execute(size_t self, uint64_t batch) {
+    auto numParticipants = ranges_.size();
+    size_t index = 0;
+    // own range first, then steal from the others
+    for (size_t offset = 0; offset < numParticipants; ++offset) {
+      auto &range = ranges_[(self + offset) % numParticipants];
+      while (claim(range, batch, index)) {
+        invoke_(task_, index);
+        pendingTasks_.fetch_sub(1, std::memory_order_release);
+      }
+    }
+  }
+
+  static void raiseThreadPriority() {
+#if defined(__APPLE__)
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+#elif defined(__linux__)
+    // Real-time scheduling where permitted, otherwise the audio nice level
+    // (Android's THREAD_PRIORITY_URGENT_AUDIO), which apps are allowed to set.
+    sched_param param {};
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+      setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), -19);
+    }
+#endif
+  }
+
+  void workerThreadFunc(size_t self) {
+    raiseThreadPriority();
+
+    // epoch starts at 0, so a batch scheduled before the thread started is not missed
+    uint32_t seenEpoch = 0;
+    while (true) {
+      epoch_.wait(seenEpoch, std::memory_order_acquire);
+      seenEpoch = epoch_.load(std::memory_order_acquire);
+
+      if (!isRunning_.load(std::memory_order_acquire)) [[ unlikely ]] {
+        break;
+      }
+
+      // workers render the graph too, so they must not touch the heap either
+      [[maybe_unused]] AllocationGuard allocationGuard;
+      execute(self, seenEpoch);
+    }
+  }
+};
+
+} // namespace audioapi
@@ -0,0 +1,79 @@
+#include <audioapi/utils/SharedAudioRing.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace audioapi {
+
+// JS reads the indices as plain 32-bit words
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+SharedAudioRing::SharedAudioRing(size_t capacity)
+    : capacity_(std::bit_ceil(std::clamp(
+          capacity, static_cast<size_t>(1), static_cast<size_t>(1) << 30))),
+      memory_(std::make_unique<uint8_t[]>(getMemorySize())) {
+  auto *words = reinterpret_cast<uint32_t *>(memory_.get());
+  writeIndex_ = new (words + WRITE_INDEX) std::atomic<uint32_t>(0);
+  droppedFrames_ = new (words + DROPPED_FRAMES) std::atomic<uint32_t>(0);
+  readIndex_ = new (words + READ_INDEX) std::atomic<uint32_t>(0);
+  samples_ = reinterpret_cast<float *>(memory_.get() + HEADER_SIZE);
+}
+
+SharedAudioRing::~SharedAudioRing() = default;
+
+size_t SharedAudioRing::getCapacity() const {
+  return capacity_;
+}
+
+uint8_t *SharedAudioRing::getMemory() const {
+  return memory_.get();
+}
+
+size_t SharedAudioRing::getMemorySize() const {
+  return HEADER_SIZE + capacity_ * sizeof(float);
+}
+
+size_t SharedAudioRing::write(const float *source, size_t frames) {
+  auto writeIndex = writeIndex_->load(std::memory_order_relaxed);
+  auto readIndex = readIndex_->load(std::memory_order_acquire);
+  auto space = capacity_ - static_cast<uint32_t>(writeIndex - readIndex);
+
+  auto framesToWrite = std::min(frames, space);
+  if (framesToWrite < frames) {
+    droppedFrames_->fetch_add(
+        static_cast<uint32_t>(frames - framesToWrite),
+        std::memory_order_relaxed);
+  }
+
+  auto start = writeIndex & (capacity_ - 1);
+  auto firstPart = std::min(framesToWrite, capacity_ - start);
+  std::memcpy(samples_ + start, source, firstPart * sizeof(float));
+  std::memcpy(
+      samples_, source + firstPart, (framesToWrite - firstPart) * sizeof(float));
+
+  writeIndex_->store(
+      writeIndex + static_cast<uint32_t>(framesToWrite),
+      std::memory_order_release);
+  return framesToWrite;
+}
+
+size_t SharedAudioRing::getNumberOfAvailableFrames() const {
+  auto writeIndex = writeIndex_->load(std::memory_order_acquire);
+  auto readIndex = readIndex_->load(std::memory_order_relaxed);
+  return static_cast<uint32_t>(writeIndex - readIndex);
+}
+
+void SharedAudioRing::release(size_t frames) {
+  auto readIndex = readIndex_->load(std::memory_order_relaxed);
+  frames = std::min(frames, getNumberOfAvailableFrames());
+  readIndex_->store(
+      readIndex + static_cast<uint32_t>(frames), std::memory_order_release);
+}
+
+size_t SharedAudioRing::getNumberOfDroppedFrames() const {
+  return droppedFrames_->load(std::memory_order_relaxed);
+}
+
+} // namespace audioapi
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace audioapi {
+
+/// @brief Mono ring of audio frames shared by one native writing thread and JS, which reads it in place.
+/// @note The whole ring, indices included, is a single block of memory handed to JS as one ArrayBuffer:
+/// a header of HEADER_SIZE bytes followed by getCapacity() float samples. The header holds
+/// 32-bit atomics, the total numbers of frames written (word WRITE_INDEX), read (word READ_INDEX) and
+/// dropped because the ring was full (word DROPPED_FRAMES). Indices grow forever and wrap with the capacity.
+/// @note The writer never waits and never allocates, frames that do not fit are dropped and counted.
+/// The reader goes through getNumberOfAvailableFrames() and release(), which order its reads of the samples
+/// against the writes of the writer.
+class SharedAudioRing {
+ public:
+  // words of the header, the writer and reader ones are on separate cache lines
+  static constexpr size_t WRITE_INDEX = 0;
+  static constexpr size_t DROPPED_FRAMES = 1;
+  static constexpr size_t READ_INDEX = 32;
+  static constexpr size_t HEADER_SIZE = 192;
+
+  /// @note Capacity is rounded up to a power of two.
+  explicit SharedAudioRing(size_t capacity);
+  ~SharedAudioRing();
+
+  SharedAudioRing(const SharedAudioRing &) = delete;
+  SharedAudioRing &operator=(const SharedAudioRing &) = delete;
+
+  [[nodiscard]] size_t getCapacity() const;
+
+  /// @brief The header and the samples.
+  [[nodiscard]] uint8_t *getMemory() const;
+  [[nodiscard]] size_t getMemorySize() const;
+
+  /// @brief Appends frames, called from the writing thread.
+  /// @return Number of written frames, the rest is dropped when the ring is full.
+  size_t write(const float *source, size_t frames);
+
+  /// @brief Frames that can be read starting at the read index, called from the reading thread.
+  [[nodiscard]] size_t getNumberOfAvailableFrames() const;
+
+  /// @brief Moves the read index past frames the reader is done with, called from the reading thread.
+  void release(size_t frames);
+
+  [[nodiscard]] size_t getNumberOfDroppedFrames() const;
+
+ private:
+  size_t capacity_;
+  std::unique_ptr<uint8_t[]> memory_;
+
+  std::atomic<uint32_t> *writeIndex_;
+  std::atomic<uint32_t> *droppedFrames_;
+  std::atomic<uint32_t> *readIndex_;
+  float *samples_;
+};
+
+} // namespace audioapi
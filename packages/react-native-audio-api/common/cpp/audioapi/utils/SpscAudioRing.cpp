@@ -0,0 +1,104 @@
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/SpscAudioRing.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace audioapi {
+
+SpscAudioRing::SpscAudioRing(int numberOfChannels, size_t capacity)
+    : numberOfChannels_(numberOfChannels),
+      capacity_(std::bit_ceil(std::max(capacity, static_cast<size_t>(1)))),
+      // the rate of the ring is never used
+      ring_(std::make_unique<AudioBus>(capacity_, numberOfChannels_, 0.0f)) {}
+
+SpscAudioRing::~SpscAudioRing() = default;
+
+int SpscAudioRing::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+size_t SpscAudioRing::getCapacity() const {
+  return capacity_;
+}
+
+size_t SpscAudioRing::getNumberOfAvailableFrames() const {
+  auto writeIndex = writeIndex_.load(std::memory_order_acquire);
+  auto readIndex = std::max(
+      readIndex_.load(std::memory_order_acquire),
+      discardIndex_.load(std::memory_order_acquire));
+  return writeIndex - std::min(readIndex, writeIndex);
+}
+
+size_t SpscAudioRing::getAvailableSpace() const {
+  return capacity_ -
+      (writeIndex_.load(std::memory_order_relaxed) -
+       readIndex_.load(std::memory_order_acquire));
+}
+
+size_t SpscAudioRing::write(const float *const *source, size_t frames) {
+  frames = std::min(frames, getAvailableSpace());
+  auto writeIndex = writeIndex_.load(std::memory_order_relaxed);
+  auto position = writeIndex & (capacity_ - 1);
+  auto firstPart = std::min(frames, capacity_ - position);
+
+  for (int ch = 0; ch < numberOfChannels_; ++ch) {
+    auto *data = ring_->getChannel(ch)->getData();
+    std::memcpy(data + position, source[ch], firstPart * sizeof(float));
+    std::memcpy(
+        data, source[ch] + firstPart, (frames - firstPart) * sizeof(float));
+  }
+
+  // publishes the frames, the reader acquires the index before copying them
+  writeIndex_.store(writeIndex + frames, std::memory_order_release);
+  return frames;
+}
+
+size_t SpscAudioRing::read(
+    AudioBus *destination,
+    size_t destinationStart,
+    size_t frames) {
+  auto readIndex = skipDiscardedFrames();
+  frames = std::min(
+      frames, writeIndex_.load(std::memory_order_acquire) - readIndex);
+  auto position = readIndex & (capacity_ - 1);
+  auto firstPart = std::min(frames, capacity_ - position);
+  auto numberOfChannels =
+      std::min(numberOfChannels_, destination->getNumberOfChannels());
+
+  for (int ch = 0; ch < numberOfChannels; ++ch) {
+    const auto *data = ring_->getChannel(ch)->getData();
+    auto *output = destination->getChannel(ch)->getData() + destinationStart;
+    std::memcpy(output, data + position, firstPart * sizeof(float));
+    std::memcpy(
+        output + firstPart, data, (frames - firstPart) * sizeof(float));
+  }
+
+  // hands the space back, the writer acquires the index before overwriting it
+  readIndex_.store(readIndex + frames, std::memory_order_release);
+  return frames;
+}
+
+void SpscAudioRing::clear() {
+  readIndex_.store(
+      writeIndex_.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+void SpscAudioRing::discard() {
+  discardIndex_.store(
+      writeIndex_.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+size_t SpscAudioRing::skipDiscardedFrames() {
+  auto readIndex = readIndex_.load(std::memory_order_relaxed);
+  auto discardIndex = discardIndex_.load(std::memory_order_acquire);
+  if (discardIndex > readIndex) {
+    readIndex = discardIndex;
+    readIndex_.store(readIndex, std::memory_order_release);
+  }
+  return readIndex;
+}
+
+} // namespace audioapi
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace audioapi {
+
+class AudioBus;
+
+/// @brief Multichannel ring of audio frames shared by exactly one writing and one reading thread.
+/// @note Both sides are wait-free: they never lock, never allocate and copy at most the frames they were asked for,
+/// split in two parts where the ring wraps around.
+/// @note Capacity is rounded up to a power of two, so the indices can grow forever and wrap with a mask.
+class SpscAudioRing {
+ public:
+  SpscAudioRing(int numberOfChannels, size_t capacity);
+  ~SpscAudioRing();
+
+  SpscAudioRing(const SpscAudioRing &) = delete;
+  SpscAudioRing &operator=(const SpscAudioRing &) = delete;
+
+  [[nodiscard]] int getNumberOfChannels() const;
+  [[nodiscard]] size_t getCapacity() const;
+
+  /// @brief Frames that can be read, frames dropped by discard() are not counted.
+  [[nodiscard]] size_t getNumberOfAvailableFrames() const;
+
+  /// @brief Frames that can be written, called from the writing thread.
+  [[nodiscard]] size_t getAvailableSpace() const;
+
+  /// @brief Appends frames, one pointer per channel of the ring.
+  /// @return Number of written frames, less than frames when the ring is full.
+  size_t write(const float *const *source, size_t frames);
+
+  /// @brief Moves frames to the bus starting at destinationStart.
+  /// @return Number of read frames, less than frames when the ring runs empty.
+  /// @note Only the channels present in both the ring and the bus are copied, all of them are consumed.
+  size_t read(AudioBus *destination, size_t destinationStart, size_t frames);
+
+  /// @brief Drops every frame written so far, called from the reading thread.
+  void clear();
+
+  /// @brief Drops every frame written so far, called from the writing thread.
+  /// @note The reader skips the frames on its next read, until then they still take space in the ring.
+  /// Frames written after the call are kept.
+  void discard();
+
+ private:
+  int numberOfChannels_;
+  size_t capacity_;
+  std::unique_ptr<AudioBus> ring_;
+
+  // Total numbers of frames written and read, each one is stored only by its
+  // own thread. They live on separate cache lines, so the two threads do not
+  // keep invalidating each other.
+  alignas(64) std::atomic<size_t> writeIndex_{0};
+  // write index at the last discard(), the reader never reads before it
+  std::atomic<size_t> discardIndex_{0};
+  alignas(64) std::atomic<size_t> readIndex_{0};
+
+  // moves the read index past the discarded frames, reading thread only
+  size_t skipDiscardedFrames();
+};
+
+} // namespace audioapi
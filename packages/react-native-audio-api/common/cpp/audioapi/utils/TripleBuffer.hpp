@@ -0,0 +1,60 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace audioapi {
+
+/// @brief Three copies of a value shared by exactly one writing and one reading thread.
+/// @note The writer fills its own copy and publishes it, the reader takes the latest published copy.
+/// Both sides only swap an index with the spare copy, so they never wait for each other and never see
+/// a copy that is being written.
+/// @note A copy the reader did not take before the next publish is skipped, the reader always gets the latest one.
+template <typename T>
+class TripleBuffer {
+ public:
+  explicit TripleBuffer(const T &initial) : buffers_{initial, initial, initial} {}
+
+  TripleBuffer(const TripleBuffer &) = delete;
+  TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+  /// @brief The copy to be filled, called from the writing thread.
+  T &getWriteBuffer() {
+    return buffers_[writeIndex_];
+  }
+
+  /// @brief Makes the write copy the latest one, called from the writing thread.
+  void publish() {
+    writeIndex_ = spareIndex_.exchange(writeIndex_ | IS_FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+  }
+
+  /// @brief Takes the latest published copy, called from the reading thread.
+  /// @return True when a copy was published since the last update.
+  bool update() {
+    if ((spareIndex_.load(std::memory_order_relaxed) & IS_FRESH) == 0) {
+      return false;
+    }
+
+    readIndex_ = spareIndex_.exchange(readIndex_, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+  /// @brief The copy taken by the last update, called from the reading thread.
+  const T &getReadBuffer() const {
+    return buffers_[readIndex_];
+  }
+
+ private:
+  static constexpr uint8_t INDEX_MASK = 0b11;
+  // set on the spare index when it holds a copy the reader has not taken yet
+  static constexpr uint8_t IS_FRESH = 0b100;
+
+  std::array<T, 3> buffers_;
+
+  // each index is used only by its own thread, the spare one is swapped by both
+  uint8_t writeIndex_ = 0;
+  alignas(64) std::atomic<uint8_t> spareIndex_{1};
+  alignas(64) uint8_t readIndex_ = 2;
+};
+
+} // namespace audioapi
@@ -0,0 +1,154 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/sources/AudioBufferQueueSourceNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+class AudioBufferQueueSourceNodeTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<NiceMock<MockAudioEventHandlerRegistry>> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<NiceMock<MockAudioEventHandlerRegistry>>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+
+  std::shared_ptr<audioapi::AudioBuffer> createBuffer(
+      size_t length,
+      float value) {
+    auto buffer = std::make_shared<audioapi::AudioBuffer>(2, length, sampleRate);
+    for (int ch = 0; ch < 2; ++ch) {
+      std::fill_n(buffer->getChannelData(ch), length, value);
+    }
+    return buffer;
+  }
+};
+
+class TestableAudioBufferQueueSourceNode
+    : public audioapi::AudioBufferQueueSourceNode {
+ public:
+  explicit TestableAudioBufferQueueSourceNode(audioapi::BaseAudioContext *context)
+      : audioapi::AudioBufferQueueSourceNode(context, false) {}
+
+  // renders the given number of quanta, returns the first channel
+  std::vector<float> render(int numberOfQuanta) {
+    std::vector<float> output;
+    auto bus = std::make_shared<audioapi::AudioBus>(
+        audioapi::RENDER_QUANTUM_SIZE, 2, context_->getSampleRate());
+
+    for (int i = 0; i < numberOfQuanta; ++i) {
+      processNode(bus, audioapi::RENDER_QUANTUM_SIZE);
+      const auto *data = bus->getChannel(0)->getData();
+      output.insert(output.end(), data, data + audioapi::RENDER_QUANTUM_SIZE);
+    }
+
+    return output;
+  }
+};
+
+TEST_F(AudioBufferQueueSourceNodeTest, PlaysBuffersWithoutGap) {
+  auto node = TestableAudioBufferQueueSourceNode(context.get());
+  node.enqueueBuffer(createBuffer(100, 1.0f));
+  node.enqueueBuffer(createBuffer(200, 2.0f));
+  node.start(0.0);
+
+  auto output = node.render(3);
+  for (size_t i = 0; i < output.size(); ++i) {
+    auto expected = i < 100 ? 1.0f : i < 300 ? 2.0f : 0.0f;
+    ASSERT_EQ(output[i], expected) << "frame " << i;
+  }
+}
+
+TEST_F(AudioBufferQueueSourceNodeTest, CrossfadesWithEqualPowerGains) {
+  auto node = TestableAudioBufferQueueSourceNode(context.get());
+  node.setCrossfadeDuration(0.01);
+  auto crossfadeFrames = static_cast<size_t>(0.01 * sampleRate);
+  node.enqueueBuffer(createBuffer(1000, 1.0f));
+  node.enqueueBuffer(createBuffer(1000, 0.5f));
+  node.start(0.0);
+
+  auto output = node.render(16);
+  auto crossfadeStart = 1000 - crossfadeFrames;
+  for (size_t i = 0; i < crossfadeFrames; ++i) {
+    auto angle = 0.5f * audioapi::PI * static_cast<float>(i) /
+        static_cast<float>(crossfadeFrames);
+    auto expected = std::cos(angle) + 0.5f * std::sin(angle);
+    ASSERT_NEAR(output[crossfadeStart + i], expected, 1e-5f) << "frame " << i;
+  }
+
+  // the second buffer continues right after the overlap
+  auto end = 2000 - crossfadeFrames;
+  EXPECT_EQ(output[crossfadeStart - 1], 1.0f);
+  EXPECT_EQ(output[1000], 0.5f);
+  EXPECT_EQ(output[end - 1], 0.5f);
+  EXPECT_EQ(output[end], 0.0f);
+}
+
+TEST_F(AudioBufferQueueSourceNodeTest, SkipsDequeuedAndClearedBuffers) {
+  auto node = TestableAudioBufferQueueSourceNode(context.get());
+  node.enqueueBuffer(createBuffer(64, 1.0f));
+  auto bufferId = node.enqueueBuffer(createBuffer(64, 2.0f));
+  node.enqueueBuffer(createBuffer(64, 3.0f));
+  node.dequeueBuffer(std::stoull(*bufferId));
+  node.start(0.0);
+
+  auto output = node.render(1);
+  EXPECT_EQ(output[63], 1.0f);
+  EXPECT_EQ(output[64], 3.0f);
+  EXPECT_EQ(output[127], 3.0f);
+
+  node.enqueueBuffer(createBuffer(64, 4.0f));
+  node.clearBuffers();
+  node.enqueueBuffer(createBuffer(64, 5.0f));
+
+  output = node.render(1);
+  EXPECT_EQ(output[0], 5.0f);
+  EXPECT_EQ(output[64], 0.0f);
+}
+
+TEST_F(AudioBufferQueueSourceNodeTest, ReportsConsumedBuffers) {
+  auto node = TestableAudioBufferQueueSourceNode(context.get());
+  node.setOnBufferConsumedCallbackId(1);
+  node.enqueueBuffer(createBuffer(100, 1.0f));
+  node.enqueueBuffer(createBuffer(441, 1.0f));
+  node.start(0.0);
+
+  audioapi::AudioEvent event{};
+  EXPECT_CALL(
+      *eventRegistry,
+      enqueueEvent(::testing::Field(
+          &audioapi::AudioEvent::type, audioapi::AudioEventType::BUFFER_CONSUMED)))
+      .WillOnce(::testing::SaveArg<0>(&event));
+  node.render(1);
+
+  EXPECT_EQ(event.listenerId, 1);
+  EXPECT_EQ(event.bufferId, 0);
+  EXPECT_EQ(event.count, 1);
+  EXPECT_NEAR(event.value, 0.01, 1e-9);
+}
+
+TEST_F(AudioBufferQueueSourceNodeTest, RejectsBuffersWhenFull) {
+  auto node = TestableAudioBufferQueueSourceNode(context.get());
+  auto buffer = createBuffer(64, 1.0f);
+  for (size_t i = 0; i < audioapi::AUDIO_BUFFER_QUEUE_CAPACITY; ++i) {
+    ASSERT_TRUE(node.enqueueBuffer(buffer).has_value());
+  }
+  EXPECT_FALSE(node.enqueueBuffer(buffer).has_value());
+
+  // a played buffer frees its slot
+  node.start(0.0);
+  node.render(1);
+  EXPECT_TRUE(node.enqueueBuffer(buffer).has_value());
+}
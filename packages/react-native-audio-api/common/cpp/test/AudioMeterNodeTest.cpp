@@ -0,0 +1,153 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/analysis/AudioMeterNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+using ::testing::NiceMock;
+
+class AudioMeterNodeTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<NiceMock<MockAudioEventHandlerRegistry>> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 48000;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<NiceMock<MockAudioEventHandlerRegistry>>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+};
+
+class TestableAudioMeterNode : public audioapi::AudioMeterNode {
+ public:
+  explicit TestableAudioMeterNode(audioapi::BaseAudioContext *context, int numberOfBands)
+      : audioapi::AudioMeterNode(context, numberOfBands) {}
+
+  // meters a full scale sine of the given frequency in the first channel of a stereo bus
+  void meterSine(float frequency, float seconds) {
+    auto bus = std::make_shared<audioapi::AudioBus>(
+        audioapi::RENDER_QUANTUM_SIZE, 2, context_->getSampleRate());
+    auto numberOfQuanta = static_cast<int>(seconds * context_->getSampleRate()) /
+        audioapi::RENDER_QUANTUM_SIZE;
+
+    for (int i = 0; i < numberOfQuanta; ++i) {
+      bus->zero();
+      auto *data = bus->getChannel(0)->getData();
+      for (int j = 0; j < audioapi::RENDER_QUANTUM_SIZE; ++j) {
+        auto frame = i * audioapi::RENDER_QUANTUM_SIZE + j;
+        data[j] = std::sin(
+            2.0f * audioapi::PI * frequency * static_cast<float>(frame) /
+            context_->getSampleRate());
+      }
+      processNode(bus, audioapi::RENDER_QUANTUM_SIZE);
+    }
+  }
+
+  std::shared_ptr<audioapi::AudioBus> process(
+      const std::shared_ptr<audioapi::AudioBus> &bus) {
+    return processNode(bus, audioapi::RENDER_QUANTUM_SIZE);
+  }
+};
+
+TEST_F(AudioMeterNodeTest, ReportsSilenceBeforeFirstQuantum) {
+  auto node = TestableAudioMeterNode(context.get(), 10);
+  const auto &measurements = node.getMeasurements();
+
+  EXPECT_EQ(measurements.numberOfChannels, 0);
+  EXPECT_TRUE(std::isinf(measurements.momentaryLoudness));
+  EXPECT_TRUE(std::isinf(measurements.shortTermLoudness));
+  EXPECT_TRUE(std::isinf(measurements.bandEnergies[0]));
+}
+
+TEST_F(AudioMeterNodeTest, PassesInputThroughUnchanged) {
+  auto node = TestableAudioMeterNode(context.get(), 10);
+  auto bus = std::make_shared<audioapi::AudioBus>(
+      audioapi::RENDER_QUANTUM_SIZE, 2, sampleRate);
+  for (int ch = 0; ch < 2; ++ch) {
+    for (int i = 0; i < audioapi::RENDER_QUANTUM_SIZE; ++i) {
+      (*bus)[ch][i] = static_cast<float>(i) / audioapi::RENDER_QUANTUM_SIZE - 0.5f * ch;
+    }
+  }
+
+  auto output = node.process(bus);
+  ASSERT_EQ(output, bus);
+  for (int ch = 0; ch < 2; ++ch) {
+    for (int i = 0; i < audioapi::RENDER_QUANTUM_SIZE; ++i) {
+      EXPECT_EQ((*output)[ch][i], static_cast<float>(i) / audioapi::RENDER_QUANTUM_SIZE - 0.5f * ch);
+    }
+  }
+}
+
+TEST_F(AudioMeterNodeTest, MeasuresFullScaleSine) {
+  auto node = TestableAudioMeterNode(context.get(), 10);
+  node.meterSine(997.0f, 3.5f);
+  const auto &measurements = node.getMeasurements();
+
+  ASSERT_EQ(measurements.numberOfChannels, 2);
+  EXPECT_NEAR(measurements.rms[0], -3.01f, 0.05f);
+  EXPECT_NEAR(measurements.peak[0], 0.0f, 0.1f);
+  EXPECT_NEAR(measurements.truePeak[0], 0.0f, 0.1f);
+  EXPECT_GE(measurements.truePeak[0], measurements.peak[0]);
+  EXPECT_TRUE(std::isinf(measurements.rms[1]));
+  EXPECT_TRUE(std::isinf(measurements.peak[1]));
+
+  // BS.1770 calibration, a full scale 997 Hz sine in one channel is -3.01 LUFS
+  EXPECT_NEAR(measurements.momentaryLoudness, -3.01f, 0.1f);
+  EXPECT_NEAR(measurements.shortTermLoudness, -3.01f, 0.1f);
+}
+
+TEST_F(AudioMeterNodeTest, PeakIsMaximumOfLevelWindow) {
+  static constexpr int NUMBER_OF_QUANTA = 400;
+  auto windowQuanta = static_cast<int>(std::ceil(
+      audioapi::AUDIO_METER_LEVEL_WINDOW * sampleRate /
+      audioapi::RENDER_QUANTUM_SIZE));
+
+  auto node = TestableAudioMeterNode(context.get(), 10);
+  auto bus = std::make_shared<audioapi::AudioBus>(
+      audioapi::RENDER_QUANTUM_SIZE, 2, sampleRate);
+
+  // rising and falling runs of amplitudes, one per quantum
+  std::vector<float> amplitudes;
+  for (int i = 0; i < NUMBER_OF_QUANTA; ++i) {
+    amplitudes.push_back(
+        0.05f + static_cast<float>((i * 7919) % 1000) / 1100.0f);
+
+    bus->zero();
+    (*bus)[0][i % audioapi::RENDER_QUANTUM_SIZE] = -amplitudes.back();
+    node.process(bus);
+
+    auto first = std::max(0, i + 1 - windowQuanta);
+    auto peak = *std::max_element(amplitudes.begin() + first, amplitudes.end());
+    const auto &measurements = node.getMeasurements();
+    ASSERT_NEAR(measurements.peak[0], 20.0f * std::log10(peak), 1e-4)
+        << "quantum " << i;
+    ASSERT_GE(measurements.truePeak[0], measurements.peak[0]) << "quantum " << i;
+  }
+}
+
+TEST_F(AudioMeterNodeTest, PutsSineEnergyIntoNearestBand) {
+  auto node = TestableAudioMeterNode(context.get(), 10);
+  node.meterSine(997.0f, 0.5f);
+  const auto &measurements = node.getMeasurements();
+
+  int nearestBand = 0;
+  for (int i = 1; i < node.getNumberOfBands(); ++i) {
+    if (std::abs(std::log2(node.getBandFrequency(i) / 997.0f)) <
+        std::abs(std::log2(node.getBandFrequency(nearestBand) / 997.0f))) {
+      nearestBand = i;
+    }
+  }
+
+  auto loudestBand = std::max_element(
+                         measurements.bandEnergies.begin(),
+                         measurements.bandEnergies.begin() + node.getNumberOfBands()) -
+      measurements.bandEnergies.begin();
+  EXPECT_EQ(loudestBand, nearestBand);
+}
@@ -1,7 +1,9 @@
 #include <audioapi/core/AudioParam.h>
 #include <audioapi/core/OfflineAudioContext.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
 #include <gtest/gtest.h>
+#include <vector>
 #include "MockAudioEventHandlerRegistry.h"
 
 using namespace audioapi;
@@ -202,3 +204,101 @@ TEST_F(AudioParamTest, CancelAndHoldAtTime) {
   value = param.processKRateParam(1, 0.25);
   EXPECT_FLOAT_EQ(value, 0.9);
 }
+
+TEST_F(AudioParamTest, ARateAutomationWithinQuantum) {
+  AudioParam param = AudioParam(0.0, 0.0, 1.0, context.get());
+  // 128 frames at 44100 Hz, events start and end inside the quantum
+  param.setValueAtTime(0.5, 32.0 / sampleRate);
+  param.linearRampToValueAtTime(1.0, 96.0 / sampleRate);
+
+  auto bus = param.processARateParam(RENDER_QUANTUM_SIZE, 0.0);
+  auto *values = bus->getChannel(0)->getData();
+
+  EXPECT_FLOAT_EQ(values[0], 0.0);
+  EXPECT_FLOAT_EQ(values[31], 0.0);
+  EXPECT_FLOAT_EQ(values[32], 0.5);
+  EXPECT_NEAR(values[64], 0.75, 1e-5);
+  EXPECT_FLOAT_EQ(values[96], 1.0);
+  EXPECT_FLOAT_EQ(values[127], 1.0);
+}
+
+namespace {
+
+// Renders quanta of two params with the same automation, one through the
+// constant fast path whenever it applies, the other always per frame, and
+// returns which quanta took the fast path.
+std::vector<bool> expectFastPathMatchesARate(
+    AudioParam &fastParam,
+    AudioParam &aRateParam,
+    int numberOfQuanta,
+    float sampleRate) {
+  std::vector<bool> constantQuanta;
+
+  for (int quantum = 0; quantum < numberOfQuanta; ++quantum) {
+    auto time = static_cast<double>(quantum * RENDER_QUANTUM_SIZE) / sampleRate;
+    auto isConstant = fastParam.isConstant(RENDER_QUANTUM_SIZE, time);
+    constantQuanta.push_back(isConstant);
+
+    const auto &bus = aRateParam.processARateParam(RENDER_QUANTUM_SIZE, time);
+    auto *values = bus->getChannel(0)->getData();
+
+    if (isConstant) {
+      auto value = fastParam.processKRateParam(RENDER_QUANTUM_SIZE, time);
+      for (int i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+        EXPECT_FLOAT_EQ(values[i], value)
+            << "quantum " << quantum << ", frame " << i;
+      }
+    } else {
+      const auto &fastBus =
+          fastParam.processARateParam(RENDER_QUANTUM_SIZE, time);
+      auto *fastValues = fastBus->getChannel(0)->getData();
+      for (int i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+        EXPECT_FLOAT_EQ(fastValues[i], values[i])
+            << "quantum " << quantum << ", frame " << i;
+      }
+    }
+  }
+
+  return constantQuanta;
+}
+
+} // namespace
+
+TEST_F(AudioParamTest, ConstantPathMatchesARateWithoutAutomation) {
+  AudioParam fastParam = AudioParam(0.25, 0.0, 1.0, context.get());
+  AudioParam aRateParam = AudioParam(0.25, 0.0, 1.0, context.get());
+
+  auto constantQuanta =
+      expectFastPathMatchesARate(fastParam, aRateParam, 4, sampleRate);
+
+  for (auto isConstant : constantQuanta) {
+    EXPECT_TRUE(isConstant);
+  }
+}
+
+TEST_F(AudioParamTest, ConstantPathMatchesARateAcrossAutomation) {
+  AudioParam fastParam = AudioParam(0.0, 0.0, 1.0, context.get());
+  AudioParam aRateParam = AudioParam(0.0, 0.0, 1.0, context.get());
+
+  // a step inside the third quantum, a ramp over the fourth and fifth, then
+  // constant again
+  for (auto *param : {&fastParam, &aRateParam}) {
+    param->setValueAtTime(0.5, (2 * RENDER_QUANTUM_SIZE + 40.0) / sampleRate);
+    param->setValueAtTime(0.5, (3.0 * RENDER_QUANTUM_SIZE) / sampleRate);
+    param->linearRampToValueAtTime(
+        1.0, (5.0 * RENDER_QUANTUM_SIZE) / sampleRate);
+  }
+
+  auto constantQuanta =
+      expectFastPathMatchesARate(fastParam, aRateParam, 8, sampleRate);
+
+  // the first quantum is conservatively not constant, the queued automation
+  // is only taken up by the next one
+  EXPECT_TRUE(constantQuanta[1]);
+  EXPECT_FALSE(constantQuanta[2]);
+  EXPECT_FALSE(constantQuanta[3]);
+  EXPECT_FALSE(constantQuanta[4]);
+  EXPECT_TRUE(constantQuanta[5]);
+  EXPECT_TRUE(constantQuanta[6]);
+  EXPECT_TRUE(constantQuanta[7]);
+}
@@ -0,0 +1,211 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/effects/BiquadFilterNode.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/dsp/Biquad.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include "MockAudioEventHandlerRegistry.h"
+
+class BiquadFilterTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+};
+
+class TestableBiquadFilterNode : public audioapi::BiquadFilterNode {
+ public:
+  explicit TestableBiquadFilterNode(audioapi::BaseAudioContext *context)
+      : audioapi::BiquadFilterNode(context) {}
+
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    return audioapi::BiquadFilterNode::processNode(
+        processingBus, framesToProcess);
+  }
+};
+
+TEST_F(BiquadFilterTest, BiquadFilterCanBeCreated) {
+  auto biquadFilter = context->createBiquadFilter();
+  ASSERT_NE(biquadFilter, nullptr);
+}
+
+TEST_F(BiquadFilterTest, ChannelsAreFilteredIndependently) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  auto stereoNode = std::make_shared<TestableBiquadFilterNode>(context.get());
+  auto monoNode = std::make_shared<TestableBiquadFilterNode>(context.get());
+
+  auto stereoBus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  auto monoBus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 1, sampleRate);
+
+  // Two quanta, so the state carried between them is covered as well.
+  for (int quantum = 0; quantum < 2; ++quantum) {
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      float value = (i % 7 == 0) ? 1.0f : -0.25f;
+      stereoBus->getChannel(0)->getData()[i] = value;
+      stereoBus->getChannel(1)->getData()[i] = 0.0f;
+      monoBus->getChannel(0)->getData()[i] = value;
+    }
+
+    stereoNode->processNode(stereoBus, FRAMES_TO_PROCESS);
+    monoNode->processNode(monoBus, FRAMES_TO_PROCESS);
+
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      EXPECT_FLOAT_EQ(
+          (*stereoBus->getChannel(0))[i], (*monoBus->getChannel(0))[i]);
+      EXPECT_FLOAT_EQ((*stereoBus->getChannel(1))[i], 0.0f);
+    }
+  }
+}
+
+TEST_F(BiquadFilterTest, AutomationIsKRateByDefault) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  auto automatedNode =
+      std::make_shared<TestableBiquadFilterNode>(context.get());
+  auto constantNode = std::make_shared<TestableBiquadFilterNode>(context.get());
+  EXPECT_EQ(automatedNode->getAutomationSubBlockSize(), 0);
+  automatedNode->getFrequencyParam()->linearRampToValueAtTime(
+      10000.0f, static_cast<double>(FRAMES_TO_PROCESS) / sampleRate);
+
+  auto automatedBus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 1, sampleRate);
+  auto constantBus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 1, sampleRate);
+  for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    float value = (i % 5 == 0) ? 1.0f : -0.25f;
+    automatedBus->getChannel(0)->getData()[i] = value;
+    constantBus->getChannel(0)->getData()[i] = value;
+  }
+
+  automatedNode->processNode(automatedBus, FRAMES_TO_PROCESS);
+  constantNode->processNode(constantBus, FRAMES_TO_PROCESS);
+
+  // The whole quantum uses the value at the start of the ramp.
+  for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    EXPECT_FLOAT_EQ(
+        (*automatedBus->getChannel(0))[i], (*constantBus->getChannel(0))[i]);
+  }
+}
+
+TEST_F(BiquadFilterTest, SubBlocksFollowPerSampleAutomation) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  auto render = [this](int subBlockSize) {
+    auto node = std::make_shared<TestableBiquadFilterNode>(context.get());
+    node->setAutomationSubBlockSize(subBlockSize);
+    node->getFrequencyParam()->linearRampToValueAtTime(
+        10000.0f, static_cast<double>(FRAMES_TO_PROCESS) / sampleRate);
+
+    auto bus =
+        std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 1, sampleRate);
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      bus->getChannel(0)->getData()[i] = (i % 5 == 0) ? 1.0f : -0.25f;
+    }
+    node->processNode(bus, FRAMES_TO_PROCESS);
+    return bus;
+  };
+
+  auto perSampleBus = render(1);
+  auto subBlockBus = render(32);
+  auto kRateBus = render(0);
+
+  float subBlockError = 0.0f;
+  float kRateError = 0.0f;
+  for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    float expected = (*perSampleBus->getChannel(0))[i];
+    subBlockError = std::max(
+        subBlockError, std::abs((*subBlockBus->getChannel(0))[i] - expected));
+    kRateError = std::max(
+        kRateError, std::abs((*kRateBus->getChannel(0))[i] - expected));
+  }
+
+  EXPECT_GT(kRateError, 0.0f);
+  EXPECT_LT(subBlockError, kRateError / 4);
+}
+
+TEST_F(BiquadFilterTest, SubBlockSizeIsClampedToQuantum) {
+  auto node = std::make_shared<TestableBiquadFilterNode>(context.get());
+  node->setAutomationSubBlockSize(16);
+  EXPECT_EQ(node->getAutomationSubBlockSize(), 16);
+  node->setAutomationSubBlockSize(1000);
+  EXPECT_EQ(node->getAutomationSubBlockSize(), audioapi::RENDER_QUANTUM_SIZE);
+  node->setAutomationSubBlockSize(-1);
+  EXPECT_EQ(node->getAutomationSubBlockSize(), 0);
+}
+
+TEST(BiquadTest, ChannelGroupsMatchSingleChannel) {
+  static constexpr int NUMBER_OF_CHANNELS = 7;
+  static constexpr size_t FRAMES_TO_PROCESS = 131;
+  audioapi::dsp::BiquadCoefficients coefficients{
+      0.2f, 0.4f, 0.2f, -0.6f, 0.35f};
+
+  audioapi::dsp::Biquad multiChannel(NUMBER_OF_CHANNELS);
+  multiChannel.setCoefficients(coefficients);
+
+  std::vector<std::vector<float>> data(
+      NUMBER_OF_CHANNELS, std::vector<float>(FRAMES_TO_PROCESS));
+  std::vector<std::vector<float>> expected = data;
+  for (int c = 0; c < NUMBER_OF_CHANNELS; ++c) {
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      data[c][i] = static_cast<float>((i * (c + 3)) % 11) / 11.0f - 0.5f;
+    }
+
+    audioapi::dsp::Biquad singleChannel(1);
+    singleChannel.setCoefficients(coefficients);
+    expected[c] = data[c];
+    float *channel = expected[c].data();
+    singleChannel.process(&channel, 1, FRAMES_TO_PROCESS);
+  }
+
+  std::vector<float *> channels;
+  for (auto &channel : data) {
+    channels.push_back(channel.data());
+  }
+  multiChannel.process(channels.data(), NUMBER_OF_CHANNELS, FRAMES_TO_PROCESS);
+
+  for (int c = 0; c < NUMBER_OF_CHANNELS; ++c) {
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      EXPECT_NEAR(data[c][i], expected[c][i], 1e-5);
+    }
+  }
+}
+
+TEST(BiquadTest, RampToSameCoefficientsMatchesProcess) {
+  static constexpr size_t FRAMES_TO_PROCESS = 64;
+  audioapi::dsp::BiquadCoefficients coefficients{
+      0.2f, 0.4f, 0.2f, -0.6f, 0.35f};
+  audioapi::dsp::BiquadCoefficients target{0.1f, 0.2f, 0.1f, -1.2f, 0.5f};
+
+  audioapi::dsp::Biquad ramped(1);
+  audioapi::dsp::Biquad fixed(1);
+  ramped.setCoefficients(coefficients);
+  fixed.setCoefficients(coefficients);
+
+  std::vector<float> data(FRAMES_TO_PROCESS);
+  for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    data[i] = static_cast<float>(i % 7) / 7.0f - 0.5f;
+  }
+  std::vector<float> expected = data;
+  float *rampedChannel = data.data();
+  float *fixedChannel = expected.data();
+
+  ramped.processRamped(&rampedChannel, 1, FRAMES_TO_PROCESS, &coefficients);
+  fixed.process(&fixedChannel, 1, FRAMES_TO_PROCESS);
+
+  for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    EXPECT_FLOAT_EQ(data[i], expected[i]);
+  }
+
+  ramped.processRamped(&rampedChannel, 1, FRAMES_TO_PROCESS, &target);
+  EXPECT_FLOAT_EQ(ramped.getCoefficients().a1, target.a1);
+  EXPECT_FLOAT_EQ(ramped.getCoefficients().b0, target.b0);
+}
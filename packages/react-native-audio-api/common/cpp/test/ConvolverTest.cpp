@@ -0,0 +1,306 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/ConvolverNode.h>
+#include <audioapi/core/sources/AudioBuffer.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/dsp/Convolver.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+class ConvolverTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+};
+
+class TestableConvolverNode : public audioapi::ConvolverNode {
+ public:
+  explicit TestableConvolverNode(audioapi::BaseAudioContext *context)
+      : audioapi::ConvolverNode(context) {}
+
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    return audioapi::ConvolverNode::processNode(processingBus, framesToProcess);
+  }
+};
+
+namespace {
+
+float testSignal(size_t i, int seed) {
+  return static_cast<float>((i * (7 + seed) + seed) % 23) / 23.0f - 0.5f;
+}
+
+// Direct convolution, delayed by the latency of the convolver.
+float convolveAt(
+    const std::vector<float> &input,
+    const std::vector<float> &impulseResponse,
+    size_t frame) {
+  if (frame < audioapi::CONVOLVER_HEAD_PARTITION_SIZE) {
+    return 0.0f;
+  }
+
+  auto n = frame - audioapi::CONVOLVER_HEAD_PARTITION_SIZE;
+  double sum = 0.0;
+  for (size_t j = 0; j < impulseResponse.size() && j <= n; ++j) {
+    if (impulseResponse[j] != 0.0f) {
+      sum += static_cast<double>(impulseResponse[j]) * input[n - j];
+    }
+  }
+
+  return static_cast<float>(sum);
+}
+
+} // namespace
+
+TEST_F(ConvolverTest, ConvolverCanBeCreated) {
+  auto convolver = context->createConvolver();
+  ASSERT_NE(convolver, nullptr);
+  EXPECT_TRUE(convolver->getNormalize());
+  EXPECT_EQ(convolver->getBuffer(), nullptr);
+}
+
+TEST_F(ConvolverTest, OutputsSilenceWithoutBuffer) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  auto convolver = std::make_shared<TestableConvolverNode>(context.get());
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  bus->getChannel(0)->getData()[0] = 1.0f;
+
+  auto output = convolver->processNode(bus, FRAMES_TO_PROCESS);
+
+  for (int c = 0; c < 2; ++c) {
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      EXPECT_EQ((*output->getChannel(c))[i], 0.0f);
+    }
+  }
+}
+
+TEST_F(ConvolverTest, RejectsBufferWithUnsupportedNumberOfChannels) {
+  auto convolver = context->createConvolver();
+
+  for (int channels : {3, 5, 6}) {
+    auto buffer =
+        std::make_shared<audioapi::AudioBuffer>(channels, 128, sampleRate);
+    EXPECT_THROW(convolver->setBuffer(buffer), std::invalid_argument)
+        << channels << " channels";
+  }
+  EXPECT_EQ(convolver->getBuffer(), nullptr);
+}
+
+TEST_F(ConvolverTest, StereoImpulseResponseMatchesDirectConvolution) {
+  static constexpr size_t IMPULSE_RESPONSE_LENGTH = 5000;
+  static constexpr size_t FRAMES = 7000;
+
+  auto buffer = std::make_shared<audioapi::AudioBuffer>(
+      2, IMPULSE_RESPONSE_LENGTH, sampleRate);
+  std::vector<std::vector<float>> impulseResponses(
+      2, std::vector<float>(IMPULSE_RESPONSE_LENGTH));
+  for (int c = 0; c < 2; ++c) {
+    for (size_t i = 0; i < IMPULSE_RESPONSE_LENGTH; ++i) {
+      impulseResponses[c][i] =
+          testSignal(i, c + 1) * std::exp(-static_cast<float>(i) / 1000.0f);
+      buffer->getChannelData(c)[i] = impulseResponses[c][i];
+    }
+  }
+
+  auto convolver = std::make_shared<TestableConvolverNode>(context.get());
+  convolver->setNormalize(false);
+  convolver->setBuffer(buffer);
+
+  std::vector<std::vector<float>> inputs(2, std::vector<float>(FRAMES));
+  std::vector<std::vector<float>> outputs(2, std::vector<float>(FRAMES));
+  for (int c = 0; c < 2; ++c) {
+    for (size_t i = 0; i < FRAMES; ++i) {
+      inputs[c][i] = testSignal(i, c + 3);
+    }
+  }
+
+  // Quanta of varying size, like the ones platform callbacks request.
+  auto bus = std::make_shared<audioapi::AudioBus>(
+      audioapi::RENDER_QUANTUM_SIZE, 2, sampleRate);
+  size_t frame = 0;
+  for (int quantum = 0; frame < FRAMES; ++quantum) {
+    auto framesToProcess = std::min<size_t>(
+        quantum % 3 == 0 ? 77 : audioapi::RENDER_QUANTUM_SIZE, FRAMES - frame);
+    for (int c = 0; c < 2; ++c) {
+      std::copy_n(
+          inputs[c].begin() + frame,
+          framesToProcess,
+          bus->getChannel(c)->getData());
+    }
+
+    auto output =
+        convolver->processNode(bus, static_cast<int>(framesToProcess));
+
+    for (int c = 0; c < 2; ++c) {
+      std::copy_n(
+          output->getChannel(c)->getData(),
+          framesToProcess,
+          outputs[c].begin() + frame);
+    }
+    frame += framesToProcess;
+  }
+
+  for (int c = 0; c < 2; ++c) {
+    for (size_t i = 0; i < FRAMES; i += 7) {
+      EXPECT_NEAR(
+          outputs[c][i],
+          convolveAt(inputs[c], impulseResponses[c], i),
+          1e-3)
+          << "channel " << c << " frame " << i;
+    }
+  }
+}
+
+TEST(ConvolverDspTest, SparseLongImpulseResponseReachesEveryStage) {
+  static constexpr size_t IMPULSE_RESPONSE_LENGTH = 40000;
+  static constexpr size_t FRAMES = 45000;
+  static constexpr size_t BLOCK_SIZE = 128;
+
+  // one tap in every stage, including the ones at the maximal partition size
+  std::vector<float> impulseResponse(IMPULSE_RESPONSE_LENGTH, 0.0f);
+  for (size_t tap : {0, 129, 700, 1500, 3000, 6000, 12000, 20000, 39999}) {
+    impulseResponse[tap] = 1.0f / static_cast<float>(tap % 5 + 1);
+  }
+
+  std::vector<float> input(FRAMES);
+  for (size_t i = 0; i < FRAMES; ++i) {
+    input[i] = testSignal(i, 5);
+  }
+
+  audioapi::dsp::Convolver convolver(
+      {{0, 0, impulseResponse.data()}}, IMPULSE_RESPONSE_LENGTH, 1.0f, false);
+
+  std::vector<float> output(FRAMES);
+  for (size_t frame = 0; frame < FRAMES; frame += BLOCK_SIZE) {
+    const float *inputs[] = {input.data() + frame};
+    float *outputs[] = {output.data() + frame};
+    convolver.process(inputs, outputs, 1, std::min(BLOCK_SIZE, FRAMES - frame));
+  }
+
+  for (size_t i = 0; i < FRAMES; i += 3) {
+    EXPECT_NEAR(output[i], convolveAt(input, impulseResponse, i), 1e-4)
+        << "frame " << i;
+  }
+}
+
+namespace {
+
+// Outputs a single impulse and stops, like a source node that ended.
+class StoppingImpulseNode : public audioapi::AudioNode {
+ public:
+  explicit StoppingImpulseNode(audioapi::BaseAudioContext *context)
+      : audioapi::AudioNode(context) {
+    isInitialized_ = true;
+  }
+
+ protected:
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int /*framesToProcess*/) override {
+    processingBus->zero();
+    for (int c = 0; c < processingBus->getNumberOfChannels(); ++c) {
+      processingBus->getChannel(c)->getData()[0] = 1.0f;
+    }
+    disable();
+    return processingBus;
+  }
+};
+
+} // namespace
+
+TEST_F(ConvolverTest, TailIsRenderedAfterInputStops) {
+  static constexpr size_t IMPULSE_RESPONSE_LENGTH = 1000;
+  static constexpr size_t TAP = IMPULSE_RESPONSE_LENGTH - 1;
+  static constexpr int FRAMES_TO_PROCESS = 128;
+
+  auto buffer = std::make_shared<audioapi::AudioBuffer>(
+      1, IMPULSE_RESPONSE_LENGTH, sampleRate);
+  buffer->getChannelData(0)[TAP] = 0.5f;
+
+  auto impulse = std::make_shared<StoppingImpulseNode>(context.get());
+  auto convolver = context->createConvolver();
+  auto destination = context->getDestination();
+  convolver->setNormalize(false);
+  convolver->setBuffer(buffer);
+
+  impulse->connect(convolver);
+  convolver->connect(destination);
+
+  std::vector<float> rendered;
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  auto tailEnd =
+      IMPULSE_RESPONSE_LENGTH + audioapi::CONVOLVER_HEAD_PARTITION_SIZE;
+  while (rendered.size() < tailEnd + 2 * FRAMES_TO_PROCESS) {
+    destination->renderAudio(bus, FRAMES_TO_PROCESS);
+    for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      rendered.push_back((*bus->getChannel(0))[i]);
+    }
+  }
+
+  // the impulse stopped in the first quantum, the echo of the tap follows
+  auto echo = TAP + audioapi::CONVOLVER_HEAD_PARTITION_SIZE;
+  EXPECT_NEAR(rendered[echo], 0.5f, 1e-4);
+  for (size_t i = 0; i < rendered.size(); ++i) {
+    if (i != echo) {
+      EXPECT_NEAR(rendered[i], 0.0f, 1e-4) << "frame " << i;
+    }
+  }
+  EXPECT_FALSE(convolver->isEnabled());
+}
+
+TEST(ConvolverDspTest, LateBackgroundStagesAreProcessedInline) {
+  static constexpr size_t IMPULSE_RESPONSE_LENGTH = 40000;
+  static constexpr size_t FRAMES = 45000;
+  static constexpr size_t BLOCK_SIZE = 128;
+
+  std::vector<float> impulseResponse(IMPULSE_RESPONSE_LENGTH, 0.0f);
+  for (size_t tap : {0, 3000, 6000, 12000, 20000, 39999}) {
+    impulseResponse[tap] = 1.0f / static_cast<float>(tap % 5 + 1);
+  }
+
+  std::vector<float> input(FRAMES);
+  for (size_t i = 0; i < FRAMES; ++i) {
+    input[i] = testSignal(i, 2);
+  }
+
+  // Blocks are processed much faster than real time, so the background
+  // thread is late all the time.
+  audioapi::dsp::Convolver convolver(
+      {{0, 0, impulseResponse.data()}}, IMPULSE_RESPONSE_LENGTH, 1.0f, true);
+
+  std::vector<float> output(FRAMES);
+  for (size_t frame = 0; frame < FRAMES; frame += BLOCK_SIZE) {
+    const float *inputs[] = {input.data() + frame};
+    float *outputs[] = {output.data() + frame};
+    convolver.process(inputs, outputs, 1, std::min(BLOCK_SIZE, FRAMES - frame));
+  }
+
+  // Output is missing only where the background thread was busy with the
+  // very block that was due.
+  size_t mismatchedFrames = 0;
+  for (size_t i = 0; i < FRAMES; ++i) {
+    if (std::abs(output[i] - convolveAt(input, impulseResponse, i)) > 1e-4) {
+      ++mismatchedFrames;
+    }
+  }
+
+  if (convolver.getNumberOfLateBlocks() == 0) {
+    EXPECT_EQ(mismatchedFrames, 0);
+  }
+  EXPECT_LE(mismatchedFrames, convolver.getNumberOfLateBlocks() * BLOCK_SIZE);
+}
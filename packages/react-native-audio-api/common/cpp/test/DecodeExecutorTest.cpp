@@ -0,0 +1,163 @@
+#include <audioapi/utils/DecodeExecutor.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using audioapi::DecodeExecutor;
+
+TEST(DecodeExecutorTest, RunsAllScheduledTasks) {
+  std::atomic<int> runTasks = 0;
+  {
+    DecodeExecutor executor(3);
+    EXPECT_EQ(executor.getNumberOfThreads(), 3);
+
+    std::vector<std::promise<void>> done(16);
+    for (size_t i = 0; i < done.size(); ++i) {
+      executor.schedule(
+          i,
+          DecodeExecutor::Priority::HIGH,
+          [&runTasks, &promise = done[i]]() {
+            runTasks++;
+            promise.set_value();
+          },
+          []() { FAIL() << "no task should be cancelled"; });
+    }
+
+    for (auto &promise : done) {
+      promise.get_future().wait();
+    }
+  }
+  EXPECT_EQ(runTasks, 16);
+}
+
+TEST(DecodeExecutorTest, CreatesAtLeastOneThread) {
+  DecodeExecutor executor(0);
+  EXPECT_EQ(executor.getNumberOfThreads(), 1);
+}
+
+TEST(DecodeExecutorTest, HighPriorityTasksRunFirst) {
+  DecodeExecutor executor(1);
+  std::promise<void> release;
+  std::promise<void> started;
+  std::mutex mutex;
+  std::vector<int> order;
+  std::promise<void> done;
+
+  // keeps the only worker busy while the other tasks are queued
+  executor.schedule(
+      0,
+      DecodeExecutor::Priority::HIGH,
+      [&started, future = release.get_future().share()]() {
+        started.set_value();
+        future.wait();
+      },
+      []() {});
+  started.get_future().wait();
+
+  auto record = [&mutex, &order](int value) {
+    return [&mutex, &order, value]() {
+      std::lock_guard lock(mutex);
+      order.push_back(value);
+    };
+  };
+  executor.schedule(1, DecodeExecutor::Priority::LOW, record(1), []() {});
+  executor.schedule(2, DecodeExecutor::Priority::HIGH, record(2), []() {});
+  executor.schedule(3, DecodeExecutor::Priority::LOW, record(3), []() {});
+  executor.schedule(
+      4,
+      DecodeExecutor::Priority::LOW,
+      [&done]() { done.set_value(); },
+      []() {});
+  executor.schedule(5, DecodeExecutor::Priority::HIGH, record(5), []() {});
+
+  release.set_value();
+  done.get_future().wait();
+
+  EXPECT_EQ(order, (std::vector<int>{2, 5, 1, 3}));
+}
+
+TEST(DecodeExecutorTest, CancelsPendingTask) {
+  DecodeExecutor executor(1);
+  std::promise<void> release;
+  std::promise<void> started;
+  std::atomic<bool> cancelledTaskRun = false;
+  std::atomic<int> cancellations = 0;
+
+  executor.schedule(
+      0,
+      DecodeExecutor::Priority::HIGH,
+      [&started, future = release.get_future().share()]() {
+        started.set_value();
+        future.wait();
+      },
+      [&cancellations]() { cancellations++; });
+  started.get_future().wait();
+
+  executor.schedule(
+      1,
+      DecodeExecutor::Priority::LOW,
+      [&cancelledTaskRun]() { cancelledTaskRun = true; },
+      [&cancellations]() { cancellations++; });
+
+  // the running task and unknown ids can not be cancelled
+  EXPECT_FALSE(executor.cancel(0));
+  EXPECT_FALSE(executor.cancel(7));
+  EXPECT_TRUE(executor.cancel(1));
+  EXPECT_FALSE(executor.cancel(1));
+  EXPECT_EQ(cancellations, 1);
+
+  std::promise<void> done;
+  executor.schedule(
+      2,
+      DecodeExecutor::Priority::LOW,
+      [&done]() { done.set_value(); },
+      []() {});
+  release.set_value();
+  done.get_future().wait();
+
+  EXPECT_FALSE(cancelledTaskRun);
+}
+
+TEST(DecodeExecutorTest, DestructorCancelsPendingTasks) {
+  std::promise<void> release;
+  std::promise<void> started;
+  std::atomic<int> runTasks = 0;
+  std::atomic<int> cancellations = 0;
+
+  {
+    DecodeExecutor executor(1);
+    executor.schedule(
+        0,
+        DecodeExecutor::Priority::HIGH,
+        [&started, &runTasks, future = release.get_future().share()]() {
+          started.set_value();
+          future.wait();
+          runTasks++;
+        },
+        [&cancellations]() { cancellations++; });
+    started.get_future().wait();
+
+    for (uint64_t i = 1; i <= 3; ++i) {
+      executor.schedule(
+          i,
+          DecodeExecutor::Priority::LOW,
+          [&runTasks]() { runTasks++; },
+          [&cancellations]() { cancellations++; });
+    }
+
+    // The destructor waits for the running task, it is released only once
+    // the executor is being destroyed.
+    std::thread releaser([&release]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      release.set_value();
+    });
+    releaser.detach();
+  }
+
+  EXPECT_EQ(runTasks, 1);
+  EXPECT_EQ(cancellations, 3);
+}
@@ -0,0 +1,116 @@
+#include <audioapi/core/utils/DecodedAudioCache.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace audioapi;
+
+class DecodedAudioCacheTest : public ::testing::Test {
+ protected:
+  std::string directory;
+  std::string sourcePath;
+
+  void SetUp() override {
+    auto name = std::string(
+        ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    directory = ::testing::TempDir() + "decoded_audio_cache_" + name;
+    sourcePath = directory + "_source.wav";
+    writeSource("source file");
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(sourcePath);
+    std::filesystem::remove_all(directory);
+  }
+
+  void writeSource(const std::string &content) const {
+    std::ofstream(sourcePath, std::ios::binary | std::ios::trunc) << content;
+  }
+
+  static std::shared_ptr<AudioBus> createBus(size_t length, float sampleRate) {
+    auto bus = std::make_shared<AudioBus>(length, 2, sampleRate);
+    for (size_t i = 0; i < length; ++i) {
+      (*bus)[0][i] = static_cast<float>(i);
+      (*bus)[1][i] = -static_cast<float>(i);
+    }
+    return bus;
+  }
+};
+
+TEST_F(DecodedAudioCacheTest, MapsStoredEntry) {
+  DecodedAudioCache cache(directory);
+  EXPECT_EQ(cache.load(sourcePath, 48000.0f), nullptr);
+
+  auto bus = createBus(1001, 48000.0f);
+  ASSERT_TRUE(cache.store(sourcePath, *bus));
+
+  auto loaded = cache.load(sourcePath, 48000.0f);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->getNumberOfChannels(), 2);
+  EXPECT_EQ(loaded->getSize(), 1001);
+  EXPECT_EQ(loaded->getSampleRate(), 48000.0f);
+
+  for (int channel = 0; channel < 2; ++channel) {
+    auto *data = loaded->getChannel(channel)->getData();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % AudioArray::ALIGNMENT, 0);
+    for (size_t i = 0; i < 1001; ++i) {
+      EXPECT_EQ(data[i], (*bus)[channel][i]);
+    }
+  }
+}
+
+TEST_F(DecodedAudioCacheTest, MissesForOtherSampleRate) {
+  DecodedAudioCache cache(directory);
+  ASSERT_TRUE(cache.store(sourcePath, *createBus(64, 48000.0f)));
+
+  EXPECT_EQ(cache.load(sourcePath, 44100.0f), nullptr);
+  EXPECT_NE(cache.load(sourcePath, 48000.0f), nullptr);
+}
+
+TEST_F(DecodedAudioCacheTest, MissesWhenSourceChanges) {
+  DecodedAudioCache cache(directory);
+  ASSERT_TRUE(cache.store(sourcePath, *createBus(64, 48000.0f)));
+
+  writeSource("another source file");
+  EXPECT_EQ(cache.load(sourcePath, 48000.0f), nullptr);
+
+  ASSERT_TRUE(cache.store(sourcePath, *createBus(32, 48000.0f)));
+  auto loaded = cache.load(sourcePath, 48000.0f);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->getSize(), 32);
+}
+
+TEST_F(DecodedAudioCacheTest, WritesDoNotChangeEntry) {
+  DecodedAudioCache cache(directory);
+  ASSERT_TRUE(cache.store(sourcePath, *createBus(64, 48000.0f)));
+
+  auto loaded = cache.load(sourcePath, 48000.0f);
+  ASSERT_NE(loaded, nullptr);
+  (*loaded)[0][10] = 100.0f;
+
+  // a resize moves the channel out of the mapping
+  loaded->getChannel(1)->resize(8);
+  EXPECT_EQ((*loaded)[1][0], 0.0f);
+
+  auto reloaded = cache.load(sourcePath, 48000.0f);
+  ASSERT_NE(reloaded, nullptr);
+  EXPECT_EQ((*reloaded)[0][10], 10.0f);
+  EXPECT_EQ((*reloaded)[1][10], -10.0f);
+}
+
+TEST_F(DecodedAudioCacheTest, BufferOutlivesCache) {
+  std::shared_ptr<AudioBus> loaded;
+  {
+    DecodedAudioCache cache(directory);
+    ASSERT_TRUE(cache.store(sourcePath, *createBus(64, 48000.0f)));
+    loaded = cache.load(sourcePath, 48000.0f);
+  }
+
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ((*loaded)[1][63], -63.0f);
+}
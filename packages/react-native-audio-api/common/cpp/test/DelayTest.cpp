@@ -0,0 +1,245 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/DelayNode.h>
+#include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+class DelayTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+};
+
+class TestableDelayNode : public audioapi::DelayNode {
+ public:
+  explicit TestableDelayNode(
+      audioapi::BaseAudioContext *context,
+      float maxDelayTime)
+      : audioapi::DelayNode(context, maxDelayTime) {}
+
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    return audioapi::DelayNode::processNode(processingBus, framesToProcess);
+  }
+};
+
+// Outputs a single impulse in its first quantum.
+class ImpulseNode : public audioapi::AudioNode {
+ public:
+  explicit ImpulseNode(audioapi::BaseAudioContext *context, float amplitude)
+      : audioapi::AudioNode(context), amplitude_(amplitude) {
+    isInitialized_ = true;
+  }
+
+ protected:
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int /*framesToProcess*/) override {
+    processingBus->zero();
+    if (!isDone_) {
+      for (int c = 0; c < processingBus->getNumberOfChannels(); ++c) {
+        processingBus->getChannel(c)->getData()[0] = amplitude_;
+      }
+      isDone_ = true;
+    }
+    return processingBus;
+  }
+
+ private:
+  float amplitude_;
+  bool isDone_ = false;
+};
+
+TEST_F(DelayTest, DelayCanBeCreated) {
+  auto delay = context->createDelay(1.0f);
+  ASSERT_NE(delay, nullptr);
+  EXPECT_FLOAT_EQ(delay->getDelayTimeParam()->getValue(), 0.0f);
+  EXPECT_FLOAT_EQ(delay->getDelayTimeParam()->getMaxValue(), 1.0f);
+}
+
+TEST_F(DelayTest, IntegerDelayShiftsInput) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  static constexpr int NUMBER_OF_QUANTA = 4;
+  static constexpr int DELAY_FRAMES = 300;
+  auto delay = std::make_shared<TestableDelayNode>(context.get(), 1.0f);
+  delay->getDelayTimeParam()->setValue(
+      static_cast<float>(DELAY_FRAMES) / sampleRate);
+
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  for (int quantum = 0; quantum < NUMBER_OF_QUANTA; ++quantum) {
+    for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      auto frame = quantum * FRAMES_TO_PROCESS + i;
+      bus->getChannel(0)->getData()[i] = static_cast<float>(frame + 1);
+      bus->getChannel(1)->getData()[i] = -static_cast<float>(frame + 1);
+    }
+
+    auto output = delay->processNode(bus, FRAMES_TO_PROCESS);
+    for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      auto frame = quantum * FRAMES_TO_PROCESS + i;
+      auto expected = frame < DELAY_FRAMES
+          ? 0.0f
+          : static_cast<float>(frame - DELAY_FRAMES + 1);
+      EXPECT_NEAR((*output->getChannel(0))[i], expected, 1e-2);
+      EXPECT_NEAR((*output->getChannel(1))[i], -expected, 1e-2);
+    }
+  }
+}
+
+TEST_F(DelayTest, FractionalDelayInterpolatesLinearly) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  static constexpr float DELAY_FRAMES = 10.25f;
+  auto delay = std::make_shared<TestableDelayNode>(context.get(), 1.0f);
+  delay->getDelayTimeParam()->setValue(DELAY_FRAMES / sampleRate);
+
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    bus->getChannel(0)->getData()[i] = static_cast<float>(i);
+    bus->getChannel(1)->getData()[i] = static_cast<float>(i);
+  }
+
+  auto output = delay->processNode(bus, FRAMES_TO_PROCESS);
+  // a linear signal is reproduced exactly by linear interpolation
+  for (int i = 11; i < FRAMES_TO_PROCESS; ++i) {
+    EXPECT_NEAR((*output->getChannel(0))[i], i - DELAY_FRAMES, 1e-3);
+  }
+}
+
+TEST_F(DelayTest, AutomatedDelayIsReadPerFrame) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  static constexpr float END_DELAY_FRAMES = 64.0f;
+  auto delay = std::make_shared<TestableDelayNode>(context.get(), 1.0f);
+  auto delayTime = delay->getDelayTimeParam();
+  delayTime->setValueAtTime(0.0f, 0.0);
+  delayTime->linearRampToValueAtTime(
+      END_DELAY_FRAMES / sampleRate,
+      static_cast<double>(FRAMES_TO_PROCESS) / sampleRate);
+
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    bus->getChannel(0)->getData()[i] = static_cast<float>(i);
+    bus->getChannel(1)->getData()[i] = static_cast<float>(i);
+  }
+
+  auto output = delay->processNode(bus, FRAMES_TO_PROCESS);
+  // delay grows from 0 to half a frame per frame, so the output is i / 2
+  for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+    auto delayFrames = END_DELAY_FRAMES * i / FRAMES_TO_PROCESS;
+    EXPECT_NEAR((*output->getChannel(1))[i], i - delayFrames, 1e-2);
+  }
+}
+
+TEST_F(DelayTest, FeedbackCycleProducesDecayingEchoes) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  static constexpr int NUMBER_OF_QUANTA = 8;
+  static constexpr int DELAY_FRAMES = 200;
+  auto impulse = std::make_shared<ImpulseNode>(context.get(), 0.5f);
+  auto delay = context->createDelay(1.0f);
+  auto feedback = context->createGain();
+  auto destination = context->getDestination();
+
+  delay->getDelayTimeParam()->setValue(
+      static_cast<float>(DELAY_FRAMES) / sampleRate);
+  feedback->getGainParam()->setValue(0.5f);
+
+  impulse->connect(delay);
+  delay->connect(feedback);
+  feedback->connect(delay);
+  delay->connect(destination);
+
+  std::vector<float> rendered;
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  for (int quantum = 0; quantum < NUMBER_OF_QUANTA; ++quantum) {
+    destination->renderAudio(bus, FRAMES_TO_PROCESS);
+    for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      rendered.push_back((*bus->getChannel(0))[i]);
+    }
+  }
+
+  for (size_t frame = 0; frame < rendered.size(); ++frame) {
+    auto expected = 0.0f;
+    if (frame % DELAY_FRAMES == 0 && frame != 0) {
+      expected = 0.5f / static_cast<float>(1 << (frame / DELAY_FRAMES - 1));
+    }
+    EXPECT_NEAR(rendered[frame], expected, 1e-4) << "frame " << frame;
+  }
+}
+
+namespace {
+
+// Outputs a single impulse and stops, like a source node that ended.
+class StoppingImpulseNode : public audioapi::AudioNode {
+ public:
+  explicit StoppingImpulseNode(audioapi::BaseAudioContext *context)
+      : audioapi::AudioNode(context) {
+    isInitialized_ = true;
+  }
+
+ protected:
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int /*framesToProcess*/) override {
+    processingBus->zero();
+    for (int c = 0; c < processingBus->getNumberOfChannels(); ++c) {
+      processingBus->getChannel(c)->getData()[0] = 0.5f;
+    }
+    disable();
+    return processingBus;
+  }
+};
+
+} // namespace
+
+TEST_F(DelayTest, EchoIsRenderedAfterInputStops) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  static constexpr int DELAY_FRAMES = 1000;
+  static constexpr float MAX_DELAY_TIME = 0.1f;
+  auto impulse = std::make_shared<StoppingImpulseNode>(context.get());
+  auto delay = context->createDelay(MAX_DELAY_TIME);
+  auto destination = context->getDestination();
+
+  delay->getDelayTimeParam()->setValue(
+      static_cast<float>(DELAY_FRAMES) / sampleRate);
+
+  impulse->connect(delay);
+  delay->connect(destination);
+
+  std::vector<float> rendered;
+  auto bus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  auto tailEnd = static_cast<size_t>(std::ceil(MAX_DELAY_TIME * sampleRate)) +
+      FRAMES_TO_PROCESS;
+  while (rendered.size() < tailEnd + 2 * FRAMES_TO_PROCESS) {
+    destination->renderAudio(bus, FRAMES_TO_PROCESS);
+    for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      rendered.push_back((*bus->getChannel(0))[i]);
+    }
+  }
+
+  // the impulse stopped in the first quantum, its echo still comes out
+  EXPECT_NEAR(rendered[DELAY_FRAMES], 0.5f, 1e-4);
+  for (size_t i = 0; i < rendered.size(); ++i) {
+    if (i != DELAY_FRAMES) {
+      EXPECT_NEAR(rendered[i], 0.0f, 1e-4) << "frame " << i;
+    }
+  }
+  EXPECT_FALSE(delay->isEnabled());
+}
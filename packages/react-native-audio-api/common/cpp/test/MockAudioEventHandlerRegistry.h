@@ -19,4 +19,6 @@ class MockAudioEventHandlerRegistry : public audioapi::IAudioEventHandlerRegistr
               (const std::string &eventName, const EventMap &body), (override));
   MOCK_METHOD(void, invokeHandlerWithEventBody,
               (const std::string &eventName, uint64_t listenerId, const EventMap &body), (override));
+
+  MOCK_METHOD(void, enqueueEvent, (const audioapi::AudioEvent &event), (override));
 };
@@ -0,0 +1,83 @@
+#include <audioapi/utils/MpscQueue.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using audioapi::MpscQueue;
+
+TEST(MpscQueueTest, RoundsCapacityUpToPowerOfTwo) {
+  MpscQueue<int> queue(100);
+  EXPECT_EQ(queue.getCapacity(), 128);
+}
+
+TEST(MpscQueueTest, PopsInOrderAcrossTheWrap) {
+  MpscQueue<int> queue(4);
+  int next = 0;
+  int expected = 0;
+
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_TRUE(queue.tryPush(next++));
+    }
+
+    int value = -1;
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_TRUE(queue.tryPop(value));
+      EXPECT_EQ(value, expected++);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+  }
+}
+
+TEST(MpscQueueTest, RejectsValuesWhenFull) {
+  MpscQueue<int> queue(4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.tryPush(i));
+  }
+  EXPECT_FALSE(queue.tryPush(4));
+
+  int value = -1;
+  ASSERT_TRUE(queue.tryPop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(queue.tryPush(4));
+}
+
+TEST(MpscQueueTest, KeepsOrderOfEachProducer) {
+  struct Record {
+    int producer;
+    int sequence;
+  };
+
+  static constexpr int numberOfProducers = 4;
+  static constexpr int recordsPerProducer = 20000;
+  MpscQueue<Record> queue(64);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < numberOfProducers; ++p) {
+    producers.emplace_back([&queue, p]() {
+      for (int i = 0; i < recordsPerProducer; ++i) {
+        while (!queue.tryPush({p, i})) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<int> nextSequence(numberOfProducers, 0);
+  int received = 0;
+  Record record{};
+  while (received < numberOfProducers * recordsPerProducer) {
+    if (!queue.tryPop(record)) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    ASSERT_EQ(record.sequence, nextSequence[record.producer]);
+    nextSequence[record.producer] += 1;
+    received += 1;
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+}
@@ -0,0 +1,87 @@
+#include <audioapi/core/effects/PeriodicWave.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/utils/Benchmark.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+using namespace audioapi;
+
+// Prints the throughput of a patch of many oscillators with constant
+// frequencies, rendered sample by sample as OscillatorNode used to and in
+// blocks, in output samples per second.
+TEST(OscillatorBenchmark, Throughput) {
+  constexpr float sampleRate = 48000.0f;
+  constexpr int numberOfVoices = 64;
+  constexpr int numberOfQuanta = 2000;
+  constexpr int repetitions = 5;
+
+  const std::pair<OscillatorType, const char *> types[] = {
+      {OscillatorType::SINE, "sine"}, {OscillatorType::SAWTOOTH, "sawtooth"}};
+
+  std::vector<float> frequencies(numberOfVoices);
+  for (int voice = 0; voice < numberOfVoices; ++voice) {
+    frequencies[voice] =
+        55.0f * std::pow(2.0f, static_cast<float>(voice) / 12.0f);
+  }
+
+  std::vector<float> output(RENDER_QUANTUM_SIZE);
+
+  for (auto [type, name] : types) {
+    PeriodicWave wave(sampleRate, type, false);
+    auto size = static_cast<float>(wave.getPeriodicWaveSize());
+
+    auto measure = [&](auto &&renderQuantum) {
+      double bestDuration = 0.0;
+      for (int i = 0; i < repetitions; ++i) {
+        auto duration = benchmarks::getExecutionTime([&]() {
+          for (int quantum = 0; quantum < numberOfQuanta; ++quantum) {
+            renderQuantum();
+          }
+        });
+        if (i == 0 || duration < bestDuration) {
+          bestDuration = duration;
+        }
+      }
+      return static_cast<double>(
+                 numberOfVoices * numberOfQuanta * RENDER_QUANTUM_SIZE) /
+          (bestDuration * 1e-9);
+    };
+
+    std::vector<float> phases(numberOfVoices, 0.0f);
+    auto perSample = measure([&]() {
+      for (int voice = 0; voice < numberOfVoices; ++voice) {
+        auto phaseIncrement = frequencies[voice] * wave.getScale();
+        auto &phase = phases[voice];
+        for (size_t i = 0; i < RENDER_QUANTUM_SIZE; ++i) {
+          output[i] = wave.getSample(frequencies[voice], phase, phaseIncrement);
+          phase += phaseIncrement;
+          phase -= std::floor(phase / size) * size;
+        }
+      }
+    });
+
+    std::vector<uint32_t> fixedPointPhases(numberOfVoices, 0);
+    auto block = measure([&]() {
+      for (int voice = 0; voice < numberOfVoices; ++voice) {
+        fixedPointPhases[voice] = wave.render(
+            frequencies[voice],
+            fixedPointPhases[voice],
+            output.data(),
+            RENDER_QUANTUM_SIZE);
+      }
+    });
+
+    std::printf(
+        "%-8s %d voices, per sample: %8.2f Msamples/s, "
+        "block: %8.2f Msamples/s (%.1fx)\n",
+        name,
+        numberOfVoices,
+        perSample / 1e6,
+        block / 1e6,
+        block / perSample);
+  }
+}
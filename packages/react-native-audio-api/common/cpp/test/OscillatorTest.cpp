@@ -1,7 +1,10 @@
 #include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/effects/PeriodicWave.h>
 #include <audioapi/core/sources/OscillatorNode.h>
 #include <audioapi/core/utils/worklets/SafeIncludes.h>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
 #include "MockAudioEventHandlerRegistry.h"
 
 class OscillatorTest : public ::testing::Test {
@@ -21,3 +24,49 @@ TEST_F(OscillatorTest, OscillatorCanBeCreated) {
   auto osc = context->createOscillator();
   ASSERT_NE(osc, nullptr);
 }
+
+TEST(PeriodicWaveTest, RenderMatchesPerSampleInterpolation) {
+  constexpr float sampleRate = 44100.0f;
+  constexpr size_t frames = 1000;
+  audioapi::PeriodicWave wave(
+      sampleRate, audioapi::OscillatorType::SAWTOOTH, false);
+  auto size = static_cast<double>(wave.getPeriodicWaveSize());
+
+  // covers the linear, 3-point and 5-point interpolation
+  for (float frequency : {440.0f, 3.0f, 1.5f, -220.0f}) {
+    std::vector<float> output(frames);
+    wave.render(frequency, 0, output.data(), frames);
+
+    auto phaseIncrement = frequency * wave.getScale();
+    for (size_t i = 0; i < frames; ++i) {
+      // accumulated in double, so the reference does not drift
+      auto phase = static_cast<double>(phaseIncrement) * static_cast<double>(i);
+      phase -= std::floor(phase / size) * size;
+
+      auto expected = wave.getSample(
+          frequency, static_cast<float>(phase), std::fabs(phaseIncrement));
+      EXPECT_NEAR(output[i], expected, 1e-3f)
+          << frequency << " Hz, frame " << i;
+    }
+  }
+}
+
+TEST(PeriodicWaveTest, RenderContinuesFromReturnedPhase) {
+  constexpr size_t frames = 300;
+  audioapi::PeriodicWave wave(44100.0f, audioapi::OscillatorType::SINE, false);
+
+  std::vector<float> whole(frames);
+  auto endPhase = wave.render(1000.0f, 0, whole.data(), frames);
+
+  // the same tone rendered in uneven blocks, per frame frequencies included
+  std::vector<float> blocks(frames);
+  std::vector<float> frequencies(frames, 1000.0f);
+  auto phase = wave.render(1000.0f, 0, blocks.data(), 100);
+  phase = wave.render(frequencies.data(), phase, blocks.data() + 100, 77);
+  phase = wave.render(1000.0f, phase, blocks.data() + 177, frames - 177);
+
+  EXPECT_EQ(phase, endPhase);
+  for (size_t i = 0; i < frames; ++i) {
+    EXPECT_FLOAT_EQ(blocks[i], whole[i]) << "frame " << i;
+  }
+}
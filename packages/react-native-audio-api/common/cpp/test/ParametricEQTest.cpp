@@ -0,0 +1,114 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/effects/BiquadFilterNode.h>
+#include <audioapi/core/effects/ParametricEQNode.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include "MockAudioEventHandlerRegistry.h"
+
+class ParametricEQTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+};
+
+class TestableParametricEQNode : public audioapi::ParametricEQNode {
+ public:
+  explicit TestableParametricEQNode(
+      audioapi::BaseAudioContext *context,
+      int numberOfBands)
+      : audioapi::ParametricEQNode(context, numberOfBands) {}
+
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    return audioapi::ParametricEQNode::processNode(
+        processingBus, framesToProcess);
+  }
+};
+
+class TestableBiquadFilterNode : public audioapi::BiquadFilterNode {
+ public:
+  explicit TestableBiquadFilterNode(audioapi::BaseAudioContext *context)
+      : audioapi::BiquadFilterNode(context) {}
+
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    return audioapi::BiquadFilterNode::processNode(
+        processingBus, framesToProcess);
+  }
+};
+
+TEST_F(ParametricEQTest, ParametricEQCanBeCreated) {
+  auto parametricEQ = context->createParametricEQ(10);
+  ASSERT_NE(parametricEQ, nullptr);
+  EXPECT_EQ(parametricEQ->getNumberOfBands(), 10);
+}
+
+TEST_F(ParametricEQTest, MatchesChainOfBiquadFilters) {
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  struct BandSettings {
+    std::string type;
+    float frequency;
+    float Q;
+    float gain;
+  };
+  const std::vector<BandSettings> settings = {
+      {"lowshelf", 100.0f, 1.0f, 6.0f},
+      {"peaking", 1000.0f, 2.0f, -4.0f},
+      {"highshelf", 8000.0f, 1.0f, 3.0f}};
+
+  auto parametricEQ = std::make_shared<TestableParametricEQNode>(
+      context.get(), static_cast<int>(settings.size()));
+  std::vector<std::shared_ptr<TestableBiquadFilterNode>> filters;
+  for (int band = 0; band < static_cast<int>(settings.size()); ++band) {
+    parametricEQ->setBandType(band, settings[band].type);
+    parametricEQ->setBandFrequency(band, settings[band].frequency);
+    parametricEQ->setBandQ(band, settings[band].Q);
+    parametricEQ->setBandGain(band, settings[band].gain);
+
+    auto filter = std::make_shared<TestableBiquadFilterNode>(context.get());
+    filter->setType(settings[band].type);
+    filter->getFrequencyParam()->setValue(settings[band].frequency);
+    filter->getQParam()->setValue(settings[band].Q);
+    filter->getGainParam()->setValue(settings[band].gain);
+    filters.push_back(filter);
+  }
+
+  auto eqBus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+  auto chainBus =
+      std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, sampleRate);
+
+  for (int quantum = 0; quantum < 2; ++quantum) {
+    for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+      float left = (i % 9 == 0) ? 1.0f : -0.1f;
+      float right = (i % 4 == 0) ? -0.5f : 0.2f;
+      eqBus->getChannel(0)->getData()[i] = left;
+      eqBus->getChannel(1)->getData()[i] = right;
+      chainBus->getChannel(0)->getData()[i] = left;
+      chainBus->getChannel(1)->getData()[i] = right;
+    }
+
+    parametricEQ->processNode(eqBus, FRAMES_TO_PROCESS);
+    for (auto &filter : filters) {
+      filter->processNode(chainBus, FRAMES_TO_PROCESS);
+    }
+
+    for (int c = 0; c < 2; ++c) {
+      for (size_t i = 0; i < FRAMES_TO_PROCESS; ++i) {
+        EXPECT_NEAR(
+            (*eqBus->getChannel(c))[i], (*chainBus->getChannel(c))[i], 1e-5);
+      }
+    }
+  }
+}
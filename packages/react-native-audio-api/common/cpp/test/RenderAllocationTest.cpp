@@ -0,0 +1,203 @@
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/DelayNode.h>
+#include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/sources/OscillatorNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AllocationGuard.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/AudioBusArena.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+#if !RN_AUDIO_API_DEBUG_ALLOCATIONS
+#error "RenderAllocationTest needs RN_AUDIO_API_DEBUG_ALLOCATIONS=1"
+#endif
+
+// Built into allocation_tests, where global operator new is counted and
+// AllocationGuard asserts on the audio thread.
+class RenderAllocationTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  std::shared_ptr<audioapi::AudioBus> bus;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+    bus = std::make_shared<audioapi::AudioBus>(
+        audioapi::RENDER_QUANTUM_SIZE, 2, sampleRate);
+  }
+
+  // Renders a few quanta, returns the number of allocations made meanwhile.
+  size_t render(int numberOfQuanta = 4) {
+    auto destination = context->getDestination();
+    auto allocationCount = audioapi::getThreadAllocationCount();
+
+    for (int quantum = 0; quantum < numberOfQuanta; ++quantum) {
+      destination->renderAudio(bus, audioapi::RENDER_QUANTUM_SIZE);
+    }
+
+    return audioapi::getThreadAllocationCount() - allocationCount;
+  }
+};
+
+namespace {
+
+// Outputs a mono bus, so the stereo nodes it feeds mix it in a bus of the
+// arena.
+class MonoSourceNode : public audioapi::AudioNode {
+ public:
+  explicit MonoSourceNode(audioapi::BaseAudioContext *context)
+      : audioapi::AudioNode(context),
+        monoBus_(std::make_shared<audioapi::AudioBus>(
+            audioapi::RENDER_QUANTUM_SIZE,
+            1,
+            context->getSampleRate())) {
+    numberOfInputs_ = 0;
+    isInitialized_ = true;
+  }
+
+ protected:
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &,
+      int framesToProcess) override {
+    auto *data = monoBus_->getChannel(0)->getData();
+    std::fill(data, data + framesToProcess, 1.0f);
+    return monoBus_;
+  }
+
+ private:
+  std::shared_ptr<audioapi::AudioBus> monoBus_;
+};
+
+} // namespace
+
+TEST_F(RenderAllocationTest, GraphChangesAreAppliedWithoutAllocating) {
+  // More nodes than the initial storage and more inputs than the initial
+  // connection lists hold, both are reserved on this thread.
+  static constexpr int NUMBER_OF_OSCILLATORS = 40;
+
+  auto gain = context->createGain();
+  auto delay = context->createDelay(1.0f);
+  auto feedback = context->createGain();
+  auto destination = context->getDestination();
+
+  std::vector<std::shared_ptr<audioapi::OscillatorNode>> oscillators;
+  for (int i = 0; i < NUMBER_OF_OSCILLATORS; ++i) {
+    auto oscillator = context->createOscillator();
+    oscillator->start(0.0);
+    oscillator->connect(gain);
+    oscillators.push_back(oscillator);
+  }
+
+  oscillators[0]->connect(gain->getGainParam());
+  gain->connect(delay);
+  delay->connect(feedback);
+  feedback->connect(delay);
+  delay->connect(destination);
+  gain->connect(destination);
+
+  EXPECT_EQ(render(), 0);
+
+  for (int i = 0; i < NUMBER_OF_OSCILLATORS; i += 2) {
+    oscillators[i]->disconnect(gain);
+  }
+  oscillators[0]->disconnect(gain->getGainParam());
+
+  EXPECT_EQ(render(), 0);
+
+  // connecting twice keeps a single connection
+  for (int i = 0; i < NUMBER_OF_OSCILLATORS; ++i) {
+    oscillators[i]->connect(gain);
+  }
+  oscillators[1]->connect(gain);
+
+  EXPECT_EQ(render(), 0);
+
+  gain->disconnect();
+  feedback->disconnect();
+
+  EXPECT_EQ(render(), 0);
+}
+
+TEST_F(RenderAllocationTest, DroppedNodesAreReleasedOffTheAudioThread) {
+  auto oscillator = context->createOscillator();
+  auto gain = context->createGain();
+  oscillator->start(0.0);
+  oscillator->connect(gain);
+  oscillator->connect(gain->getGainParam());
+  gain->connect(context->getDestination());
+
+  EXPECT_EQ(render(), 0);
+
+  oscillator->disconnect();
+  oscillator->disconnect(gain->getGainParam());
+  gain->disconnect();
+
+  std::weak_ptr<audioapi::GainNode> releasedGain = gain;
+
+  gain.reset();
+
+  EXPECT_EQ(render(), 0);
+
+  for (int i = 0; i < 1000 && !releasedGain.expired(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_TRUE(releasedGain.expired());
+}
+
+TEST_F(RenderAllocationTest, InputsOfOtherLayoutAreMixedInArenaBus) {
+  auto source = std::make_shared<MonoSourceNode>(context.get());
+  auto gain = context->createGain();
+
+  source->connect(gain);
+  gain->connect(context->getDestination());
+
+  EXPECT_EQ(render(), 0);
+
+  // the mono input is up-mixed to both channels
+  EXPECT_FLOAT_EQ((*bus->getChannel(0))[0], 1.0f);
+  EXPECT_FLOAT_EQ((*bus->getChannel(1))[0], 1.0f);
+}
+
+TEST(AudioBusArenaTest, BusesAreHandedOutByIndexAndAligned) {
+  static constexpr size_t NUMBER_OF_NODES = 4;
+  audioapi::AudioBusArena arena(44100, NUMBER_OF_NODES);
+
+  std::vector<size_t> indices;
+  for (int numberOfChannels : {1, 2}) {
+    for (size_t i = 0; i < NUMBER_OF_NODES; ++i) {
+      auto index = arena.acquire(numberOfChannels);
+      ASSERT_NE(index, audioapi::AudioBusArena::NO_BUS);
+
+      auto *bus = arena.getBus(index);
+      EXPECT_EQ(bus->getNumberOfChannels(), numberOfChannels);
+      for (int c = 0; c < numberOfChannels; ++c) {
+        auto address = reinterpret_cast<uintptr_t>(bus->getChannel(c)->getData());
+        EXPECT_EQ(address % audioapi::AudioArray::ALIGNMENT, 0);
+      }
+      indices.push_back(index);
+    }
+
+    EXPECT_EQ(arena.acquire(numberOfChannels), audioapi::AudioBusArena::NO_BUS);
+  }
+
+  // no other layout is reserved
+  EXPECT_EQ(arena.acquire(6), audioapi::AudioBusArena::NO_BUS);
+
+  arena.getBus(indices[0])->getChannel(0)->getData()[0] = 1.0f;
+  arena.release(indices[0]);
+
+  auto index = arena.acquire(1);
+  EXPECT_EQ(index, indices[0]);
+  EXPECT_EQ(arena.getBus(index)->getChannel(0)->getData()[0], 0.0f);
+}
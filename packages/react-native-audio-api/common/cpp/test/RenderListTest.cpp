@@ -0,0 +1,152 @@
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/destinations/AudioDestinationNode.h>
+#include <audioapi/core/effects/GainNode.h>
+#include <audioapi/core/utils/AudioNodeManager.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+class RenderListTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  static constexpr int sampleRate = 44100;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+  }
+
+  std::vector<float> render(size_t frames) {
+    auto destination = context->getDestination();
+    auto bus = std::make_shared<audioapi::AudioBus>(
+        audioapi::RENDER_QUANTUM_SIZE, 2, sampleRate);
+
+    std::vector<float> rendered;
+    while (rendered.size() < frames) {
+      destination->renderAudio(bus, audioapi::RENDER_QUANTUM_SIZE);
+      for (int i = 0; i < audioapi::RENDER_QUANTUM_SIZE; ++i) {
+        rendered.push_back((*bus->getChannel(0))[i]);
+      }
+    }
+
+    return rendered;
+  }
+};
+
+namespace {
+
+// Outputs ones for a number of frames and disables itself in the quantum it
+// ends in, like a buffer source reaching the end of its buffer.
+class EndingSourceNode : public audioapi::AudioNode {
+ public:
+  EndingSourceNode(audioapi::BaseAudioContext *context, size_t length)
+      : audioapi::AudioNode(context), remainingFrames_(length) {
+    numberOfInputs_ = 0;
+    isInitialized_ = true;
+  }
+
+ protected:
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    auto frames = std::min(static_cast<size_t>(framesToProcess), remainingFrames_);
+    processingBus->zero();
+    for (int c = 0; c < processingBus->getNumberOfChannels(); ++c) {
+      auto *data = processingBus->getChannel(c)->getData();
+      std::fill(data, data + frames, 1.0f);
+    }
+
+    remainingFrames_ -= frames;
+    if (remainingFrames_ == 0) {
+      disable();
+    }
+
+    return processingBus;
+  }
+
+ private:
+  size_t remainingFrames_;
+};
+
+} // namespace
+
+TEST_F(RenderListTest, LastQuantumOfEndingSourceReachesDestination) {
+  static constexpr size_t SOURCE_LENGTH = audioapi::RENDER_QUANTUM_SIZE + 50;
+
+  auto source = std::make_shared<EndingSourceNode>(context.get(), SOURCE_LENGTH);
+  auto gain = context->createGain();
+  gain->getGainParam()->setValue(0.5f);
+
+  source->connect(gain);
+  gain->connect(context->getDestination());
+
+  auto rendered = render(3 * audioapi::RENDER_QUANTUM_SIZE);
+
+  // the source ends mid-quantum, its last frames pass through the gain too
+  for (size_t i = 0; i < rendered.size(); ++i) {
+    EXPECT_FLOAT_EQ(rendered[i], i < SOURCE_LENGTH ? 0.5f : 0.0f)
+        << "frame " << i;
+  }
+  EXPECT_FALSE(source->isEnabled());
+  EXPECT_FALSE(gain->isEnabled());
+}
+
+TEST_F(RenderListTest, LastQuantumOfEndingSourceReachesAudioParam) {
+  static constexpr size_t SOURCE_LENGTH = audioapi::RENDER_QUANTUM_SIZE - 28;
+
+  auto constant = std::make_shared<EndingSourceNode>(
+      context.get(), 4 * audioapi::RENDER_QUANTUM_SIZE);
+  auto modulator =
+      std::make_shared<EndingSourceNode>(context.get(), SOURCE_LENGTH);
+  auto gain = context->createGain();
+  gain->getGainParam()->setValue(0.0f);
+
+  constant->connect(gain);
+  modulator->connect(gain->getGainParam());
+  gain->connect(context->getDestination());
+
+  auto rendered = render(2 * audioapi::RENDER_QUANTUM_SIZE);
+
+  for (size_t i = 0; i < rendered.size(); ++i) {
+    EXPECT_FLOAT_EQ(rendered[i], i < SOURCE_LENGTH ? 1.0f : 0.0f)
+        << "frame " << i;
+  }
+}
+
+TEST_F(RenderListTest, OnlyLargeRenderGroupsAreCounted) {
+  auto destination = context->getDestination();
+  auto connectChain = [this, &destination](size_t length) {
+    std::shared_ptr<audioapi::AudioNode> previous;
+    for (size_t i = 0; i < length; ++i) {
+      auto gain = context->createGain();
+      if (previous != nullptr) {
+        previous->connect(gain);
+      }
+      previous = gain;
+    }
+    previous->connect(destination);
+  };
+
+  // the first two chains are too small to be worth a worker
+  connectChain(1);
+  connectChain(audioapi::RENDER_WORKER_POOL_MIN_GROUP_NODE_COUNT - 1);
+  connectChain(audioapi::RENDER_WORKER_POOL_MIN_GROUP_NODE_COUNT);
+  render(audioapi::RENDER_QUANTUM_SIZE);
+
+  auto *nodeManager = context->getNodeManager();
+  EXPECT_EQ(nodeManager->getNumberOfRenderGroups(), 3);
+  EXPECT_EQ(nodeManager->getNumberOfLargeRenderGroups(), 1);
+
+  connectChain(audioapi::RENDER_WORKER_POOL_MIN_GROUP_NODE_COUNT + 1);
+  render(audioapi::RENDER_QUANTUM_SIZE);
+
+  EXPECT_EQ(nodeManager->getNumberOfRenderGroups(), 4);
+  EXPECT_EQ(nodeManager->getNumberOfLargeRenderGroups(), 2);
+}
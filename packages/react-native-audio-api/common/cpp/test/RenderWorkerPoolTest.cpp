@@ -0,0 +1,41 @@
+#include <audioapi/utils/RenderWorkerPool.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+using audioapi::RenderWorkerPool;
+
+TEST(RenderWorkerPoolTest, RunsEveryTaskOnce) {
+  RenderWorkerPool pool(3);
+  std::vector<std::atomic<int>> counts(64);
+
+  // batches of varying size, so workers late for a batch meet the next one
+  for (int batch = 0; batch < 2000; ++batch) {
+    auto numTasks = static_cast<size_t>(batch % counts.size());
+    for (auto &count : counts) {
+      count.store(0, std::memory_order_relaxed);
+    }
+
+    auto task = [&counts](size_t index) {
+      counts[index].fetch_add(1, std::memory_order_relaxed);
+    };
+    pool.run(numTasks, task);
+
+    for (size_t i = 0; i < counts.size(); ++i) {
+      ASSERT_EQ(counts[i].load(std::memory_order_relaxed), i < numTasks ? 1 : 0)
+          << "batch " << batch << ", task " << i;
+    }
+  }
+}
+
+TEST(RenderWorkerPoolTest, CallingThreadRendersWithoutWorkers) {
+  RenderWorkerPool pool(0);
+  int sum = 0;
+
+  auto task = [&sum](size_t index) {
+    sum += static_cast<int>(index);
+  };
+  pool.run(10, task);
+
+  EXPECT_EQ(sum, 45);
+}
@@ -0,0 +1,54 @@
+#include <audioapi/dsp/Resampler.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/Benchmark.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <utility>
+
+using namespace audioapi;
+using dsp::Resampler;
+
+// Prints the throughput of every quality level for common conversions, in
+// input samples (frames times channels) per second.
+TEST(ResamplerBenchmark, Throughput) {
+  constexpr size_t length = 10 * 44100;
+  constexpr int numberOfChannels = 2;
+  constexpr int repetitions = 5;
+
+  const std::pair<float, float> conversions[] = {
+      {44100.0f, 48000.0f}, {48000.0f, 44100.0f}, {48000.0f, 16000.0f}};
+  const std::pair<Resampler::Quality, const char *> qualities[] = {
+      {Resampler::Quality::LOW, "low"},
+      {Resampler::Quality::MEDIUM, "medium"},
+      {Resampler::Quality::HIGH, "high"}};
+
+  for (auto [inputSampleRate, outputSampleRate] : conversions) {
+    AudioBus bus(length, numberOfChannels, inputSampleRate);
+    for (size_t i = 0; i < length; ++i) {
+      bus[0][i] = static_cast<float>(i % 100) / 100.0f;
+      bus[1][i] = -bus[0][i];
+    }
+
+    for (auto [quality, name] : qualities) {
+      double bestDuration = 0.0;
+      for (int i = 0; i < repetitions; ++i) {
+        auto duration = benchmarks::getExecutionTime([&]() {
+          auto resampled = Resampler::resample(bus, outputSampleRate, quality);
+          ASSERT_GT(resampled->getSize(), 0);
+        });
+        if (i == 0 || duration < bestDuration) {
+          bestDuration = duration;
+        }
+      }
+
+      auto samplesPerSecond = static_cast<double>(length * numberOfChannels) /
+          (bestDuration * 1e-9);
+      std::printf(
+          "%6.0f Hz -> %6.0f Hz, %-6s: %8.2f Msamples/s\n",
+          inputSampleRate,
+          outputSampleRate,
+          name,
+          samplesPerSecond / 1e6);
+    }
+  }
+}
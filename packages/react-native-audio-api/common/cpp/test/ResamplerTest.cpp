@@ -0,0 +1,189 @@
+#include <audioapi/dsp/Resampler.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+using namespace audioapi;
+using dsp::Resampler;
+
+namespace {
+
+std::shared_ptr<AudioBus>
+createSine(size_t length, float sampleRate, float frequency) {
+  auto bus = std::make_shared<AudioBus>(length, 2, sampleRate);
+  for (size_t i = 0; i < length; ++i) {
+    auto value = static_cast<float>(std::sin(
+        2.0 * std::numbers::pi * frequency * static_cast<double>(i) /
+        sampleRate));
+    (*bus)[0][i] = value;
+    (*bus)[1][i] = -value;
+  }
+  return bus;
+}
+
+// largest difference from the ideal sine, away from the edges of the bus
+float getSineError(const AudioBus &bus, float frequency, size_t margin) {
+  float error = 0.0f;
+  for (size_t i = margin; i + margin < bus.getSize(); ++i) {
+    auto expected = static_cast<float>(std::sin(
+        2.0 * std::numbers::pi * frequency * static_cast<double>(i) /
+        bus.getSampleRate()));
+    error = std::max(error, std::abs(bus[0][i] - expected));
+    error = std::max(error, std::abs(bus[1][i] + expected));
+  }
+  return error;
+}
+
+float getRms(const AudioArray &array, size_t margin) {
+  double sum = 0.0;
+  for (size_t i = margin; i + margin < array.getSize(); ++i) {
+    sum += array[i] * array[i];
+  }
+  return static_cast<float>(
+      std::sqrt(sum / static_cast<double>(array.getSize() - 2 * margin)));
+}
+
+} // namespace
+
+TEST(ResamplerTest, OutputLengthFollowsRatio) {
+  auto bus = createSine(44100, 44100.0f, 440.0f);
+
+  EXPECT_EQ(
+      Resampler::resample(*bus, 48000.0f, Resampler::Quality::LOW)->getSize(),
+      48000);
+  EXPECT_EQ(
+      Resampler::resample(*bus, 22050.0f, Resampler::Quality::LOW)->getSize(),
+      22050);
+  EXPECT_EQ(
+      Resampler::resample(*bus, 8000.0f, Resampler::Quality::LOW)->getSize(),
+      8000);
+}
+
+TEST(ResamplerTest, KeepsSineInPlace) {
+  auto bus = createSine(44100, 44100.0f, 1000.0f);
+
+  auto low = Resampler::resample(*bus, 48000.0f, Resampler::Quality::LOW);
+  auto high = Resampler::resample(*bus, 48000.0f, Resampler::Quality::HIGH);
+  EXPECT_EQ(high->getSampleRate(), 48000.0f);
+
+  EXPECT_LT(getSineError(*low, 1000.0f, 64), 1e-2f);
+  EXPECT_LT(getSineError(*high, 1000.0f, 64), 1e-3f);
+}
+
+TEST(ResamplerTest, DownsamplingRemovesFrequenciesAboveNyquist) {
+  auto bus = createSine(48000, 48000.0f, 12000.0f);
+
+  auto medium = Resampler::resample(*bus, 16000.0f, Resampler::Quality::MEDIUM);
+  auto high = Resampler::resample(*bus, 16000.0f, Resampler::Quality::HIGH);
+
+  EXPECT_LT(getRms(*medium->getChannel(0), 256), 1e-3f);
+  EXPECT_LT(getRms(*high->getChannel(0), 256), 1e-4f);
+}
+
+TEST(ResamplerTest, InterpolatesFiltersForRatiosWithManyPhases) {
+  auto bus = createSine(44100, 44100.0f, 1000.0f);
+
+  auto resampled =
+      Resampler::resample(*bus, 47999.0f, Resampler::Quality::HIGH);
+
+  EXPECT_EQ(resampled->getSize(), 47999);
+  EXPECT_LT(getSineError(*resampled, 1000.0f, 64), 1e-3f);
+}
+
+TEST(ResamplerTest, StreamMatchesWholeBus) {
+  auto bus = createSine(10000, 44100.0f, 3000.0f);
+  auto expected =
+      Resampler::resample(*bus, 48000.0f, Resampler::Quality::MEDIUM);
+
+  Resampler resampler(2, 44100.0f, 48000.0f, Resampler::Quality::MEDIUM);
+  AudioBus result(expected->getSize(), 2, 48000.0f);
+  size_t framesRead = 0;
+  size_t framesWritten = 0;
+  size_t blockSize = 1;
+
+  auto outputAt = [&](size_t frame) {
+    return std::vector<float *>{
+        result.getChannel(0)->getData() + frame,
+        result.getChannel(1)->getData() + frame};
+  };
+
+  while (framesRead < bus->getSize()) {
+    auto frames = std::min(blockSize, bus->getSize() - framesRead);
+    std::vector<const float *> input{
+        bus->getChannel(0)->getData() + framesRead,
+        bus->getChannel(1)->getData() + framesRead};
+    // at most 100 frames at once, the rest waits for the next call
+    auto output = outputAt(framesWritten);
+    framesWritten +=
+        resampler.process(input.data(), frames, output.data(), 100);
+    framesRead += frames;
+    blockSize = blockSize * 3 % 257 + 1;
+  }
+
+  while (framesWritten < expected->getSize()) {
+    auto output = outputAt(framesWritten);
+    auto frames = resampler.flush(output.data(), 100);
+    ASSERT_GT(frames, 0);
+    framesWritten += frames;
+  }
+
+  auto output = outputAt(framesWritten);
+  EXPECT_EQ(resampler.flush(output.data(), 100), 0);
+
+  for (size_t i = 0; i < expected->getSize(); ++i) {
+    ASSERT_FLOAT_EQ(result[0][i], (*expected)[0][i]) << i;
+    ASSERT_FLOAT_EQ(result[1][i], (*expected)[1][i]) << i;
+  }
+}
+
+// Decoders convert every decoded chunk into the output bus, which grows only
+// by what the next chunk may produce.
+TEST(ResamplerTest, ChunksOfBusMatchWholeBus) {
+  static constexpr size_t CHUNK = 4096;
+  auto bus = createSine(20000, 48000.0f, 3000.0f);
+  auto expected =
+      Resampler::resample(*bus, 44100.0f, Resampler::Quality::HIGH);
+
+  Resampler resampler(2, 48000.0f, 44100.0f, Resampler::Quality::HIGH);
+  AudioBus chunk(CHUNK, 2, 48000.0f);
+  auto result = std::make_unique<AudioBus>(0, 2, 44100.0f);
+  size_t framesWritten = 0;
+
+  auto reserveFrames = [&](size_t frames) {
+    auto grown =
+        std::make_unique<AudioBus>(framesWritten + frames, 2, 44100.0f);
+    grown->copy(result.get(), 0, 0, framesWritten);
+    result = std::move(grown);
+  };
+
+  for (size_t frame = 0; frame < bus->getSize(); frame += CHUNK) {
+    auto frames = std::min(CHUNK, bus->getSize() - frame);
+    chunk.copy(bus.get(), frame, 0, frames);
+    reserveFrames(resampler.getMaxOutputFrames(frames));
+    framesWritten +=
+        resampler.process(chunk, 0, frames, *result, framesWritten);
+  }
+  reserveFrames(resampler.getMaxOutputFrames(0));
+  framesWritten += resampler.flush(*result, framesWritten);
+
+  ASSERT_EQ(framesWritten, expected->getSize());
+  for (size_t i = 0; i < framesWritten; ++i) {
+    ASSERT_FLOAT_EQ((*result)[0][i], (*expected)[0][i]) << i;
+    ASSERT_FLOAT_EQ((*result)[1][i], (*expected)[1][i]) << i;
+  }
+}
+
+TEST(ResamplerTest, SameRateCopiesBus) {
+  auto bus = createSine(1000, 44100.0f, 440.0f);
+  auto resampled =
+      Resampler::resample(*bus, 44100.0f, Resampler::Quality::HIGH);
+
+  ASSERT_EQ(resampled->getSize(), 1000);
+  for (size_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ((*resampled)[0][i], (*bus)[0][i]);
+  }
+}
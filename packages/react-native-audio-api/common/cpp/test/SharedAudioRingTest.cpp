@@ -0,0 +1,86 @@
+#include <audioapi/utils/SharedAudioRing.h>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+TEST(SharedAudioRingTest, RoundsCapacityUpToPowerOfTwo) {
+  SharedAudioRing ring(1000);
+  EXPECT_EQ(ring.getCapacity(), 1024);
+  EXPECT_EQ(ring.getMemorySize(), SharedAudioRing::HEADER_SIZE + 1024 * sizeof(float));
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+}
+
+TEST(SharedAudioRingTest, ExposesIndicesInHeader) {
+  SharedAudioRing ring(8);
+  std::vector<float> source(6, 1.0f);
+  ring.write(source.data(), source.size());
+  ring.release(2);
+  ring.write(source.data(), source.size());
+
+  const auto *words = reinterpret_cast<const uint32_t *>(ring.getMemory());
+  EXPECT_EQ(words[SharedAudioRing::WRITE_INDEX], 10);
+  EXPECT_EQ(words[SharedAudioRing::READ_INDEX], 2);
+  EXPECT_EQ(words[SharedAudioRing::DROPPED_FRAMES], 2);
+  EXPECT_EQ(ring.getNumberOfDroppedFrames(), 2);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 8);
+}
+
+TEST(SharedAudioRingTest, ReadsSamplesInPlaceAcrossTheWrap) {
+  SharedAudioRing ring(8);
+  const auto *samples =
+      reinterpret_cast<const float *>(ring.getMemory() + SharedAudioRing::HEADER_SIZE);
+  std::vector<float> source(5);
+  float next = 0.0f;
+  size_t readIndex = 0;
+
+  for (int round = 0; round < 5; ++round) {
+    for (auto &sample : source) {
+      sample = next++;
+    }
+    ASSERT_EQ(ring.write(source.data(), source.size()), source.size());
+    ASSERT_EQ(ring.getNumberOfAvailableFrames(), source.size());
+
+    for (size_t i = 0; i < source.size(); ++i) {
+      EXPECT_EQ(samples[(readIndex + i) % ring.getCapacity()], source[i]);
+    }
+    readIndex += source.size();
+    ring.release(source.size());
+  }
+}
+
+TEST(SharedAudioRingTest, DeliversEveryFrameInOrderAcrossThreads) {
+  static constexpr size_t numberOfFrames = 1 << 18;
+  SharedAudioRing ring(256);
+  const auto *samples =
+      reinterpret_cast<const float *>(ring.getMemory() + SharedAudioRing::HEADER_SIZE);
+
+  std::thread writer([&ring]() {
+    std::vector<float> source(100);
+    size_t written = 0;
+    while (written < numberOfFrames) {
+      auto frames = std::min(source.size(), numberOfFrames - written);
+      for (size_t i = 0; i < frames; ++i) {
+        source[i] = static_cast<float>((written + i) % 65536);
+      }
+      written += ring.write(source.data(), frames);
+      std::this_thread::yield();
+    }
+  });
+
+  size_t read = 0;
+  while (read < numberOfFrames) {
+    auto available = ring.getNumberOfAvailableFrames();
+    for (size_t i = 0; i < available; ++i) {
+      ASSERT_EQ(
+          samples[(read + i) % ring.getCapacity()],
+          static_cast<float>((read + i) % 65536));
+    }
+    read += available;
+    ring.release(available);
+  }
+
+  writer.join();
+}
@@ -0,0 +1,190 @@
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <audioapi/utils/SpscAudioRing.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace audioapi;
+
+TEST(SpscAudioRingTest, RoundsCapacityUpToPowerOfTwo) {
+  SpscAudioRing ring(2, 1000);
+  EXPECT_EQ(ring.getCapacity(), 1024);
+  EXPECT_EQ(ring.getAvailableSpace(), 1024);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+}
+
+TEST(SpscAudioRingTest, WritesAndReadsAcrossTheWrap) {
+  SpscAudioRing ring(2, 8);
+  std::vector<float> left(6);
+  std::vector<float> right(6);
+  AudioBus output(6, 2, 44100.0f);
+  float next = 0.0f;
+
+  for (int round = 0; round < 5; ++round) {
+    for (size_t i = 0; i < left.size(); ++i) {
+      left[i] = next + static_cast<float>(i);
+      right[i] = -left[i];
+    }
+    const float *source[] = {left.data(), right.data()};
+
+    ASSERT_EQ(ring.write(source, 6), 6);
+    ASSERT_EQ(ring.read(&output, 0, 6), 6);
+    for (size_t i = 0; i < 6; ++i) {
+      EXPECT_EQ(output.getChannel(0)->getData()[i], left[i]);
+      EXPECT_EQ(output.getChannel(1)->getData()[i], right[i]);
+    }
+    next += 6.0f;
+  }
+}
+
+TEST(SpscAudioRingTest, CopiesOnlyWhatFits) {
+  SpscAudioRing ring(1, 4);
+  std::vector<float> input = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  const float *source[] = {input.data()};
+  AudioBus output(8, 1, 44100.0f);
+  output.zero();
+
+  EXPECT_EQ(ring.write(source, 6), 4);
+  EXPECT_EQ(ring.getAvailableSpace(), 0);
+
+  EXPECT_EQ(ring.read(&output, 2, 6), 4);
+  auto *data = output.getChannel(0)->getData();
+  EXPECT_EQ(data[1], 0.0f);
+  EXPECT_EQ(data[2], 1.0f);
+  EXPECT_EQ(data[5], 4.0f);
+  EXPECT_EQ(ring.read(&output, 0, 1), 0);
+}
+
+TEST(SpscAudioRingTest, ClearDropsWrittenFrames) {
+  SpscAudioRing ring(1, 16);
+  std::vector<float> input(10, 1.0f);
+  const float *source[] = {input.data()};
+
+  ring.write(source, 10);
+  ring.clear();
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+  EXPECT_EQ(ring.getAvailableSpace(), 16);
+}
+
+TEST(SpscAudioRingTest, DiscardKeepsFramesWrittenAfterIt) {
+  SpscAudioRing ring(1, 16);
+  std::vector<float> stale(12, 1.0f);
+  std::vector<float> fresh = {2.0f, 3.0f, 4.0f};
+  const float *staleSource[] = {stale.data()};
+  const float *freshSource[] = {fresh.data()};
+  AudioBus output(8, 1, 44100.0f);
+
+  ring.write(staleSource, 12);
+  ring.discard();
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+  // discarded frames are released only by the reader
+  EXPECT_EQ(ring.getAvailableSpace(), 4);
+
+  ring.write(freshSource, 3);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 3);
+  ASSERT_EQ(ring.read(&output, 0, 8), 3);
+  EXPECT_EQ(output.getChannel(0)->getData()[0], 2.0f);
+  EXPECT_EQ(output.getChannel(0)->getData()[2], 4.0f);
+  EXPECT_EQ(ring.getAvailableSpace(), 16);
+}
+
+// The sequence StreamerNode goes through on a seek: the streaming thread
+// discards the buffered audio of the old position while the audio thread is
+// reading it, the audio thread rebuffers with empty reads and plays the new
+// position once the low watermark is reached.
+TEST(SpscAudioRingTest, SeekDropsStaleFramesAndRefillsFromNewPosition) {
+  constexpr size_t lowWatermark = 6;
+  SpscAudioRing ring(1, 8);
+  std::vector<float> stale = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+  std::vector<float> fresh = {10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f};
+  const float *staleSource[] = {stale.data()};
+  AudioBus output(8, 1, 44100.0f);
+  auto *data = output.getChannel(0)->getData();
+
+  ASSERT_EQ(ring.write(staleSource, 8), 8);
+  ASSERT_EQ(ring.read(&output, 0, 3), 3);
+  EXPECT_EQ(data[2], 3.0f);
+
+  ring.discard();
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+  EXPECT_EQ(ring.getAvailableSpace(), 3);
+
+  // frames decoded at the new position fill only the space already read
+  const float *freshSource[] = {fresh.data()};
+  EXPECT_EQ(ring.write(freshSource, fresh.size()), 3);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 3);
+
+  // while prebuffering nothing is read, the empty read still releases the
+  // space of the stale frames
+  EXPECT_EQ(ring.read(&output, 0, 0), 0);
+  EXPECT_EQ(ring.getAvailableSpace(), 5);
+
+  const float *restSource[] = {fresh.data() + 3};
+  EXPECT_EQ(ring.write(restSource, fresh.size() - 3), fresh.size() - 3);
+  EXPECT_GE(ring.getNumberOfAvailableFrames(), lowWatermark);
+
+  // playback resumes at the first frame of the new position
+  ASSERT_EQ(ring.read(&output, 0, 8), fresh.size());
+  for (size_t i = 0; i < fresh.size(); ++i) {
+    EXPECT_EQ(data[i], fresh[i]) << "frame " << i;
+  }
+}
+
+TEST(SpscAudioRingTest, DiscardWithoutNewFramesLeavesRingEmpty) {
+  SpscAudioRing ring(2, 16);
+  std::vector<float> input(10, 1.0f);
+  const float *source[] = {input.data(), input.data()};
+  AudioBus output(16, 2, 44100.0f);
+
+  ring.write(source, 10);
+  ring.discard();
+  // a second seek before the reader caught up drops nothing more
+  ring.discard();
+
+  EXPECT_EQ(ring.read(&output, 0, 16), 0);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+  EXPECT_EQ(ring.getAvailableSpace(), 16);
+}
+
+TEST(SpscAudioRingTest, KeepsOrderBetweenThreads) {
+  constexpr size_t totalFrames = 1 << 16;
+  SpscAudioRing ring(1, 256);
+
+  std::thread writer([&ring]() {
+    std::vector<float> block(100);
+    size_t written = 0;
+    while (written < totalFrames) {
+      auto frames = std::min(block.size(), totalFrames - written);
+      for (size_t i = 0; i < frames; ++i) {
+        block[i] = static_cast<float>((written + i) % 65536);
+      }
+      const float *source[] = {block.data()};
+      // only the part that fits is taken, the rest is sent again
+      auto framesWritten = ring.write(source, frames);
+      if (framesWritten == 0) {
+        std::this_thread::yield();
+      }
+      written += framesWritten;
+    }
+  });
+
+  AudioBus output(128, 1, 44100.0f);
+  size_t read = 0;
+  bool inOrder = true;
+  while (read < totalFrames) {
+    auto frames = ring.read(&output, 0, 128);
+    for (size_t i = 0; i < frames; ++i) {
+      inOrder &= output.getChannel(0)->getData()[i] ==
+          static_cast<float>((read + i) % 65536);
+    }
+    if (frames == 0) {
+      std::this_thread::yield();
+    }
+    read += frames;
+  }
+  writer.join();
+
+  EXPECT_TRUE(inOrder);
+  EXPECT_EQ(ring.getNumberOfAvailableFrames(), 0);
+}
@@ -0,0 +1,289 @@
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/StreamerNode.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MockAudioEventHandlerRegistry.h"
+
+namespace {
+
+constexpr int sampleRate = 44100;
+// long enough that the streamer never buffers the whole file
+constexpr int numberOfFrames = 8 * sampleRate;
+
+// Every frame of the file holds its own index, so the first rendered frame
+// after a seek tells where playback landed.
+float frameValue(long frame) {
+  return static_cast<float>(frame + 1) / numberOfFrames;
+}
+
+long frameIndex(float value) {
+  return std::lround(value * numberOfFrames) - 1;
+}
+
+void appendLittleEndian(std::vector<char> &data, uint32_t value, int bytes) {
+  for (int i = 0; i < bytes; ++i) {
+    data.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+// mono 32-bit float WAV, decoded without any loss
+std::vector<char> createRampWav() {
+  std::vector<char> data;
+  auto dataSize = static_cast<uint32_t>(numberOfFrames * sizeof(float));
+  data.insert(data.end(), {'R', 'I', 'F', 'F'});
+  appendLittleEndian(data, 36 + dataSize, 4);
+  data.insert(data.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+  appendLittleEndian(data, 16, 4);
+  appendLittleEndian(data, 3, 2); // IEEE float
+  appendLittleEndian(data, 1, 2);
+  appendLittleEndian(data, sampleRate, 4);
+  appendLittleEndian(data, sampleRate * sizeof(float), 4);
+  appendLittleEndian(data, sizeof(float), 2);
+  appendLittleEndian(data, 32, 2);
+  data.insert(data.end(), {'d', 'a', 't', 'a'});
+  appendLittleEndian(data, dataSize, 4);
+
+  for (long frame = 0; frame < numberOfFrames; ++frame) {
+    auto value = frameValue(frame);
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendLittleEndian(data, bits, 4);
+  }
+
+  return data;
+}
+
+// Serves one file on the loopback interface with range requests, the way a
+// server the streamer can seek in does. Every connection gets its own thread,
+// FFmpeg opens the connection of a seek before it closes the previous one.
+class LocalHttpServer {
+ public:
+  explicit LocalHttpServer(std::vector<char> body) : body_(std::move(body)) {
+    listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    bind(listenFd_, reinterpret_cast<sockaddr *>(&address), length);
+    listen(listenFd_, 8);
+    getsockname(listenFd_, reinterpret_cast<sockaddr *>(&address), &length);
+    port_ = ntohs(address.sin_port);
+    acceptThread_ = std::thread(&LocalHttpServer::acceptConnections, this);
+  }
+
+  ~LocalHttpServer() {
+    isRunning_.store(false);
+    acceptThread_.join();
+    for (auto &thread : connectionThreads_) {
+      thread.join();
+    }
+    close(listenFd_);
+  }
+
+  [[nodiscard]] std::string getUrl() const {
+    return "http://127.0.0.1:" + std::to_string(port_) + "/ramp.wav";
+  }
+
+ private:
+  std::vector<char> body_;
+  int listenFd_;
+  int port_;
+  std::atomic<bool> isRunning_{true};
+  std::thread acceptThread_;
+  std::vector<std::thread> connectionThreads_;
+
+  void acceptConnections() {
+    while (isRunning_.load()) {
+      pollfd pollFd{.fd = listenFd_, .events = POLLIN, .revents = 0};
+      if (poll(&pollFd, 1, 10) <= 0) {
+        continue;
+      }
+
+      int fd = accept(listenFd_, nullptr, nullptr);
+      if (fd >= 0) {
+        connectionThreads_.emplace_back(&LocalHttpServer::serve, this, fd);
+      }
+    }
+  }
+
+  void serve(int fd) {
+    std::string request;
+    char chunk[1024];
+    while (request.find("\r\n\r\n") == std::string::npos) {
+      auto received = recv(fd, chunk, sizeof(chunk), 0);
+      if (received <= 0) {
+        close(fd);
+        return;
+      }
+      request.append(chunk, received);
+    }
+
+    size_t start = 0;
+    auto range = request.find("Range: bytes=");
+    if (range != std::string::npos) {
+      start = std::stoul(request.substr(range + 13));
+    }
+    start = std::min(start, body_.size());
+
+    std::string header = range == std::string::npos
+        ? "HTTP/1.1 200 OK\r\n"
+        : "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " +
+            std::to_string(start) + "-" + std::to_string(body_.size() - 1) +
+            "/" + std::to_string(body_.size()) + "\r\n";
+    header += "Content-Type: audio/wav\r\nAccept-Ranges: bytes\r\n";
+    header += "Content-Length: " + std::to_string(body_.size() - start) +
+        "\r\nConnection: close\r\n\r\n";
+
+    // the streamer drops the connection in the middle of the body on a seek
+    if (sendAll(fd, header.data(), header.size())) {
+      sendAll(fd, body_.data() + start, body_.size() - start);
+    }
+    close(fd);
+  }
+
+  bool sendAll(int fd, const char *data, size_t size) {
+    while (size > 0 && isRunning_.load()) {
+      auto sent = send(fd, data, size, MSG_NOSIGNAL);
+      if (sent <= 0) {
+        return false;
+      }
+      data += sent;
+      size -= sent;
+    }
+    return size == 0;
+  }
+};
+
+} // namespace
+
+class StreamerNodeTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+  std::filesystem::path filePath;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        1, 5 * sampleRate, sampleRate, eventRegistry, RuntimeRegistry{});
+
+    auto wav = createRampWav();
+    filePath = std::filesystem::temp_directory_path() /
+        ("streamer_node_test_" + std::to_string(getpid()) + ".wav");
+    std::ofstream(filePath, std::ios::binary)
+        .write(wav.data(), static_cast<std::streamsize>(wav.size()));
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(filePath);
+  }
+};
+
+class TestableStreamerNode : public audioapi::StreamerNode {
+ public:
+  explicit TestableStreamerNode(audioapi::BaseAudioContext *context)
+      : audioapi::StreamerNode(context) {}
+
+  // Plays up to maxFrames frames, skipping the silence rendered while the
+  // streamer buffers. Returns the index of the first frame that does not
+  // follow the one before it, -1 if all of them do.
+  long play(long &nextFrame, long maxFrames) {
+    auto bus = std::make_shared<audioapi::AudioBus>(
+        audioapi::RENDER_QUANTUM_SIZE, 1, context_->getSampleRate());
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (maxFrames > 0 && std::chrono::steady_clock::now() < deadline) {
+      processNode(bus, audioapi::RENDER_QUANTUM_SIZE);
+      const auto *data = bus->getChannel(0)->getData();
+      auto isSilent = true;
+
+      for (int i = 0; i < audioapi::RENDER_QUANTUM_SIZE; ++i) {
+        if (data[i] == 0.0f) {
+          continue;
+        }
+
+        isSilent = false;
+        auto frame = frameIndex(data[i]);
+        if (frame != nextFrame) {
+          return frame;
+        }
+        nextFrame = frame + 1;
+        maxFrames--;
+      }
+
+      if (isSilent) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    return -1;
+  }
+};
+
+TEST_F(StreamerNodeTest, PlaysFileFromStart) {
+  auto node = std::make_shared<TestableStreamerNode>(context.get());
+  ASSERT_TRUE(node->initialize(filePath.string()));
+  node->start(0.0);
+
+  long nextFrame = 0;
+  EXPECT_EQ(node->play(nextFrame, sampleRate), -1);
+  EXPECT_EQ(nextFrame, sampleRate);
+}
+
+TEST_F(StreamerNodeTest, SeekForwardPlaysFromTarget) {
+  auto node = std::make_shared<TestableStreamerNode>(context.get());
+  ASSERT_TRUE(node->initialize(filePath.string()));
+  node->start(0.0);
+
+  long nextFrame = 0;
+  ASSERT_EQ(node->play(nextFrame, sampleRate / 2), -1);
+
+  node->seek(6.3);
+  EXPECT_EQ(node->play(nextFrame, numberOfFrames), 277830);
+}
+
+TEST_F(StreamerNodeTest, SeekBackwardPlaysFromTarget) {
+  auto node = std::make_shared<TestableStreamerNode>(context.get());
+  ASSERT_TRUE(node->initialize(filePath.string()));
+  node->start(0.0);
+
+  long nextFrame = 0;
+  ASSERT_EQ(node->play(nextFrame, 2 * sampleRate), -1);
+
+  node->seek(1.25);
+  EXPECT_EQ(node->play(nextFrame, numberOfFrames), 55125);
+}
+
+TEST_F(StreamerNodeTest, SeekOverHttpPlaysFromTarget) {
+  LocalHttpServer server(createRampWav());
+  auto node = std::make_shared<TestableStreamerNode>(context.get());
+  ASSERT_TRUE(node->initialize(server.getUrl()));
+  node->start(0.0);
+
+  long nextFrame = 0;
+  ASSERT_EQ(node->play(nextFrame, sampleRate / 2), -1);
+
+  node->seek(6.3);
+  EXPECT_EQ(node->play(nextFrame, numberOfFrames), 277830);
+
+  // released before the server, which waits for its connections to close
+  node.reset();
+}
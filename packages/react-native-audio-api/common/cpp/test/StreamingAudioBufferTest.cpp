@@ -0,0 +1,262 @@
+#include <audioapi/core/AudioParam.h>
+#include <audioapi/core/OfflineAudioContext.h>
+#include <audioapi/core/sources/StreamingAudioBuffer.h>
+#include <audioapi/core/sources/StreamingBufferSourceNode.h>
+#include <audioapi/core/utils/AudioStreamDecoder.h>
+#include <audioapi/core/utils/Constants.h>
+#include <audioapi/core/utils/worklets/SafeIncludes.h>
+#include <audioapi/utils/AudioArray.h>
+#include <audioapi/utils/AudioBus.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "MockAudioEventHandlerRegistry.h"
+
+// Stereo stream of frame indices, negated in the second channel.
+class RampStreamDecoder : public audioapi::AudioStreamDecoder {
+ public:
+  RampStreamDecoder(size_t length, bool isLengthKnown, std::atomic<int> &seeks)
+      : length_(length), isLengthKnown_(isLengthKnown), seeks_(seeks) {}
+
+  [[nodiscard]] int getNumberOfChannels() const override {
+    return 2;
+  }
+
+  [[nodiscard]] float getSampleRate() const override {
+    return 44100.0f;
+  }
+
+  [[nodiscard]] size_t getLength() const override {
+    return isLengthKnown_ ? length_ : 0;
+  }
+
+  size_t read(float *const *channels, size_t frames) override {
+    auto framesRead = std::min(frames, length_ - position_);
+    for (size_t i = 0; i < framesRead; ++i) {
+      channels[0][i] = static_cast<float>(position_ + i);
+      channels[1][i] = -static_cast<float>(position_ + i);
+    }
+    position_ += framesRead;
+    return framesRead;
+  }
+
+  bool seek(size_t frame) override {
+    seeks_++;
+    if (frame > length_) {
+      return false;
+    }
+    position_ = frame;
+    return true;
+  }
+
+ private:
+  size_t length_;
+  bool isLengthKnown_;
+  size_t position_ = 0;
+  std::atomic<int> &seeks_;
+};
+
+class StreamingAudioBufferTest : public ::testing::Test {
+ protected:
+  static constexpr int FRAMES_TO_PROCESS = 128;
+  std::atomic<int> seeks = 0;
+
+  std::shared_ptr<audioapi::StreamingAudioBuffer> createBuffer(
+      size_t length,
+      bool isLengthKnown = true) {
+    return std::make_shared<audioapi::StreamingAudioBuffer>(
+        std::make_unique<RampStreamDecoder>(length, isLengthKnown, seeks));
+  }
+
+  // Reads like the audio thread would, waiting while the frames are decoded.
+  static size_t readWhenDecoded(
+      audioapi::StreamingAudioBuffer &buffer,
+      audioapi::AudioBus &bus,
+      size_t frame) {
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+      auto framesRead =
+          buffer.read(&bus, frame, 0, static_cast<size_t>(bus.getSize()));
+      if (framesRead > 0 || buffer.isEnded(frame)) {
+        return framesRead;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return 0;
+  }
+};
+
+TEST_F(StreamingAudioBufferTest, ReadsWholeStreamInOrder) {
+  static constexpr size_t LENGTH = 200000;
+  auto buffer = createBuffer(LENGTH);
+  EXPECT_EQ(buffer->getLength(), LENGTH);
+  EXPECT_EQ(buffer->getNumberOfChannels(), 2);
+
+  audioapi::AudioBus bus(FRAMES_TO_PROCESS, 2, 44100.0f);
+  size_t frame = 0;
+  while (!buffer->isEnded(frame)) {
+    auto framesRead = readWhenDecoded(*buffer, bus, frame);
+    // the end may be found only by this read
+    if (framesRead == 0) {
+      ASSERT_TRUE(buffer->isEnded(frame));
+      break;
+    }
+    for (size_t i = 0; i < framesRead; ++i) {
+      ASSERT_EQ(bus.getChannel(0)->getData()[i], static_cast<float>(frame + i));
+      ASSERT_EQ(bus.getChannel(1)->getData()[i], -static_cast<float>(frame + i));
+    }
+    frame += framesRead;
+  }
+
+  EXPECT_EQ(frame, LENGTH);
+  EXPECT_EQ(seeks, 0);
+}
+
+TEST_F(StreamingAudioBufferTest, MemoryDoesNotDependOnLength) {
+  auto shortBuffer = createBuffer(44100);
+  auto longBuffer = createBuffer(10 * 60 * 44100);
+
+  EXPECT_EQ(shortBuffer->getSizeInBytes(), longBuffer->getSizeInBytes());
+  EXPECT_EQ(
+      longBuffer->getSizeInBytes(),
+      audioapi::STREAMING_AUDIO_BUFFER_CHUNK_SIZE *
+          audioapi::STREAMING_AUDIO_BUFFER_NUMBER_OF_CHUNKS * 2 *
+          sizeof(float));
+}
+
+TEST_F(StreamingAudioBufferTest, FindsEndOfStreamWithUnknownLength) {
+  static constexpr size_t LENGTH = 30000;
+  auto buffer = createBuffer(LENGTH, false);
+  // the decoding thread may have reached the end already
+  EXPECT_TRUE(buffer->getLength() == 0 || buffer->getLength() == LENGTH);
+
+  audioapi::AudioBus bus(FRAMES_TO_PROCESS, 2, 44100.0f);
+  size_t frame = 0;
+  while (!buffer->isEnded(frame)) {
+    auto framesRead = readWhenDecoded(*buffer, bus, frame);
+    // the end may be found only by this read
+    if (framesRead == 0) {
+      ASSERT_TRUE(buffer->isEnded(frame));
+      break;
+    }
+    frame += framesRead;
+  }
+
+  EXPECT_EQ(frame, LENGTH);
+  EXPECT_EQ(buffer->getLength(), LENGTH);
+}
+
+TEST_F(StreamingAudioBufferTest, SeeksOnlyOutsideOfDecodedWindow) {
+  auto buffer = createBuffer(1000000);
+  audioapi::AudioBus bus(FRAMES_TO_PROCESS, 2, 44100.0f);
+
+  ASSERT_GT(readWhenDecoded(*buffer, bus, 0), 0);
+  ASSERT_GT(readWhenDecoded(*buffer, bus, 1000), 0);
+  EXPECT_EQ(seeks, 0);
+
+  // far ahead
+  ASSERT_GT(readWhenDecoded(*buffer, bus, 500000), 0);
+  EXPECT_EQ(bus.getChannel(0)->getData()[0], 500000.0f);
+  EXPECT_EQ(seeks, 1);
+
+  // backwards
+  ASSERT_GT(readWhenDecoded(*buffer, bus, 250), 0);
+  EXPECT_EQ(bus.getChannel(0)->getData()[0], 250.0f);
+  EXPECT_EQ(bus.getChannel(1)->getData()[5], -255.0f);
+  EXPECT_EQ(seeks, 2);
+}
+
+class TestableStreamingBufferSourceNode
+    : public audioapi::StreamingBufferSourceNode {
+ public:
+  explicit TestableStreamingBufferSourceNode(
+      audioapi::BaseAudioContext *context)
+      : audioapi::StreamingBufferSourceNode(context, false) {}
+
+  std::shared_ptr<audioapi::AudioBus> processNode(
+      const std::shared_ptr<audioapi::AudioBus> &processingBus,
+      int framesToProcess) override {
+    return audioapi::StreamingBufferSourceNode::processNode(
+        processingBus, framesToProcess);
+  }
+};
+
+class StreamingBufferSourceNodeTest : public StreamingAudioBufferTest {
+ protected:
+  std::shared_ptr<audioapi::IAudioEventHandlerRegistry> eventRegistry;
+  std::unique_ptr<audioapi::OfflineAudioContext> context;
+
+  void SetUp() override {
+    eventRegistry = std::make_shared<MockAudioEventHandlerRegistry>();
+    context = std::make_unique<audioapi::OfflineAudioContext>(
+        2, 5 * 44100, 44100, eventRegistry, RuntimeRegistry{});
+  }
+
+  // Renders quanta until the node has output the given number of non-silent
+  // frames, which the decoder may delay.
+  static std::vector<float> render(
+      TestableStreamingBufferSourceNode &node,
+      size_t frames) {
+    std::vector<float> output;
+    auto bus =
+        std::make_shared<audioapi::AudioBus>(FRAMES_TO_PROCESS, 2, 44100.0f);
+    for (int attempt = 0; attempt < 1000 && output.size() < frames;
+         ++attempt) {
+      node.processNode(bus, FRAMES_TO_PROCESS);
+      for (int i = 0; i < FRAMES_TO_PROCESS; ++i) {
+        auto sample = bus->getChannel(0)->getData()[i];
+        if (sample != 0.0f || !output.empty()) {
+          output.push_back(sample);
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return output;
+  }
+};
+
+TEST_F(StreamingBufferSourceNodeTest, PlaysFromOffsetWithoutSkippingFrames) {
+  static constexpr size_t OFFSET = 100000;
+  auto node = std::make_shared<TestableStreamingBufferSourceNode>(context.get());
+  node->setBuffer(createBuffer(1000000));
+  node->start(0.0, static_cast<double>(OFFSET) / 44100.0);
+
+  auto output = render(*node, 4 * FRAMES_TO_PROCESS);
+  ASSERT_GE(output.size(), 4 * FRAMES_TO_PROCESS);
+  // holds its position while the decoder moves to the offset
+  for (size_t i = 0; i < 4 * FRAMES_TO_PROCESS; ++i) {
+    ASSERT_EQ(output[i], static_cast<float>(OFFSET + i));
+  }
+}
+
+TEST_F(StreamingBufferSourceNodeTest, InterpolatesWithPlaybackRate) {
+  static constexpr float PLAYBACK_RATE = 2.5f;
+  auto node = std::make_shared<TestableStreamingBufferSourceNode>(context.get());
+  node->getPlaybackRateParam()->setValue(PLAYBACK_RATE);
+  node->setBuffer(createBuffer(1000000));
+  node->start(0.0, 1.0 / 44100.0);
+
+  auto output = render(*node, 4 * FRAMES_TO_PROCESS);
+  ASSERT_GE(output.size(), 4 * FRAMES_TO_PROCESS);
+  // a linear signal is reproduced exactly by linear interpolation
+  for (size_t i = 0; i < 4 * FRAMES_TO_PROCESS; ++i) {
+    ASSERT_NEAR(output[i], 1.0f + PLAYBACK_RATE * i, 1e-2);
+  }
+}
+
+TEST_F(StreamingBufferSourceNodeTest, StopsAtEndOfStream) {
+  static constexpr size_t LENGTH = 1000;
+  auto node = std::make_shared<TestableStreamingBufferSourceNode>(context.get());
+  node->setBuffer(createBuffer(LENGTH));
+  node->start(0.0, 0.0);
+
+  auto output = render(*node, 2 * LENGTH);
+  // first frame is 0 and not recorded by render
+  ASSERT_GE(output.size(), LENGTH - 1);
+  for (size_t i = 0; i < LENGTH - 1; ++i) {
+    ASSERT_EQ(output[i], static_cast<float>(i + 1));
+  }
+  for (size_t i = LENGTH - 1; i < output.size(); ++i) {
+    ASSERT_EQ(output[i], 0.0f);
+  }
+}
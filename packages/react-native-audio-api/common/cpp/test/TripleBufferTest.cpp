@@ -0,0 +1,59 @@
+#include <audioapi/utils/TripleBuffer.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <thread>
+
+using audioapi::TripleBuffer;
+
+TEST(TripleBufferTest, ReadsInitialValueUntilPublished) {
+  TripleBuffer<int> buffer(7);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.getReadBuffer(), 7);
+
+  buffer.getWriteBuffer() = 8;
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.getReadBuffer(), 7);
+}
+
+TEST(TripleBufferTest, ReadsLatestPublishedValue) {
+  TripleBuffer<int> buffer(0);
+  for (int i = 1; i <= 3; ++i) {
+    buffer.getWriteBuffer() = i;
+    buffer.publish();
+  }
+
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(buffer.getReadBuffer(), 3);
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.getReadBuffer(), 3);
+
+  buffer.getWriteBuffer() = 4;
+  buffer.publish();
+  EXPECT_TRUE(buffer.update());
+  EXPECT_EQ(buffer.getReadBuffer(), 4);
+}
+
+TEST(TripleBufferTest, NeverReadsPartiallyWrittenValue) {
+  static constexpr int numberOfValues = 100000;
+  TripleBuffer<std::array<int, 16>> buffer({});
+
+  std::thread writer([&buffer]() {
+    for (int i = 1; i <= numberOfValues; ++i) {
+      buffer.getWriteBuffer().fill(i);
+      buffer.publish();
+    }
+  });
+
+  int previous = 0;
+  while (previous < numberOfValues) {
+    buffer.update();
+    const auto &value = buffer.getReadBuffer();
+    for (auto element : value) {
+      ASSERT_EQ(element, value[0]);
+    }
+    ASSERT_GE(value[0], previous);
+    previous = value[0];
+  }
+
+  writer.join();
+}
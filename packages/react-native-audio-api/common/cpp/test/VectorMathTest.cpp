@@ -0,0 +1,68 @@
+#include <audioapi/dsp/VectorMath.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+float testSample(size_t frame, int channel) {
+  return static_cast<float>(frame) + static_cast<float>(channel) / 10.0f;
+}
+
+// Deinterleaves frames starting at inputOffset of a larger buffer, so the
+// input is misaligned for the SIMD paths whenever the offset is not a
+// multiple of the vector width.
+void expectDeinterleaveMatchesScalar(
+    int numberOfChannels,
+    size_t numberOfFrames,
+    size_t inputOffset) {
+  std::vector<float> input(inputOffset + numberOfFrames * numberOfChannels);
+  for (size_t i = 0; i < numberOfFrames; ++i) {
+    for (int c = 0; c < numberOfChannels; ++c) {
+      input[inputOffset + i * numberOfChannels + c] = testSample(i, c);
+    }
+  }
+
+  // one guard sample past the frames of every channel
+  std::vector<std::vector<float>> outputs(
+      numberOfChannels, std::vector<float>(numberOfFrames + 1, -1.0f));
+  std::vector<float *> outputPointers;
+  for (auto &output : outputs) {
+    outputPointers.push_back(output.data());
+  }
+
+  audioapi::dsp::deinterleave(
+      input.data() + inputOffset,
+      outputPointers.data(),
+      numberOfChannels,
+      numberOfFrames);
+
+  for (int c = 0; c < numberOfChannels; ++c) {
+    for (size_t i = 0; i < numberOfFrames; ++i) {
+      ASSERT_EQ(outputs[c][i], input[inputOffset + i * numberOfChannels + c])
+          << numberOfChannels << " channels, " << numberOfFrames
+          << " frames, offset " << inputOffset << ", channel " << c
+          << ", frame " << i;
+    }
+    EXPECT_EQ(outputs[c][numberOfFrames], -1.0f)
+        << "written past the end of channel " << c;
+  }
+}
+
+} // namespace
+
+TEST(VectorMathTest, DeinterleaveMatchesScalarReference) {
+  // frame counts around the SIMD widths, including ones not a multiple of it
+  for (int numberOfChannels : {1, 2, 3, 5, 6}) {
+    for (size_t numberOfFrames : {0, 1, 3, 4, 5, 7, 8, 9, 127, 128, 131}) {
+      expectDeinterleaveMatchesScalar(numberOfChannels, numberOfFrames, 0);
+    }
+  }
+}
+
+TEST(VectorMathTest, DeinterleaveHandlesUnalignedInput) {
+  for (int numberOfChannels : {1, 2, 3}) {
+    for (size_t inputOffset : {1, 2, 3}) {
+      expectDeinterleaveMatchesScalar(numberOfChannels, 131, inputOffset);
+    }
+  }
+}
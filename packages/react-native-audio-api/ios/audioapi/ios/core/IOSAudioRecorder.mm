@@ -24,7 +24,9 @@ IOSAudioRecorder::IOSAudioRecorder(
       writeToBuffers(inputChannel, numFrames);
     }
 
-    while (circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
+    // without a listener nothing is buffered and no bus is allocated
+    while (hasOnAudioReadyCallback() &&
+           circularBuffer_->getNumberOfAvailableFrames() >= bufferLength_) {
       auto bus = std::make_shared<AudioBus>(bufferLength_, 1, sampleRate_);
       auto *outputChannel = bus->getChannel(0)->getData();
 
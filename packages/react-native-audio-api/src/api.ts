@@ -1,4 +1,5 @@
 import { NativeAudioAPIModule } from './specs';
+import { dispatchAudioEvents } from './events/AudioEventEmitter';
 import { AudioRecorderOptions } from './types';
 import type {
   IAudioContext,
@@ -13,14 +14,17 @@ declare global {
     sampleRate: number,
     initSuspended: boolean,
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
-    audioWorkletRuntime: any
+    audioWorkletRuntime: any,
+    decodeWorkerCount: number,
+    renderWorkerCount: number
   ) => IAudioContext;
   var createOfflineAudioContext: (
     numberOfChannels: number,
     length: number,
     sampleRate: number,
     // eslint-disable-next-line @typescript-eslint/no-explicit-any
-    audioWorkletRuntime: any
+    audioWorkletRuntime: any,
+    decodeWorkerCount: number
   ) => IOfflineAudioContext;
 
   var createAudioRecorder: (options: AudioRecorderOptions) => IAudioRecorder;
@@ -44,6 +48,8 @@ if (
   NativeAudioAPIModule.install();
 }
 
+global.AudioEventEmitter.setEventBatchDispatcher(dispatchAudioEvents);
+
 export { default as WorkletNode } from './core/WorkletNode';
 export { default as WorkletSourceNode } from './core/WorkletSourceNode';
 export { default as WorkletProcessingNode } from './core/WorkletProcessingNode';
@@ -51,19 +57,29 @@ export { default as RecorderAdapterNode } from './core/RecorderAdapterNode';
 export { default as AudioBuffer } from './core/AudioBuffer';
 export { default as AudioBufferSourceNode } from './core/AudioBufferSourceNode';
 export { default as AudioBufferQueueSourceNode } from './core/AudioBufferQueueSourceNode';
+export { default as StreamingAudioBuffer } from './core/StreamingAudioBuffer';
+export { default as StreamingBufferSourceNode } from './core/StreamingBufferSourceNode';
 export { default as AudioContext } from './core/AudioContext';
 export { default as OfflineAudioContext } from './core/OfflineAudioContext';
 export { default as AudioDestinationNode } from './core/AudioDestinationNode';
 export { default as AudioNode } from './core/AudioNode';
 export { default as AnalyserNode } from './core/AnalyserNode';
+export { default as AudioMeterNode } from './core/AudioMeterNode';
 export { default as AudioParam } from './core/AudioParam';
 export { default as AudioScheduledSourceNode } from './core/AudioScheduledSourceNode';
 export { default as BaseAudioContext } from './core/BaseAudioContext';
 export { default as BiquadFilterNode } from './core/BiquadFilterNode';
+export { default as ConvolverNode } from './core/ConvolverNode';
+export { default as DelayNode } from './core/DelayNode';
 export { default as GainNode } from './core/GainNode';
+export {
+  default as ParametricEQNode,
+  ParametricEQBand,
+} from './core/ParametricEQNode';
 export { default as OscillatorNode } from './core/OscillatorNode';
 export { default as StereoPannerNode } from './core/StereoPannerNode';
 export { default as AudioRecorder } from './core/AudioRecorder';
+export { default as AudioRecorderTap } from './core/AudioRecorderTap';
 export { default as StreamerNode } from './core/StreamerNode';
 export { default as ConstantSourceNode } from './core/ConstantSourceNode';
 export { default as AudioManager } from './system';
@@ -78,6 +94,9 @@ export {
   WindowType,
   PeriodicWaveConstraints,
   AudioWorkletRuntime,
+  DecodePriority,
+  DecodeOptions,
+  AudioMeterMeasurements,
 } from './types';
 
 export {
@@ -86,4 +105,5 @@ export {
   InvalidStateError,
   RangeError,
   NotSupportedError,
+  AbortError,
 } from './errors';
@@ -72,6 +72,20 @@ export default class AnalyserNode extends AudioNode {
     (this.node as IAnalyserNode).window = value;
   }
 
+  public get analysisInterval(): number {
+    return (this.node as IAnalyserNode).analysisInterval;
+  }
+
+  public set analysisInterval(value: number) {
+    if (value < 1) {
+      throw new IndexSizeError(
+        `The analysisInterval value (${value}) must be at least 1`
+      );
+    }
+
+    (this.node as IAnalyserNode).analysisInterval = value;
+  }
+
   public get frequencyBinCount(): number {
     return (this.node as IAnalyserNode).frequencyBinCount;
   }
@@ -2,8 +2,15 @@ import { IAudioBufferQueueSourceNode } from '../interfaces';
 import AudioBufferBaseSourceNode from './AudioBufferBaseSourceNode';
 import AudioBuffer from './AudioBuffer';
 import { RangeError } from '../errors';
+import { AudioEventSubscription } from '../events';
+import { OnBufferConsumedEventType } from '../events/types';
 
 export default class AudioBufferQueueSourceNode extends AudioBufferBaseSourceNode {
+  private onBufferConsumedSubscription?: AudioEventSubscription;
+  private onBufferConsumedCallback?: (
+    event: OnBufferConsumedEventType
+  ) => void;
+
   public enqueueBuffer(buffer: AudioBuffer): string {
     return (this.node as IAudioBufferQueueSourceNode).enqueueBuffer(
       buffer.buffer
@@ -24,6 +31,47 @@ export default class AudioBufferQueueSourceNode extends AudioBufferBaseSourceNod
     (this.node as IAudioBufferQueueSourceNode).clearBuffers();
   }
 
+  public get crossfadeDuration(): number {
+    return (this.node as IAudioBufferQueueSourceNode).crossfadeDuration;
+  }
+
+  public set crossfadeDuration(value: number) {
+    if (value < 0) {
+      throw new RangeError(
+        `crossfadeDuration must be a non-negative number: ${value}`
+      );
+    }
+
+    (this.node as IAudioBufferQueueSourceNode).crossfadeDuration = value;
+  }
+
+  public get onBufferConsumed():
+    | ((event: OnBufferConsumedEventType) => void)
+    | undefined {
+    return this.onBufferConsumedCallback;
+  }
+
+  public set onBufferConsumed(
+    callback: ((event: OnBufferConsumedEventType) => void) | null
+  ) {
+    this.onBufferConsumedSubscription?.remove();
+    this.onBufferConsumedSubscription = undefined;
+
+    if (!callback) {
+      (this.node as IAudioBufferQueueSourceNode).onBufferConsumed = '0';
+      this.onBufferConsumedCallback = undefined;
+
+      return;
+    }
+
+    this.onBufferConsumedCallback = callback;
+    this.onBufferConsumedSubscription =
+      this.audioEventEmitter.addAudioEventListener('bufferConsumed', callback);
+
+    (this.node as IAudioBufferQueueSourceNode).onBufferConsumed =
+      this.onBufferConsumedSubscription.subscriptionId;
+  }
+
   public override start(when: number = 0): void {
     if (when < 0) {
       throw new RangeError(
@@ -29,7 +29,9 @@ export default class AudioContext extends BaseAudioContext {
       global.createAudioContext(
         options?.sampleRate || AudioManager.getDevicePreferredSampleRate(),
         options?.initSuspended || false,
-        audioRuntime
+        audioRuntime,
+        options?.decodeWorkerCount ?? 0,
+        options?.renderWorkerCount ?? -1
       )
     );
     this._audioRuntime = audioRuntime;
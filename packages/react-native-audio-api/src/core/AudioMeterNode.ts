@@ -0,0 +1,17 @@
+import { IAudioMeterNode } from '../interfaces';
+import { AudioMeterMeasurements } from '../types';
+import AudioNode from './AudioNode';
+
+export default class AudioMeterNode extends AudioNode {
+  public get numberOfBands(): number {
+    return (this.node as IAudioMeterNode).numberOfBands;
+  }
+
+  public get bandFrequencies(): number[] {
+    return (this.node as IAudioMeterNode).bandFrequencies;
+  }
+
+  public getMeasurements(): AudioMeterMeasurements {
+    return (this.node as IAudioMeterNode).getMeasurements();
+  }
+}
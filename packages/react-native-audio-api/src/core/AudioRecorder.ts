@@ -3,7 +3,9 @@ import { AudioRecorderOptions } from '../types';
 import AudioBuffer from './AudioBuffer';
 import { OnAudioReadyEventType } from '../events/types';
 import { AudioEventEmitter } from '../events';
+import { RangeError } from '../errors';
 import RecorderAdapterNode from './RecorderAdapterNode';
+import AudioRecorderTap from './AudioRecorderTap';
 
 export default class AudioRecorder {
   protected readonly recorder: IAudioRecorder;
@@ -38,6 +40,20 @@ export default class AudioRecorder {
     this.recorder.disconnect();
   }
 
+  public createTap(capacity: number = 65536): AudioRecorderTap {
+    if (capacity < 1) {
+      throw new RangeError(
+        `The capacity provided (${capacity}) must be a positive number of frames`
+      );
+    }
+
+    return new AudioRecorderTap(this.recorder.createTap(capacity));
+  }
+
+  public removeTap(): void {
+    this.recorder.removeTap();
+  }
+
   public onAudioReady(callback: (event: OnAudioReadyEventType) => void): void {
     const onAudioReadyCallback = (event: OnAudioReadyEventType) => {
       callback({
@@ -0,0 +1,59 @@
+import { IAudioRecorderTap } from '../interfaces';
+
+// must match the header of SharedAudioRing in common/cpp
+const HEADER_SIZE = 192;
+const DROPPED_FRAMES_WORD = 1;
+
+export default class AudioRecorderTap {
+  readonly capacity: number;
+  private readonly tap: IAudioRecorderTap;
+  // views of the memory shared with the recorder, created once
+  private readonly header: Uint32Array;
+  private readonly samples: Float32Array;
+  private readPosition = 0;
+
+  constructor(tap: IAudioRecorderTap) {
+    this.tap = tap;
+    this.capacity = tap.capacity;
+
+    const buffer = tap.buffer;
+    this.header = new Uint32Array(buffer, 0, HEADER_SIZE / 4);
+    this.samples = new Float32Array(buffer, HEADER_SIZE, this.capacity);
+  }
+
+  public get availableFrames(): number {
+    return this.tap.getAvailableFrames();
+  }
+
+  public get droppedFrames(): number {
+    return this.header[DROPPED_FRAMES_WORD];
+  }
+
+  /**
+   * Passes the recorded frames, at most maxFrames, to the callback without copying them.
+   * The ring wraps around, so the frames come in up to two consecutive parts.
+   * The views are valid only during the callback, the frames are overwritten after it returns.
+   * @returns the number of frames read.
+   */
+  public read(
+    callback: (frames: Float32Array) => void,
+    maxFrames: number = Infinity
+  ): number {
+    const frames = Math.min(this.tap.getAvailableFrames(), maxFrames);
+    if (frames <= 0) {
+      return 0;
+    }
+
+    const firstPart = Math.min(frames, this.capacity - this.readPosition);
+    callback(
+      this.samples.subarray(this.readPosition, this.readPosition + firstPart)
+    );
+    if (frames > firstPart) {
+      callback(this.samples.subarray(0, frames - firstPart));
+    }
+
+    this.readPosition = (this.readPosition + frames) % this.capacity;
+    this.tap.release(frames);
+    return frames;
+  }
+}
@@ -1,8 +1,10 @@
-import { InvalidAccessError, NotSupportedError } from '../errors';
-import { IBaseAudioContext } from '../interfaces';
+import { AbortError, InvalidAccessError, NotSupportedError } from '../errors';
+import { IAudioBuffer, IBaseAudioContext } from '../interfaces';
 import {
   AudioBufferBaseSourceNodeOptions,
   ContextState,
+  DecodeOptions,
+  DecodePriority,
   PeriodicWaveConstraints,
   AudioWorkletRuntime,
 } from '../types';
@@ -10,17 +12,23 @@ import { isWorkletsAvailable, workletsModule } from '../utils';
 import WorkletSourceNode from './WorkletSourceNode';
 import WorkletProcessingNode from './WorkletProcessingNode';
 import AnalyserNode from './AnalyserNode';
+import AudioMeterNode from './AudioMeterNode';
 import AudioBuffer from './AudioBuffer';
 import AudioBufferQueueSourceNode from './AudioBufferQueueSourceNode';
 import AudioBufferSourceNode from './AudioBufferSourceNode';
 import AudioDestinationNode from './AudioDestinationNode';
 import BiquadFilterNode from './BiquadFilterNode';
+import ConvolverNode from './ConvolverNode';
+import DelayNode from './DelayNode';
 import GainNode from './GainNode';
 import OscillatorNode from './OscillatorNode';
+import ParametricEQNode from './ParametricEQNode';
 import PeriodicWave from './PeriodicWave';
 import RecorderAdapterNode from './RecorderAdapterNode';
 import StereoPannerNode from './StereoPannerNode';
 import StreamerNode from './StreamerNode';
+import StreamingAudioBuffer from './StreamingAudioBuffer';
+import StreamingBufferSourceNode from './StreamingBufferSourceNode';
 import WorkletNode from './WorkletNode';
 import ConstantSourceNode from './ConstantSourceNode';
 
@@ -28,6 +36,7 @@ export default class BaseAudioContext {
   readonly destination: AudioDestinationNode;
   readonly sampleRate: number;
   readonly context: IBaseAudioContext;
+  private nextDecodeRequestId = 0;
 
   constructor(context: IBaseAudioContext) {
     this.context = context;
@@ -193,6 +202,33 @@ export default class BaseAudioContext {
     return new BiquadFilterNode(this, this.context.createBiquadFilter());
   }
 
+  createParametricEQ(numberOfBands: number = 10): ParametricEQNode {
+    if (numberOfBands < 1 || numberOfBands > 32) {
+      throw new NotSupportedError(
+        `The number of bands provided (${numberOfBands}) is outside the range [1, 32]`
+      );
+    }
+
+    return new ParametricEQNode(
+      this,
+      this.context.createParametricEQ(numberOfBands)
+    );
+  }
+
+  createConvolver(): ConvolverNode {
+    return new ConvolverNode(this, this.context.createConvolver());
+  }
+
+  createDelay(maxDelayTime: number = 1): DelayNode {
+    if (maxDelayTime <= 0 || maxDelayTime >= 180) {
+      throw new NotSupportedError(
+        `The maximum delay time provided (${maxDelayTime}) is outside the range (0, 180)`
+      );
+    }
+
+    return new DelayNode(this, this.context.createDelay(maxDelayTime));
+  }
+
   createBufferSource(
     options?: AudioBufferBaseSourceNodeOptions
   ): AudioBufferSourceNode {
@@ -215,6 +251,17 @@ export default class BaseAudioContext {
     );
   }
 
+  createStreamingBufferSource(
+    options?: AudioBufferBaseSourceNodeOptions
+  ): StreamingBufferSourceNode {
+    const pitchCorrection = options?.pitchCorrection ?? false;
+
+    return new StreamingBufferSourceNode(
+      this,
+      this.context.createStreamingBufferSource(pitchCorrection)
+    );
+  }
+
   createBuffer(
     numOfChannels: number,
     length: number,
@@ -265,31 +312,148 @@ export default class BaseAudioContext {
     return new AnalyserNode(this, this.context.createAnalyser());
   }
 
+  createAudioMeter(numberOfBands: number = 10): AudioMeterNode {
+    if (numberOfBands < 1 || numberOfBands > 32) {
+      throw new NotSupportedError(
+        `The number of bands provided (${numberOfBands}) is outside the range [1, 32]`
+      );
+    }
+
+    return new AudioMeterNode(
+      this,
+      this.context.createAudioMeter(numberOfBands)
+    );
+  }
+
   /** Decodes audio data from a local file path. */
-  async decodeAudioDataSource(sourcePath: string): Promise<AudioBuffer> {
+  async decodeAudioDataSource(
+    sourcePath: string,
+    options?: DecodeOptions
+  ): Promise<AudioBuffer> {
     // Remove the file:// prefix if it exists
     if (sourcePath.startsWith('file://')) {
       sourcePath = sourcePath.replace('file://', '');
     }
 
-    return new AudioBuffer(
-      await this.context.decodeAudioDataSource(sourcePath)
+    return this.decode(
+      (requestId, priority) =>
+        this.context.decodeAudioDataSource(sourcePath, requestId, priority),
+      options
     );
   }
 
+  /**
+   * Opens a local file for playback with a StreamingBufferSourceNode. Only a
+   * few seconds around the playback position are kept decoded in memory.
+   */
+  async streamAudioDataSource(
+    sourcePath: string,
+    options?: DecodeOptions
+  ): Promise<StreamingAudioBuffer> {
+    // Remove the file:// prefix if it exists
+    if (sourcePath.startsWith('file://')) {
+      sourcePath = sourcePath.replace('file://', '');
+    }
+
+    return this.scheduleDecoding(
+      (requestId, priority) =>
+        this.context.streamAudioDataSource(sourcePath, requestId, priority),
+      (buffer) => new StreamingAudioBuffer(buffer),
+      options
+    );
+  }
+
+  /**
+   * Caches files decoded by decodeAudioDataSource in the directory, later
+   * loads of an unchanged file map the cached samples instead of decoding it
+   * again. Passing null disables the cache.
+   */
+  setDecodedAudioCacheDirectory(directory: string | null): void {
+    // Remove the file:// prefix if it exists
+    if (directory?.startsWith('file://')) {
+      directory = directory.replace('file://', '');
+    }
+
+    this.context.setDecodedAudioCacheDirectory(directory ?? '');
+  }
+
   /** Decodes audio data from an ArrayBuffer. */
-  async decodeAudioData(data: ArrayBuffer): Promise<AudioBuffer> {
-    return new AudioBuffer(
-      await this.context.decodeAudioData(new Uint8Array(data))
+  async decodeAudioData(
+    data: ArrayBuffer,
+    options?: DecodeOptions
+  ): Promise<AudioBuffer> {
+    return this.decode(
+      (requestId, priority) =>
+        this.context.decodeAudioData(
+          new Uint8Array(data),
+          requestId,
+          priority
+        ),
+      options
     );
   }
 
   async decodePCMInBase64Data(
     base64: string,
-    playbackRate: number = 1.0
+    playbackRate: number = 1.0,
+    options?: DecodeOptions
   ): Promise<AudioBuffer> {
-    return new AudioBuffer(
-      await this.context.decodePCMAudioDataInBase64(base64, playbackRate)
+    return this.decode(
+      (requestId, priority) =>
+        this.context.decodePCMAudioDataInBase64(
+          base64,
+          playbackRate,
+          requestId,
+          priority
+        ),
+      options
+    );
+  }
+
+  // Decoding runs on a pool of native threads shared by the context. Aborting
+  // removes a request that is still waiting for a thread, a request that is
+  // already being decoded finishes, but its result is dropped.
+  private decode(
+    start: (
+      requestId: number,
+      priority: DecodePriority
+    ) => Promise<IAudioBuffer>,
+    options?: DecodeOptions
+  ): Promise<AudioBuffer> {
+    return this.scheduleDecoding(
+      start,
+      (buffer) => new AudioBuffer(buffer),
+      options
     );
   }
+
+  private scheduleDecoding<Native, Result>(
+    start: (requestId: number, priority: DecodePriority) => Promise<Native>,
+    wrap: (result: Native) => Result,
+    options?: DecodeOptions
+  ): Promise<Result> {
+    const signal = options?.signal;
+    if (signal?.aborted) {
+      return Promise.reject(new AbortError('Decoding was aborted.'));
+    }
+
+    const requestId = this.nextDecodeRequestId++;
+    const decoding = start(requestId, options?.priority ?? 'immediate');
+
+    if (!signal) {
+      return decoding.then(wrap);
+    }
+
+    return new Promise((resolve, reject) => {
+      const onAbort = () => {
+        this.context.cancelDecoding(requestId);
+        reject(new AbortError('Decoding was aborted.'));
+      };
+      signal.addEventListener('abort', onAbort);
+
+      decoding
+        .then((result) => resolve(wrap(result)), reject)
+        .finally(() => signal.removeEventListener('abort', onAbort));
+    });
+  }
 }
@@ -1,4 +1,4 @@
-import { InvalidAccessError } from '../errors';
+import { InvalidAccessError, RangeError } from '../errors';
 import { IBiquadFilterNode } from '../interfaces';
 import AudioNode from './AudioNode';
 import AudioParam from './AudioParam';
@@ -27,6 +27,20 @@ export default class BiquadFilterNode extends AudioNode {
     (this.node as IBiquadFilterNode).type = value;
   }
 
+  public get automationSubBlockSize(): number {
+    return (this.node as IBiquadFilterNode).automationSubBlockSize;
+  }
+
+  public set automationSubBlockSize(value: number) {
+    if (!Number.isInteger(value) || value < 0 || value > 128) {
+      throw new RangeError(
+        `automationSubBlockSize must be an integer in the range [0, 128]: ${value}`
+      );
+    }
+
+    (this.node as IBiquadFilterNode).automationSubBlockSize = value;
+  }
+
   public getFrequencyResponse(
     frequencyArray: Float32Array,
     magResponseOutput: Float32Array,
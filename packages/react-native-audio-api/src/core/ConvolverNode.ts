@@ -0,0 +1,43 @@
+import { IConvolverNode } from '../interfaces';
+import AudioNode from './AudioNode';
+import AudioBuffer from './AudioBuffer';
+import { NotSupportedError } from '../errors';
+
+export default class ConvolverNode extends AudioNode {
+  public get buffer(): AudioBuffer | null {
+    const buffer = (this.node as IConvolverNode).buffer;
+    if (!buffer) {
+      return null;
+    }
+    return new AudioBuffer(buffer);
+  }
+
+  public set buffer(buffer: AudioBuffer | null) {
+    if (!buffer) {
+      (this.node as IConvolverNode).setBuffer(null);
+      return;
+    }
+
+    if (![1, 2, 4].includes(buffer.numberOfChannels)) {
+      throw new NotSupportedError(
+        `The number of channels of the buffer (${buffer.numberOfChannels}) has to be 1, 2 or 4`
+      );
+    }
+
+    if (buffer.sampleRate !== this.context.sampleRate) {
+      throw new NotSupportedError(
+        `The sample rate of the buffer (${buffer.sampleRate}) has to match the sample rate of the context (${this.context.sampleRate})`
+      );
+    }
+
+    (this.node as IConvolverNode).setBuffer(buffer.buffer);
+  }
+
+  public get normalize(): boolean {
+    return (this.node as IConvolverNode).normalize;
+  }
+
+  public set normalize(value: boolean) {
+    (this.node as IConvolverNode).normalize = value;
+  }
+}
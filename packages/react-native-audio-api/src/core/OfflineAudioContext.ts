@@ -27,13 +27,14 @@ export default class OfflineAudioContext extends BaseAudioContext {
     }
 
     if (typeof arg0 === 'object') {
-      const { numberOfChannels, length, sampleRate } = arg0;
+      const { numberOfChannels, length, sampleRate, decodeWorkerCount } = arg0;
       super(
         global.createOfflineAudioContext(
           numberOfChannels,
           length,
           sampleRate,
-          audioRuntime
+          audioRuntime,
+          decodeWorkerCount ?? 0
         )
       );
 
@@ -43,7 +44,9 @@ export default class OfflineAudioContext extends BaseAudioContext {
       typeof arg1 === 'number' &&
       typeof arg2 === 'number'
     ) {
-      super(global.createOfflineAudioContext(arg0, arg1, arg2, audioRuntime));
+      super(
+        global.createOfflineAudioContext(arg0, arg1, arg2, audioRuntime, 0)
+      );
       this.duration = arg1 / arg2;
     } else {
       throw new NotSupportedError('Invalid constructor arguments');
@@ -0,0 +1,93 @@
+import { IndexSizeError, InvalidAccessError } from '../errors';
+import { IParametricEQNode } from '../interfaces';
+import AudioNode from './AudioNode';
+import BaseAudioContext from './BaseAudioContext';
+import { BiquadFilterType } from '../types';
+
+export class ParametricEQBand {
+  private readonly node: IParametricEQNode;
+  readonly index: number;
+
+  constructor(node: IParametricEQNode, index: number) {
+    this.node = node;
+    this.index = index;
+  }
+
+  public get type(): BiquadFilterType {
+    return this.node.getBandType(this.index);
+  }
+
+  public set type(value: BiquadFilterType) {
+    this.node.setBandType(this.index, value);
+  }
+
+  public get frequency(): number {
+    return this.node.getBandFrequency(this.index);
+  }
+
+  public set frequency(value: number) {
+    this.node.setBandFrequency(this.index, value);
+  }
+
+  public get Q(): number {
+    return this.node.getBandQ(this.index);
+  }
+
+  public set Q(value: number) {
+    this.node.setBandQ(this.index, value);
+  }
+
+  public get gain(): number {
+    return this.node.getBandGain(this.index);
+  }
+
+  public set gain(value: number) {
+    this.node.setBandGain(this.index, value);
+  }
+}
+
+export default class ParametricEQNode extends AudioNode {
+  readonly bands: ReadonlyArray<ParametricEQBand>;
+
+  constructor(context: BaseAudioContext, parametricEQ: IParametricEQNode) {
+    super(context, parametricEQ);
+    this.bands = Array.from(
+      { length: parametricEQ.numberOfBands },
+      (_, index) => new ParametricEQBand(parametricEQ, index)
+    );
+  }
+
+  public get numberOfBands(): number {
+    return (this.node as IParametricEQNode).numberOfBands;
+  }
+
+  public getBand(index: number): ParametricEQBand {
+    if (index < 0 || index >= this.bands.length) {
+      throw new IndexSizeError(
+        `The band index (${index}) is outside the range [0, ${this.bands.length - 1}]`
+      );
+    }
+
+    return this.bands[index];
+  }
+
+  public getFrequencyResponse(
+    frequencyArray: Float32Array,
+    magResponseOutput: Float32Array,
+    phaseResponseOutput: Float32Array
+  ) {
+    if (
+      frequencyArray.length !== magResponseOutput.length ||
+      frequencyArray.length !== phaseResponseOutput.length
+    ) {
+      throw new InvalidAccessError(
+        `The lengths of the arrays are not the same frequencyArray: ${frequencyArray.length}, magResponseOutput: ${magResponseOutput.length}, phaseResponseOutput: ${phaseResponseOutput.length}`
+      );
+    }
+    (this.node as IParametricEQNode).getFrequencyResponse(
+      frequencyArray,
+      magResponseOutput,
+      phaseResponseOutput
+    );
+  }
+}
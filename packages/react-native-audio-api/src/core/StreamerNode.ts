@@ -1,8 +1,107 @@
+import { RangeError } from '../errors';
+import { AudioEventSubscription } from '../events';
+import { EventTypeWithValue } from '../events/types';
 import { IStreamerNode } from '../interfaces';
 import AudioScheduledSourceNode from './AudioScheduledSourceNode';
 
 export default class StreamerNode extends AudioScheduledSourceNode {
+  private onBufferUnderrunSubscription?: AudioEventSubscription;
+  private onBufferUnderrunCallback?: (event: EventTypeWithValue) => void;
+  private onBufferLevelChangedSubscription?: AudioEventSubscription;
+  private onBufferLevelChangedCallback?: (event: EventTypeWithValue) => void;
+
   public initialize(streamPath: string): boolean {
     return (this.node as IStreamerNode).initialize(streamPath);
   }
+
+  public seek(position: number): void {
+    if (position < 0) {
+      throw new RangeError(
+        `position must be a non-negative number: ${position}`
+      );
+    }
+
+    (this.node as IStreamerNode).seek(position);
+  }
+
+  public get lowWatermark(): number {
+    return (this.node as IStreamerNode).lowWatermark;
+  }
+
+  public set lowWatermark(value: number) {
+    (this.node as IStreamerNode).lowWatermark = value;
+  }
+
+  public get highWatermark(): number {
+    return (this.node as IStreamerNode).highWatermark;
+  }
+
+  public set highWatermark(value: number) {
+    (this.node as IStreamerNode).highWatermark = value;
+  }
+
+  public get onBufferUnderrun():
+    | ((event: EventTypeWithValue) => void)
+    | undefined {
+    return this.onBufferUnderrunCallback;
+  }
+
+  public set onBufferUnderrun(
+    callback: ((event: EventTypeWithValue) => void) | null
+  ) {
+    this.onBufferUnderrunSubscription?.remove();
+    this.onBufferUnderrunSubscription = undefined;
+
+    if (!callback) {
+      (this.node as IStreamerNode).onBufferUnderrun = '0';
+      this.onBufferUnderrunCallback = undefined;
+
+      return;
+    }
+
+    this.onBufferUnderrunCallback = callback;
+    this.onBufferUnderrunSubscription =
+      this.audioEventEmitter.addAudioEventListener('bufferUnderrun', callback);
+
+    (this.node as IStreamerNode).onBufferUnderrun =
+      this.onBufferUnderrunSubscription.subscriptionId;
+  }
+
+  public get onBufferLevelChanged():
+    | ((event: EventTypeWithValue) => void)
+    | undefined {
+    return this.onBufferLevelChangedCallback;
+  }
+
+  public set onBufferLevelChanged(
+    callback: ((event: EventTypeWithValue) => void) | null
+  ) {
+    this.onBufferLevelChangedSubscription?.remove();
+    this.onBufferLevelChangedSubscription = undefined;
+
+    if (!callback) {
+      (this.node as IStreamerNode).onBufferLevelChanged = '0';
+      this.onBufferLevelChangedCallback = undefined;
+
+      return;
+    }
+
+    this.onBufferLevelChangedCallback = callback;
+    this.onBufferLevelChangedSubscription =
+      this.audioEventEmitter.addAudioEventListener(
+        'bufferLevelChanged',
+        callback
+      );
+
+    (this.node as IStreamerNode).onBufferLevelChanged =
+      this.onBufferLevelChangedSubscription.subscriptionId;
+  }
+
+  public get onBufferLevelChangedInterval(): number {
+    return (this.node as IStreamerNode).onBufferLevelChangedInterval;
+  }
+
+  public set onBufferLevelChangedInterval(value: number) {
+    (this.node as IStreamerNode).onBufferLevelChangedInterval = value;
+  }
 }
@@ -0,0 +1,28 @@
+import { IStreamingAudioBuffer } from '../interfaces';
+
+export default class StreamingAudioBuffer {
+  /** @internal */
+  public readonly buffer: IStreamingAudioBuffer;
+
+  constructor(buffer: IStreamingAudioBuffer) {
+    this.buffer = buffer;
+  }
+
+  /** Length in frames, 0 until the end of the stream is known. */
+  public get length(): number {
+    return this.buffer.length;
+  }
+
+  /** Duration in seconds, 0 until the end of the stream is known. */
+  public get duration(): number {
+    return this.buffer.duration;
+  }
+
+  public get sampleRate(): number {
+    return this.buffer.sampleRate;
+  }
+
+  public get numberOfChannels(): number {
+    return this.buffer.numberOfChannels;
+  }
+}
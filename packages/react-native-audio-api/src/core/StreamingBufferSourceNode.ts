@@ -0,0 +1,61 @@
+import { IStreamingBufferSourceNode } from '../interfaces';
+import AudioBufferBaseSourceNode from './AudioBufferBaseSourceNode';
+import StreamingAudioBuffer from './StreamingAudioBuffer';
+import { InvalidStateError, RangeError } from '../errors';
+import { EventEmptyType } from '../events/types';
+
+export default class StreamingBufferSourceNode extends AudioBufferBaseSourceNode {
+  public get buffer(): StreamingAudioBuffer | null {
+    const buffer = (this.node as IStreamingBufferSourceNode).buffer;
+    if (!buffer) {
+      return null;
+    }
+    return new StreamingAudioBuffer(buffer);
+  }
+
+  public set buffer(buffer: StreamingAudioBuffer | null) {
+    if (!buffer) {
+      (this.node as IStreamingBufferSourceNode).setBuffer(null);
+      return;
+    }
+
+    (this.node as IStreamingBufferSourceNode).setBuffer(buffer.buffer);
+  }
+
+  public start(when: number = 0, offset: number = 0, duration?: number): void {
+    if (when < 0) {
+      throw new RangeError(
+        `when must be a finite non-negative number: ${when}`
+      );
+    }
+
+    if (offset < 0) {
+      throw new RangeError(
+        `offset must be a finite non-negative number: ${offset}`
+      );
+    }
+
+    if (duration && duration < 0) {
+      throw new RangeError(
+        `duration must be a finite non-negative number: ${duration}`
+      );
+    }
+
+    if (this.hasBeenStarted) {
+      throw new InvalidStateError('Cannot call start more than once');
+    }
+
+    this.hasBeenStarted = true;
+    (this.node as IStreamingBufferSourceNode).start(when, offset, duration);
+  }
+
+  public override get onEnded(): ((event: EventEmptyType) => void) | undefined {
+    return super.onEnded as ((event: EventEmptyType) => void) | undefined;
+  }
+
+  public override set onEnded(
+    callback: ((event: EventEmptyType) => void) | null
+  ) {
+    super.onEnded = callback;
+  }
+}
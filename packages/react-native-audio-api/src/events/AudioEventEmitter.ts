@@ -27,3 +27,29 @@ export default class AudioEventEmitter {
     this.audioEventEmitter.removeAudioEventListener(name, subscriptionId);
   }
 }
+
+// Called by the native side once per batch of audio events, so the batch
+// crosses into JS in a single call. A throwing handler does not keep the
+// others from their events, the first error is rethrown after the batch.
+export function dispatchAudioEvents(
+  handlers: ((event: object) => void)[],
+  events: object[]
+): void {
+  let firstError: unknown;
+  let hasError = false;
+
+  for (let i = 0; i < handlers.length; i++) {
+    try {
+      handlers[i](events[i]);
+    } catch (error) {
+      if (!hasError) {
+        firstError = error;
+        hasError = true;
+      }
+    }
+  }
+
+  if (hasError) {
+    throw firstError;
+  }
+}
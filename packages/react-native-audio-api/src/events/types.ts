@@ -49,6 +49,13 @@ export interface OnEndedEventType extends EventEmptyType {
   isLast: boolean | undefined;
 }
 
+export interface OnBufferConsumedEventType {
+  bufferId: string;
+  // buffers still in the queue, including the one being played
+  queuedBuffers: number;
+  queuedDuration: number;
+}
+
 export interface OnAudioReadyEventType {
   buffer: AudioBuffer;
   numFrames: number;
@@ -58,8 +65,11 @@ export interface OnAudioReadyEventType {
 interface AudioAPIEvents {
   ended: OnEndedEventType;
   loopEnded: EventEmptyType;
+  bufferConsumed: OnBufferConsumedEventType;
   audioReady: OnAudioReadyEventType;
   positionChanged: EventTypeWithValue;
+  bufferUnderrun: EventTypeWithValue;
+  bufferLevelChanged: EventTypeWithValue;
   audioError: EventEmptyType; // to change
   systemStateChanged: EventEmptyType; // to change
 }
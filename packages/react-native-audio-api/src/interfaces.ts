@@ -1,9 +1,11 @@
 import { AudioEventCallback, AudioEventName } from './events/types';
 import {
+  AudioMeterMeasurements,
   BiquadFilterType,
   ChannelCountMode,
   ChannelInterpretation,
   ContextState,
+  DecodePriority,
   OscillatorType,
   WindowType,
 } from './types';
@@ -58,10 +60,16 @@ export interface IBaseAudioContext {
   createGain(): IGainNode;
   createStereoPanner(): IStereoPannerNode;
   createBiquadFilter: () => IBiquadFilterNode;
+  createParametricEQ: (numberOfBands: number) => IParametricEQNode;
+  createConvolver: () => IConvolverNode;
+  createDelay: (maxDelayTime: number) => IDelayNode;
   createBufferSource: (pitchCorrection: boolean) => IAudioBufferSourceNode;
   createBufferQueueSource: (
     pitchCorrection: boolean
   ) => IAudioBufferQueueSourceNode;
+  createStreamingBufferSource: (
+    pitchCorrection: boolean
+  ) => IStreamingBufferSourceNode;
   createBuffer: (
     channels: number,
     length: number,
@@ -73,12 +81,30 @@ export interface IBaseAudioContext {
     disableNormalization: boolean
   ) => IPeriodicWave;
   createAnalyser: () => IAnalyserNode;
-  decodeAudioDataSource: (sourcePath: string) => Promise<IAudioBuffer>;
-  decodeAudioData: (arrayBuffer: ArrayBuffer) => Promise<IAudioBuffer>;
+  createAudioMeter: (numberOfBands: number) => IAudioMeterNode;
+  decodeAudioDataSource: (
+    sourcePath: string,
+    requestId: number,
+    priority: DecodePriority
+  ) => Promise<IAudioBuffer>;
+  streamAudioDataSource: (
+    sourcePath: string,
+    requestId: number,
+    priority: DecodePriority
+  ) => Promise<IStreamingAudioBuffer>;
+  decodeAudioData: (
+    arrayBuffer: ArrayBuffer,
+    requestId: number,
+    priority: DecodePriority
+  ) => Promise<IAudioBuffer>;
   decodePCMAudioDataInBase64: (
     b64: string,
-    playbackRate: number
+    playbackRate: number,
+    requestId: number,
+    priority: DecodePriority
   ) => Promise<IAudioBuffer>;
+  cancelDecoding: (requestId: number) => boolean;
+  setDecodedAudioCacheDirectory: (directory: string) => void;
   createStreamer: () => IStreamerNode;
 }
 
@@ -120,7 +146,26 @@ export interface IBiquadFilterNode extends IAudioNode {
   readonly Q: AudioParam;
   readonly gain: AudioParam;
   type: BiquadFilterType;
+  automationSubBlockSize: number;
+
+  getFrequencyResponse(
+    frequencyArray: Float32Array,
+    magResponseOutput: Float32Array,
+    phaseResponseOutput: Float32Array
+  ): void;
+}
 
+export interface IParametricEQNode extends IAudioNode {
+  readonly numberOfBands: number;
+
+  getBandType(band: number): BiquadFilterType;
+  setBandType(band: number, type: BiquadFilterType): void;
+  getBandFrequency(band: number): number;
+  setBandFrequency(band: number, frequency: number): void;
+  getBandQ(band: number): number;
+  setBandQ(band: number, Q: number): void;
+  getBandGain(band: number): number;
+  setBandGain(band: number, gain: number): void;
   getFrequencyResponse(
     frequencyArray: Float32Array,
     magResponseOutput: Float32Array,
@@ -128,6 +173,17 @@ export interface IBiquadFilterNode extends IAudioNode {
   ): void;
 }
 
+export interface IConvolverNode extends IAudioNode {
+  readonly buffer: IAudioBuffer | null;
+  normalize: boolean;
+
+  setBuffer: (audioBuffer: IAudioBuffer | null) => void;
+}
+
+export interface IDelayNode extends IAudioNode {
+  readonly delayTime: IAudioParam;
+}
+
 export interface IAudioDestinationNode extends IAudioNode {}
 
 export interface IAudioScheduledSourceNode extends IAudioNode {
@@ -157,7 +213,16 @@ export interface IOscillatorNode extends IAudioScheduledSourceNode {
 }
 
 export interface IStreamerNode extends IAudioNode {
+  lowWatermark: number;
+  highWatermark: number;
+  // remove the event listener by setting the callback to '0'
+  onBufferUnderrun: string;
+  onBufferLevelChanged: string;
+  // set how often the onBufferLevelChanged event is called
+  onBufferLevelChangedInterval: number;
+
   initialize(streamPath: string): boolean;
+  seek(position: number): void;
 }
 
 export interface IConstantSourceNode extends IAudioScheduledSourceNode {
@@ -180,6 +245,11 @@ export interface IAudioBufferSourceNode extends IAudioBufferBaseSourceNode {
 
 export interface IAudioBufferQueueSourceNode
   extends IAudioBufferBaseSourceNode {
+  crossfadeDuration: number;
+
+  // passing subscriptionId(uint_64 in cpp, string in js) to the cpp
+  onBufferConsumed: string;
+
   dequeueBuffer: (bufferId: number) => void;
   clearBuffers: () => void;
 
@@ -188,6 +258,22 @@ export interface IAudioBufferQueueSourceNode
   pause: () => void;
 }
 
+export interface IStreamingBufferSourceNode
+  extends IAudioBufferBaseSourceNode {
+  readonly buffer: IStreamingAudioBuffer | null;
+
+  start: (when?: number, offset?: number, duration?: number) => void;
+  setBuffer: (audioBuffer: IStreamingAudioBuffer | null) => void;
+}
+
+export interface IStreamingAudioBuffer {
+  // 0 until the end of the stream is known
+  readonly length: number;
+  readonly duration: number;
+  readonly sampleRate: number;
+  readonly numberOfChannels: number;
+}
+
 export interface IAudioBuffer {
   readonly length: number;
   readonly duration: number;
@@ -239,6 +325,8 @@ export interface IAnalyserNode extends IAudioNode {
   maxDecibels: number;
   smoothingTimeConstant: number;
   window: WindowType;
+  // milliseconds between analyses of the background analysis thread
+  analysisInterval: number;
 
   getFloatFrequencyData: (array: Float32Array) => void;
   getByteFrequencyData: (array: Uint8Array) => void;
@@ -246,6 +334,14 @@ export interface IAnalyserNode extends IAudioNode {
   getByteTimeDomainData: (array: Uint8Array) => void;
 }
 
+export interface IAudioMeterNode extends IAudioNode {
+  readonly numberOfBands: number;
+  // center frequencies of the bands in Hz
+  readonly bandFrequencies: number[];
+
+  getMeasurements: () => AudioMeterMeasurements;
+}
+
 export interface IRecorderAdapterNode extends IAudioNode {}
 
 export interface IWorkletNode extends IAudioNode {}
@@ -259,11 +355,22 @@ export interface IAudioRecorder {
   stop: () => void;
   connect: (node: IRecorderAdapterNode) => void;
   disconnect: () => void;
+  createTap: (capacity: number) => IAudioRecorderTap;
+  removeTap: () => void;
 
   // passing subscriptionId(uint_64 in cpp, string in js) to the cpp
   onAudioReady: string;
 }
 
+export interface IAudioRecorderTap {
+  // header with the indices followed by the samples, shared with the recorder
+  readonly buffer: ArrayBuffer;
+  readonly capacity: number;
+
+  getAvailableFrames: () => number;
+  release: (frames: number) => void;
+}
+
 export interface IAudioEventEmitter {
   addAudioEventListener<Name extends AudioEventName>(
     name: Name,
@@ -273,4 +380,10 @@ export interface IAudioEventEmitter {
     name: Name,
     subscriptionId: string
   ): void;
+  setEventBatchDispatcher(
+    dispatcher: (
+      handlers: ((event: object) => void)[],
+      events: object[]
+    ) => void
+  ): void;
 }
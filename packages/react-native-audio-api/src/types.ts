@@ -30,12 +30,24 @@ export interface PeriodicWaveConstraints {
 export interface AudioContextOptions {
   sampleRate?: number;
   initSuspended?: boolean;
+  decodeWorkerCount?: number;
+  // threads rendering independent parts of the graph next to the audio
+  // thread, 0 renders on the audio thread only, picked from the cores if unset
+  renderWorkerCount?: number;
 }
 
 export interface OfflineAudioContextOptions {
   numberOfChannels: number;
   length: number;
   sampleRate: number;
+  decodeWorkerCount?: number;
+}
+
+export type DecodePriority = 'immediate' | 'prefetch';
+
+export interface DecodeOptions {
+  priority?: DecodePriority;
+  signal?: AbortSignal;
 }
 
 export interface AudioRecorderOptions {
@@ -45,6 +57,19 @@ export interface AudioRecorderOptions {
 
 export type WindowType = 'blackman' | 'hann';
 
+export interface AudioMeterMeasurements {
+  // dBFS of every input channel, over the last 300 ms
+  rms: number[];
+  peak: number[];
+  // dBTP, peak of the 4 times oversampled input
+  truePeak: number[];
+  // LUFS (ITU-R BS.1770), over the last 400 ms and 3 s
+  momentaryLoudness: number;
+  shortTermLoudness: number;
+  // dBFS of every band of the down mixed input, over the last 300 ms
+  bandEnergies: number[];
+}
+
 export interface AudioBufferBaseSourceNodeOptions {
   pitchCorrection: boolean;
 }